@@ -0,0 +1,300 @@
+#include <Utils/Filesystem/DirectoryManager.hpp>
+#include <Utils/Filesystem/GlobMatcher.hpp>
+#include <Utils/UtilsFactory.hpp>
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace nixoncpp::utils;
+namespace fs = std::filesystem;
+
+namespace {
+  // Files spread over directories of 100 files, 10 per parent
+  void writeTree(const fs::path &root, std::int64_t files) {
+    for (std::int64_t file = 0; file < files; ++file) {
+      const auto directory = file / 100;
+      const auto dir =
+          root / ("p" + std::to_string(directory / 10)) / ("d" + std::to_string(directory));
+      if (file % 100 == 0) {
+        fs::create_directories(dir);
+      }
+      std::ofstream(dir / ("f" + std::to_string(file)));
+    }
+  }
+
+  // Tree of range(0) files
+  fs::path benchmarkTree;
+
+  void createTree(const benchmark::State &state) {
+    benchmarkTree = fs::temp_directory_path() /
+                    ("nixoncpp_directory_benchmark_" + std::to_string(state.range(0)));
+    fs::remove_all(benchmarkTree);
+    writeTree(benchmarkTree, state.range(0));
+  }
+
+  void removeTree(const benchmark::State & /*state*/) {
+    std::error_code ec;
+    fs::remove_all(benchmarkTree, ec);
+  }
+
+  void applyTreeSizes(benchmark::internal::Benchmark *bench) {
+    bench->ArgName("files")->Arg(10000)->Setup(createTree)->Teardown(removeTree);
+  }
+} // namespace
+
+// The std::filesystem walk listEntriesRecursive() used before
+static void BM_RecursiveDirectoryIterator(benchmark::State &state) {
+  for (auto _ : state) {
+    std::vector<fs::path> entries;
+    for (const auto &entry : fs::recursive_directory_iterator(benchmarkTree)) {
+      entries.push_back(entry.path());
+    }
+    benchmark::DoNotOptimize(entries);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RecursiveDirectoryIterator)->Apply(applyTreeSizes);
+
+static void BM_RecursiveDirectoryIteratorStat(benchmark::State &state) {
+  for (auto _ : state) {
+    std::uintmax_t total = 0;
+    for (const auto &entry : fs::recursive_directory_iterator(benchmarkTree)) {
+      if (entry.is_regular_file()) {
+        total += entry.file_size();
+      }
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RecursiveDirectoryIteratorStat)->Apply(applyTreeSizes);
+
+static void BM_Walk(benchmark::State &state) {
+  DirectoryManager manager;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(manager.walk(benchmarkTree));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Walk)->Apply(applyTreeSizes);
+
+static void BM_WalkStat(benchmark::State &state) {
+  DirectoryManager manager;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(manager.walk(benchmarkTree, WalkOptions{.withStat = true}));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_WalkStat)->Apply(applyTreeSizes);
+
+static void BM_WalkParallel(benchmark::State &state) {
+  DirectoryManager manager(UtilsFactory::createThreadPool());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(manager.walk(benchmarkTree));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_WalkParallel)->Apply(applyTreeSizes)->UseRealTime();
+
+// Find one file by name: listing materializes the whole tree first, iterate() stops early
+static void BM_FindFirstListed(benchmark::State &state) {
+  DirectoryManager manager;
+  for (auto _ : state) {
+    auto entries = manager.listEntriesRecursive(benchmarkTree);
+    const auto found = std::find_if(entries.value().begin(), entries.value().end(),
+                                    [](const auto &path) { return path.filename() == "f150"; });
+    benchmark::DoNotOptimize(found);
+  }
+}
+BENCHMARK(BM_FindFirstListed)->Apply(applyTreeSizes);
+
+static void BM_FindFirstIterate(benchmark::State &state) {
+  DirectoryManager manager;
+  WalkOptions options;
+  options.filter.types = {EntryType::Regular};
+  options.filter.predicate = [](const DirectoryEntry &entry) {
+    return entry.path.filename() == "f150";
+  };
+  for (auto _ : state) {
+    auto range = manager.iterate(benchmarkTree, options);
+    benchmark::DoNotOptimize(range.value().next());
+  }
+}
+BENCHMARK(BM_FindFirstIterate)->Apply(applyTreeSizes);
+
+namespace {
+  // Pattern matching 1% of the tree: the files ending in 7 below p3
+  constexpr std::string_view kGlobPattern = "p3/**/f*7";
+
+  std::shared_ptr<const GlobMatcher> compileGlob(std::string_view pattern) {
+    return std::make_shared<const GlobMatcher>(GlobMatcher::compile(pattern).value());
+  }
+} // namespace
+
+// Glob on the relative path checked after the whole tree has been read
+static void BM_WalkGlobPredicate(benchmark::State &state) {
+  DirectoryManager manager;
+  const auto glob = compileGlob(kGlobPattern);
+  const auto prefix = benchmarkTree.native().size() + 1;
+  WalkOptions options;
+  options.filter.predicate = [&glob, prefix](const DirectoryEntry &entry) {
+    return glob->matches(std::string_view(entry.path.native()).substr(prefix));
+  };
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(manager.walk(benchmarkTree, options));
+  }
+}
+BENCHMARK(BM_WalkGlobPredicate)->Apply(applyTreeSizes);
+
+// The same glob as a filter, which leaves the subtrees that cannot match unread
+static void BM_WalkGlob(benchmark::State &state) {
+  DirectoryManager manager;
+  WalkOptions options;
+  options.filter.glob = compileGlob(kGlobPattern);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(manager.walk(benchmarkTree, options));
+  }
+}
+BENCHMARK(BM_WalkGlob)->Apply(applyTreeSizes);
+
+// range(0) patterns against paths of the tree's shape: one combined matcher versus one
+// matcher per pattern
+namespace {
+  std::vector<std::string> globPatterns(std::int64_t count) {
+    std::vector<std::string> patterns;
+    for (std::int64_t i = 0; i < count; ++i) {
+      patterns.push_back("**/d" + std::to_string(i) + "/*.{log,txt}");
+    }
+    return patterns;
+  }
+
+  std::vector<std::string> globPaths() {
+    std::vector<std::string> paths;
+    for (int file = 0; file < 1000; ++file) {
+      paths.push_back("p" + std::to_string(file / 100) + "/d" + std::to_string(file / 10) +
+                      "/f" + std::to_string(file) + (file % 2 == 0 ? ".txt" : ".cpp"));
+    }
+    return paths;
+  }
+} // namespace
+
+static void BM_GlobMatchCombined(benchmark::State &state) {
+  const auto patterns = globPatterns(state.range(0));
+  const std::vector<std::string_view> views(patterns.begin(), patterns.end());
+  const auto glob = GlobMatcher::compile(views).value();
+  const auto paths = globPaths();
+  for (auto _ : state) {
+    std::size_t matched = 0;
+    for (const auto &path : paths) {
+      matched += glob.matches(path) ? 1 : 0;
+    }
+    benchmark::DoNotOptimize(matched);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(paths.size()));
+}
+BENCHMARK(BM_GlobMatchCombined)->ArgName("patterns")->Arg(1)->Arg(16)->Arg(32);
+
+static void BM_GlobMatchEach(benchmark::State &state) {
+  std::vector<GlobMatcher> globs;
+  for (const auto &pattern : globPatterns(state.range(0))) {
+    globs.push_back(GlobMatcher::compile(pattern).value());
+  }
+  const auto paths = globPaths();
+  for (auto _ : state) {
+    std::size_t matched = 0;
+    for (const auto &path : paths) {
+      matched += std::ranges::any_of(globs, [&path](const auto &glob) {
+        return glob.matches(path);
+      }) ? 1 : 0;
+    }
+    benchmark::DoNotOptimize(matched);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(paths.size()));
+}
+BENCHMARK(BM_GlobMatchEach)->ArgName("patterns")->Arg(1)->Arg(16)->Arg(32);
+
+static void BM_Snapshot(benchmark::State &state) {
+  DirectoryManager manager;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(manager.snapshot(benchmarkTree));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Snapshot)->Apply(applyTreeSizes);
+
+// Rescanning an unchanged tree: every entry stat'ed again, or only the directories
+namespace {
+  void benchmarkRescan(benchmark::State &state, const RescanOptions &options) {
+    // Directories modified just before a scan are always read again
+    const auto past = fs::file_time_type::clock::now() - std::chrono::hours(1);
+    for (const auto &entry : fs::recursive_directory_iterator(benchmarkTree)) {
+      if (entry.is_directory()) {
+        fs::last_write_time(entry.path(), past);
+      }
+    }
+    fs::last_write_time(benchmarkTree, past);
+
+    DirectoryManager manager;
+    const auto previous = manager.snapshot(benchmarkTree).value();
+    for (auto _ : state) {
+      auto current = manager.rescan(benchmarkTree, previous, options);
+      benchmark::DoNotOptimize(previous.diff(current.value()));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+} // namespace
+
+static void BM_RescanFull(benchmark::State &state) {
+  benchmarkRescan(state, RescanOptions{.skipUnchangedDirectories = false});
+}
+BENCHMARK(BM_RescanFull)->Apply(applyTreeSizes);
+
+static void BM_RescanSkipUnchanged(benchmark::State &state) {
+  benchmarkRescan(state, RescanOptions{.skipUnchangedDirectories = true});
+}
+BENCHMARK(BM_RescanSkipUnchanged)->Apply(applyTreeSizes);
+
+// Removing a tree of range(0) files, recreated outside the timed region
+namespace {
+  template <typename Remove>
+  void benchmarkRemoval(benchmark::State &state, const Remove &remove) {
+    const auto root = fs::temp_directory_path() / "nixoncpp_remove_benchmark";
+    fs::remove_all(root);
+    for (auto _ : state) {
+      state.PauseTiming();
+      writeTree(root, state.range(0));
+      state.ResumeTiming();
+      benchmark::DoNotOptimize(remove(root));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+} // namespace
+
+static void BM_RemoveAll(benchmark::State &state) {
+  benchmarkRemoval(state, [](const fs::path &root) { return fs::remove_all(root); });
+}
+BENCHMARK(BM_RemoveAll)->ArgName("files")->Arg(2000);
+
+static void BM_RemoveRecursive(benchmark::State &state) {
+  DirectoryManager manager;
+  benchmarkRemoval(state, [&manager](const fs::path &root) {
+    return manager.removeDirectoryRecursive(root).value();
+  });
+}
+BENCHMARK(BM_RemoveRecursive)->ArgName("files")->Arg(2000);
+
+static void BM_RemoveRecursiveParallel(benchmark::State &state) {
+  DirectoryManager manager(UtilsFactory::createThreadPool());
+  benchmarkRemoval(state, [&manager](const fs::path &root) {
+    return manager.removeDirectoryRecursive(root).value();
+  });
+}
+BENCHMARK(BM_RemoveRecursiveParallel)->ArgName("files")->Arg(2000)->UseRealTime();
+
+BENCHMARK_MAIN();
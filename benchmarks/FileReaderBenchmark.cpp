@@ -0,0 +1,319 @@
+#include <Utils/Filesystem/CachingFileReader.hpp>
+#include <Utils/Filesystem/ChunkedFileProcessor.hpp>
+#include <Utils/Filesystem/Crc32c.hpp>
+#include <Utils/Filesystem/FileHasher.hpp>
+#include <Utils/Filesystem/FileReader.hpp>
+#include <Utils/UtilsFactory.hpp>
+#include <Utils/String/NewlineScanner.hpp>
+#include <array>
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace nixoncpp::utils;
+namespace fs = std::filesystem;
+
+namespace {
+  // range(0) = file size in bytes
+  fs::path benchmarkFile;
+
+  void createFile(const benchmark::State &state) {
+    benchmarkFile = fs::temp_directory_path() /
+                    ("nixoncpp_reader_benchmark_" + std::to_string(state.range(0)) + ".bin");
+    std::string content(static_cast<std::size_t>(state.range(0)), '\0');
+    for (std::size_t i = 0; i < content.size(); ++i) {
+      content[i] = (i % 80 == 79) ? '\n' : static_cast<char>('a' + (i % 26));
+    }
+    std::ofstream(benchmarkFile, std::ios::binary) << content;
+  }
+
+  void removeFile(const benchmark::State & /*state*/) {
+    std::error_code ec;
+    fs::remove(benchmarkFile, ec);
+  }
+
+  void applySizes(benchmark::internal::Benchmark *bench) {
+    bench->ArgName("bytes")
+        ->Arg(512)
+        ->Arg(64 << 10)
+        ->Arg(16 << 20)
+        ->Setup(createFile)
+        ->Teardown(removeFile);
+  }
+
+  // The stream-based implementation FileReader used before the POSIX fast path
+  std::vector<uint8_t> legacyReadBytes(const fs::path &filePath) {
+    std::error_code ec;
+    if (!fs::exists(filePath, ec) || fs::is_directory(filePath, ec)) {
+      return {};
+    }
+    std::ifstream file(filePath, std::ios::binary);
+    // getSize() validated the path a second time before querying the size
+    if (!fs::exists(filePath, ec) || fs::is_directory(filePath, ec)) {
+      return {};
+    }
+    std::vector<uint8_t> buffer;
+    buffer.reserve(static_cast<std::size_t>(fs::file_size(filePath, ec)));
+    buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return buffer;
+  }
+
+  std::string legacyRead(const fs::path &filePath) {
+    std::error_code ec;
+    if (!fs::exists(filePath, ec) || fs::is_directory(filePath, ec)) {
+      return {};
+    }
+    std::ifstream file(filePath, std::ios::in);
+    std::ostringstream buffer;
+    buffer << file.rdbuf();
+    return buffer.str();
+  }
+} // namespace
+
+static void BM_LegacyReadBytes(benchmark::State &state) {
+  for (auto _ : state) {
+    auto bytes = legacyReadBytes(benchmarkFile);
+    benchmark::DoNotOptimize(bytes.data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LegacyReadBytes)->Apply(applySizes);
+
+static void BM_ReadBytes(benchmark::State &state) {
+  FileReader reader;
+  for (auto _ : state) {
+    auto bytes = reader.readBytes(benchmarkFile);
+    benchmark::DoNotOptimize(bytes.value().data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ReadBytes)->Apply(applySizes);
+
+static void BM_LegacyRead(benchmark::State &state) {
+  for (auto _ : state) {
+    auto text = legacyRead(benchmarkFile);
+    benchmark::DoNotOptimize(text.data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LegacyRead)->Apply(applySizes);
+
+static void BM_Read(benchmark::State &state) {
+  FileReader reader;
+  for (auto _ : state) {
+    auto text = reader.read(benchmarkFile);
+    benchmark::DoNotOptimize(text.value().data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Read)->Apply(applySizes);
+
+// Repeated reads of an unchanged file: one stat and no copy per hit
+static void BM_ReadCached(benchmark::State &state) {
+  CachingFileReader reader(std::make_shared<FileReader>());
+  for (auto _ : state) {
+    auto text = reader.readShared(benchmarkFile);
+    benchmark::DoNotOptimize(text.value()->data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ReadCached)->Apply(applySizes);
+
+// Baseline: load the whole file, then checksum the buffer
+static void BM_ReadBytesCrc32c(benchmark::State &state) {
+  FileReader reader;
+  for (auto _ : state) {
+    auto bytes = reader.readBytes(benchmarkFile);
+    benchmark::DoNotOptimize(crc32c(0, std::as_bytes(std::span(bytes.value()))));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ReadBytesCrc32c)->Apply(applySizes);
+
+static void BM_HashFileCrc32c(benchmark::State &state) {
+  FileHasher hasher;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(hasher.hashFile(benchmarkFile, HashAlgorithm::Crc32c));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_HashFileCrc32c)->Apply(applySizes);
+
+static void BM_HashFileXxh3(benchmark::State &state) {
+  if (!isHashAlgorithmAvailable(HashAlgorithm::Xxh3_64)) {
+    state.SkipWithError("built without libxxhash");
+    return;
+  }
+  FileHasher hasher;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(hasher.hashFile(benchmarkFile, HashAlgorithm::Xxh3_64));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_HashFileXxh3)->Apply(applySizes);
+
+static void BM_Map(benchmark::State &state) {
+  FileReader reader;
+  for (auto _ : state) {
+    auto mapped = reader.map(benchmarkFile);
+    benchmark::DoNotOptimize(mapped.value().bytes().data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Map)->Apply(applySizes);
+
+// range(1) = 1 when descriptors come from a FileHandleCache
+static void BM_ReadRange(benchmark::State &state) {
+  FileReader reader(state.range(1) != 0 ? std::make_shared<FileHandleCache>() : nullptr);
+  std::array<std::byte, 4096> buffer{};
+  const auto blocks = static_cast<std::uint64_t>(state.range(0)) / buffer.size();
+  std::uint64_t block = 0;
+  for (auto _ : state) {
+    block = (block * 2654435761U + 1) % blocks;
+    benchmark::DoNotOptimize(reader.readInto(benchmarkFile, buffer, block * buffer.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(buffer.size()));
+}
+BENCHMARK(BM_ReadRange)
+    ->ArgNames({"bytes", "cached"})
+    ->ArgsProduct({{16 << 20}, {0, 1}})
+    ->Setup(createFile)
+    ->Teardown(removeFile);
+
+static void BM_ReadLines(benchmark::State &state) {
+  FileReader reader;
+  for (auto _ : state) {
+    auto lines = reader.readLines(benchmarkFile);
+    benchmark::DoNotOptimize(lines.value().data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ReadLines)->Apply(applySizes);
+
+static void BM_Lines(benchmark::State &state) {
+  FileReader reader;
+  for (auto _ : state) {
+    auto lines = reader.lines(benchmarkFile);
+    std::size_t count = 0;
+    for (std::string_view line : lines.value()) {
+      benchmark::DoNotOptimize(line.data());
+      ++count;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Lines)->Apply(applySizes);
+
+static void BM_ChunkedLineCount(benchmark::State &state) {
+  ChunkedFileProcessor processor(std::make_shared<FileReader>(),
+                                 std::make_shared<ThreadPool>(state.range(1)));
+  const auto countLines = [](std::string_view chunk) {
+    std::size_t count = 0;
+    const char *end = chunk.data() + chunk.size();
+    for (const char *p = findNewline(chunk.data(), end); p != end; p = findNewline(p + 1, end)) {
+      ++count;
+    }
+    return count;
+  };
+  for (auto _ : state) {
+    auto lines = processor.process(
+        benchmarkFile, std::size_t{0}, countLines,
+        [](std::size_t acc, std::size_t part) { return acc + part; },
+        ChunkOptions{.chunkSize = 1 << 20, .order = ResultOrder::Unordered});
+    benchmark::DoNotOptimize(lines.value());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ChunkedLineCount)
+    ->ArgNames({"bytes", "threads"})
+    ->ArgsProduct({{64 << 20}, {1, 2, 4, 8}})
+    ->UseRealTime()
+    ->Setup(createFile)
+    ->Teardown(removeFile);
+
+namespace {
+  // range(0) = number of 4 KiB files
+  std::vector<fs::path> manyFiles;
+
+  void createManyFiles(const benchmark::State &state) {
+    const auto dir = fs::temp_directory_path() / "nixoncpp_reader_benchmark_many";
+    fs::create_directories(dir);
+    manyFiles.clear();
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      manyFiles.push_back(dir / (std::to_string(i) + ".txt"));
+      std::ofstream(manyFiles.back()) << std::string(4096, static_cast<char>('a' + (i % 26)));
+    }
+  }
+
+  void removeManyFiles(const benchmark::State & /*state*/) {
+    std::error_code ec;
+    fs::remove_all(fs::temp_directory_path() / "nixoncpp_reader_benchmark_many", ec);
+  }
+} // namespace
+
+static void BM_ReadEach(benchmark::State &state) {
+  FileReader reader;
+  for (auto _ : state) {
+    // Keep every result alive, as readMany() does
+    std::vector<Result<std::string, FileError>> results;
+    results.reserve(manyFiles.size());
+    for (const auto &path : manyFiles) {
+      results.push_back(reader.read(path));
+    }
+    benchmark::DoNotOptimize(results);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ReadEach)->Arg(512)->Setup(createManyFiles)->Teardown(removeManyFiles);
+
+static void BM_ReadMany(benchmark::State &state) {
+  FileReader reader;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(reader.readMany(manyFiles));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ReadMany)->Arg(512)->Setup(createManyFiles)->Teardown(removeManyFiles);
+
+static void BM_ReadManyAsync(benchmark::State &state) {
+  FileReader reader(UtilsFactory::createAsyncFileIO(UtilsFactory::createThreadPool()));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(reader.readMany(manyFiles));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ReadManyAsync)
+    ->Arg(512)
+    ->UseRealTime()
+    ->Setup(createManyFiles)
+    ->Teardown(removeManyFiles);
+
+static void BM_HashFiles(benchmark::State &state) {
+  FileHasher hasher;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(hasher.hashFiles(manyFiles, HashAlgorithm::Crc32c));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_HashFiles)->Arg(512)->Setup(createManyFiles)->Teardown(removeManyFiles);
+
+static void BM_HashFilesParallel(benchmark::State &state) {
+  FileHasher hasher(UtilsFactory::createThreadPool());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(hasher.hashFiles(manyFiles, HashAlgorithm::Crc32c));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_HashFilesParallel)
+    ->Arg(512)
+    ->UseRealTime()
+    ->Setup(createManyFiles)
+    ->Teardown(removeManyFiles);
+
+BENCHMARK_MAIN();
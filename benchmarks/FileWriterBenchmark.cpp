@@ -0,0 +1,182 @@
+#include <Utils/Filesystem/FileReader.hpp>
+#include <Utils/Filesystem/FileWriter.hpp>
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace nixoncpp::utils;
+namespace fs = std::filesystem;
+
+namespace {
+  fs::path benchmarkFile;
+
+  void createPath(const benchmark::State & /*state*/) {
+    benchmarkFile = fs::temp_directory_path() / "nixoncpp_writer_benchmark.txt";
+    std::error_code ec;
+    fs::remove(benchmarkFile, ec);
+  }
+
+  void removePath(const benchmark::State & /*state*/) {
+    std::error_code ec;
+    fs::remove(benchmarkFile, ec);
+  }
+
+  const std::string kRecord = "2026-01-01 12:00:00.000 [info] request handled in 42 us\n";
+} // namespace
+
+// Reopens and re-validates the file for every record
+static void BM_WriteAppend(benchmark::State &state) {
+  FileWriter writer;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(writer.write(benchmarkFile, kRecord, true));
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(kRecord.size()));
+}
+BENCHMARK(BM_WriteAppend)->Setup(createPath)->Teardown(removePath);
+
+// range(0) = appender buffer size (0 = one write per record)
+static void BM_Appender(benchmark::State &state) {
+  FileWriter writer;
+  auto appender = writer.openAppender(
+      benchmarkFile, AppenderOptions{.bufferSize = static_cast<std::size_t>(state.range(0))});
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(appender.value().append(kRecord));
+  }
+  (void)appender.value().flush();
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(kRecord.size()));
+}
+BENCHMARK(BM_Appender)
+    ->ArgName("buffer")
+    ->Arg(0)
+    ->Arg(4 << 10)
+    ->Arg(64 << 10)
+    ->Setup(createPath)
+    ->Teardown(removePath);
+
+namespace {
+  std::vector<std::string> makeLines(int64_t count) {
+    std::vector<std::string> lines;
+    lines.reserve(static_cast<std::size_t>(count));
+    for (int64_t i = 0; i < count; ++i) {
+      lines.emplace_back(kRecord.data(), kRecord.size() - 1);
+    }
+    return lines;
+  }
+} // namespace
+
+// Baseline: one stream insertion per line and per newline
+static void BM_WriteLinesStream(benchmark::State &state) {
+  const auto lines = makeLines(state.range(0));
+  for (auto _ : state) {
+    std::ofstream file(benchmarkFile);
+    for (const auto &line : lines) {
+      file << line << '\n';
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_WriteLinesStream)
+    ->ArgName("lines")
+    ->Arg(100)
+    ->Arg(10000)
+    ->Setup(createPath)
+    ->Teardown(removePath);
+
+static void BM_WriteLines(benchmark::State &state) {
+  FileWriter writer;
+  const auto lines = makeLines(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(writer.writeLines(benchmarkFile, lines));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_WriteLines)
+    ->ArgName("lines")
+    ->Arg(100)
+    ->Arg(10000)
+    ->Setup(createPath)
+    ->Teardown(removePath);
+
+namespace {
+  fs::path atomicTarget(const benchmark::State &state) {
+    return fs::temp_directory_path() /
+           ("nixoncpp_writer_atomic_" + std::to_string(state.thread_index()) + ".txt");
+  }
+} // namespace
+
+// One writer (and committer) per thread: every replacement pays for its own flush
+static void BM_WriteAtomicUnshared(benchmark::State &state) {
+  FileWriter writer;
+  const auto path = atomicTarget(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(writer.writeAtomic(path, kRecord));
+  }
+  std::error_code ec;
+  fs::remove(path, ec);
+}
+BENCHMARK(BM_WriteAtomicUnshared)->ThreadRange(1, 8)->UseRealTime();
+
+// One writer shared by all threads: concurrent replacements share one flush per batch
+static void BM_WriteAtomicShared(benchmark::State &state) {
+  static FileWriter writer;
+  const auto path = atomicTarget(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(writer.writeAtomic(path, kRecord));
+  }
+  std::error_code ec;
+  fs::remove(path, ec);
+}
+BENCHMARK(BM_WriteAtomicShared)->ThreadRange(1, 8)->UseRealTime();
+
+namespace {
+  fs::path copySource;
+
+  void createCopySource(const benchmark::State &state) {
+    copySource = fs::temp_directory_path() / "nixoncpp_copy_source.bin";
+    std::ofstream(copySource, std::ios::binary)
+        << std::string(static_cast<std::size_t>(state.range(0)), 'c');
+    createPath(state);
+  }
+
+  void removeCopySource(const benchmark::State &state) {
+    std::error_code ec;
+    fs::remove(copySource, ec);
+    removePath(state);
+  }
+} // namespace
+
+// Baseline: every byte goes through userspace twice
+static void BM_CopyReadWrite(benchmark::State &state) {
+  FileReader reader;
+  FileWriter writer;
+  for (auto _ : state) {
+    auto bytes = reader.readBytes(copySource);
+    benchmark::DoNotOptimize(writer.writeBytes(benchmarkFile, bytes.value()));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CopyReadWrite)
+    ->ArgName("bytes")
+    ->Arg(64 << 10)
+    ->Arg(16 << 20)
+    ->Setup(createCopySource)
+    ->Teardown(removeCopySource);
+
+static void BM_CopyFile(benchmark::State &state) {
+  FileWriter writer;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        writer.copyFile(copySource, benchmarkFile, CopyOptions{.overwrite = true}));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CopyFile)
+    ->ArgName("bytes")
+    ->Arg(64 << 10)
+    ->Arg(16 << 20)
+    ->Setup(createCopySource)
+    ->Teardown(removeCopySource);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,128 @@
+#include "../src/lib/Utils/Logger/ConsoleLogger.hpp"
+#include "../src/lib/Utils/Logger/NullLogger.hpp"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+
+using namespace nixoncpp::logging;
+
+// Run with --benchmark_format=json (or via `meson test --benchmark`, which also writes
+// LoggerBenchmark.json) to compare results across releases.
+
+namespace {
+  enum Target : std::int64_t { Console = 0, File = 1, Null = 2 };
+
+#ifdef _WIN32
+  constexpr const char *kNullDevice = "NUL";
+#else
+  constexpr const char *kNullDevice = "/dev/null";
+#endif
+
+  // Shared by all benchmark threads; created in setUp() before the threads start
+  std::shared_ptr<ILogger> logger;
+  std::ofstream nullStream;
+  std::streambuf *savedCout = nullptr;
+
+  std::filesystem::path logFilePath() {
+    return std::filesystem::temp_directory_path() / "nixoncpp_logger_benchmark.log";
+  }
+
+  /**
+   * @brief Create the logger for range(0) = target, range(1) = whether info is enabled
+   */
+  void setUp(const benchmark::State &state) {
+    const auto target = static_cast<Target>(state.range(0));
+    const bool enabled = state.range(1) != 0;
+
+    if (target == Null) {
+      logger = std::make_shared<NullLogger>();
+      return;
+    }
+
+    auto console = std::make_shared<ConsoleLogger>();
+    console->setColorEnabled(false);
+    console->setAppPrefix("Bench");
+    console->setLevel(enabled ? Level::LOG_INFO : Level::LOG_ERROR);
+
+    // Console output always goes to the null device so the terminal does not dominate timing
+    nullStream.open(kNullDevice);
+    savedCout = std::cout.rdbuf(nullStream.rdbuf());
+
+    if (target == File) {
+      std::filesystem::remove(logFilePath());
+      console->enableFileLogging(logFilePath().string());
+    }
+    logger = std::move(console);
+  }
+
+  void tearDown(const benchmark::State & /*state*/) {
+    logger.reset();
+    if (savedCout != nullptr) {
+      std::cout.rdbuf(savedCout);
+      savedCout = nullptr;
+      nullStream.close();
+    }
+    std::error_code ec;
+    std::filesystem::remove(logFilePath(), ec);
+  }
+
+  // ConsoleLogger writes every message whatever its level, so callers skip disabled ones
+  bool infoEnabled() {
+    return logger->getLevel() <= Level::LOG_INFO;
+  }
+
+  void applyArguments(benchmark::internal::Benchmark *bench) {
+    bench->ArgNames({"target", "enabled"})
+        ->ArgsProduct({{Console, File, Null}, {0, 1}})
+        ->ThreadRange(1, 8)
+        ->UseRealTime()
+        ->Setup(setUp)
+        ->Teardown(tearDown);
+  }
+} // namespace
+
+static void BM_Info(benchmark::State &state) {
+  for (auto _ : state) {
+    if (infoEnabled()) {
+      logger->info("Benchmark message with a typical length", "Bench");
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Info)->Apply(applyArguments);
+
+static void BM_InfoFmt(benchmark::State &state) {
+  int counter = 0;
+  for (auto _ : state) {
+    if (infoEnabled()) {
+      logger->infoFmt("Benchmark message {} of {:.2f}", ++counter, 3.14159);
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_InfoFmt)->Apply(applyArguments);
+
+static void BM_InfoStream(benchmark::State &state) {
+  int counter = 0;
+  for (auto _ : state) {
+    if (infoEnabled()) {
+      logger->infoStream("Bench") << "Benchmark message " << ++counter << " of " << 3.14159;
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_InfoStream)->Apply(applyArguments);
+
+static void BM_InfoWithLocation(benchmark::State &state) {
+  for (auto _ : state) {
+    if (infoEnabled()) {
+      logger->infoWithLocation("Benchmark message with a typical length");
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_InfoWithLocation)->Apply(applyArguments);
+
+BENCHMARK_MAIN();
@@ -83,6 +83,7 @@
             cxxopts
 
             gtest
+            gbenchmark
             ccache
           ];
 
@@ -1,7 +1,17 @@
 #include <NixonCppLib/NixonCppLib.hpp>
+#include <Utils/Logger/LogIndex.hpp>
+#include <Utils/Logger/ShmLogRing.hpp>
 #include <Utils/UtilsFactory.hpp>
+#include <atomic>
+#include <csignal>
 #include <cxxopts.hpp>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <optional>
+#include <sstream>
+#include <thread>
 
 #if defined(__EMSCRIPTEN__)
 #include <emscripten.h>
@@ -10,6 +20,153 @@
 const std::string appName = "NixonCpp";
 const std::string NA = "[Not Found]";
 
+namespace {
+  volatile std::sig_atomic_t stopRequested = 0;
+
+  void requestStop(int /*signal*/) { stopRequested = 1; }
+
+  /**
+   * @brief Drain a shared-memory log ring into one ordered file until interrupted
+   *
+   * @param ringName
+   * @param outputPath
+   * @return int Process exit code
+   */
+  int runCollector(const std::string &ringName, const std::string &outputPath) {
+    using namespace nixoncpp::logging;
+
+    auto ring = ShmLogRing::open(ringName);
+    if (!ring) {
+      std::cerr << "Cannot open log ring: " << ring.error().toString() << '\n';
+      return EXIT_FAILURE;
+    }
+
+    std::ofstream output(outputPath, std::ios::out | std::ios::app);
+    if (!output.is_open()) {
+      std::cerr << "Cannot open collector output: " << outputPath << '\n';
+      return EXIT_FAILURE;
+    }
+
+    std::signal(SIGINT, requestStop);
+    std::signal(SIGTERM, requestStop);
+    std::cout << "Collecting log ring '" << ringName << "' into " << outputPath
+              << " (Ctrl+C to stop)" << '\n';
+
+    std::uint64_t total = 0;
+    std::uint64_t lost = 0;
+    constexpr auto kIdleDelay = std::chrono::milliseconds(20);
+    for (;;) {
+      const bool stopping = stopRequested != 0;
+      auto stats = ring.value()->drain(
+          [&output](const ShmLogRecord &record) { output << record.line << '\n'; });
+      total += stats.records;
+      lost += stats.lost;
+      if (stats.records > 0) {
+        output.flush();
+      }
+      if (stopping) {
+        break;
+      }
+      if (stats.records == 0) {
+        std::this_thread::sleep_for(kIdleDelay);
+      }
+    }
+
+    std::cout << "Collected " << total << " records, lost " << lost << '\n';
+    return EXIT_SUCCESS;
+  }
+
+  /**
+   * @brief Parse a local "YYYY-mm-dd HH:MM:SS" timestamp as written in log headers
+   *
+   * @param text
+   * @return std::optional<std::chrono::system_clock::time_point>
+   */
+  std::optional<std::chrono::system_clock::time_point> parseLocalTime(const std::string &text) {
+    std::tm tm{};
+    std::istringstream input(text);
+    input >> std::get_time(&tm, "%Y-%m-%d %H:%M:%S");
+    if (input.fail()) {
+      return std::nullopt;
+    }
+    tm.tm_isdst = -1;
+    return std::chrono::system_clock::from_time_t(std::mktime(&tm));
+  }
+
+  /**
+   * @brief Parse a comma-separated level list such as "WRN,ERR" into a level mask
+   *
+   * @param text
+   * @return std::optional<std::uint32_t>
+   */
+  std::optional<std::uint32_t> parseLevels(const std::string &text) {
+    using namespace nixoncpp::logging;
+    if (text.empty()) {
+      return kAllLevels;
+    }
+    std::uint32_t mask = 0;
+    std::istringstream input(text);
+    std::string name;
+    while (std::getline(input, name, ',')) {
+      if (name == "DBG") {
+        mask |= levelBit(Level::LOG_DEBUG);
+      } else if (name == "INF") {
+        mask |= levelBit(Level::LOG_INFO);
+      } else if (name == "WRN") {
+        mask |= levelBit(Level::LOG_WARNING);
+      } else if (name == "ERR") {
+        mask |= levelBit(Level::LOG_ERROR);
+      } else if (name == "CRI") {
+        mask |= levelBit(Level::LOG_CRITICAL);
+      } else {
+        return std::nullopt;
+      }
+    }
+    return mask;
+  }
+
+  /**
+   * @brief Print the log lines matching a time window and levels using the sidecar index
+   *
+   * @param logPath
+   * @param from Empty for no lower bound
+   * @param to Empty for no upper bound
+   * @param levels
+   * @return int Process exit code
+   */
+  int runQuery(const std::string &logPath, const std::string &from, const std::string &to,
+               const std::string &levels) {
+    using namespace nixoncpp::logging;
+
+    LogQuery query;
+    const auto fromTime = from.empty() ? std::optional(query.from) : parseLocalTime(from);
+    const auto toTime = to.empty() ? std::optional(query.to) : parseLocalTime(to);
+    const auto levelMask = parseLevels(levels);
+    if (!fromTime || !toTime || !levelMask) {
+      std::cerr << "Invalid query: expected times as \"YYYY-mm-dd HH:MM:SS\" and levels as "
+                   "a list of DBG,INF,WRN,ERR,CRI"
+                << '\n';
+      return EXIT_FAILURE;
+    }
+    query.from = *fromTime;
+    // Header timestamps have second resolution; include the whole last second
+    query.to = to.empty() ? *toTime
+                          : *toTime + std::chrono::seconds(1) - std::chrono::nanoseconds(1);
+    query.levelMask = *levelMask;
+
+    auto stats = LogIndexReader::query(
+        logPath, query, [](std::string_view line) { std::cout << line << '\n'; });
+    if (!stats) {
+      std::cerr << "Query failed: " << stats.error().toString() << '\n';
+      return EXIT_FAILURE;
+    }
+    std::cerr << "Read " << stats.value().blocksRead << " of " << stats.value().blocksTotal
+              << " blocks and " << stats.value().unindexedBytes << " unindexed bytes ("
+              << stats.value().bytesRead << " bytes)" << '\n';
+    return EXIT_SUCCESS;
+  }
+} // namespace
+
 int main(int argc, char **argv) {
   using namespace nixoncpp;
   using namespace nixoncpp::logging;
@@ -21,6 +178,24 @@ int main(int argc, char **argv) {
     options.add_options()("h,help", "Print usage");
     options.add_options()("w,write2file", "Write output to file",
                           cxxopts::value<bool>()->default_value("false"));
+    options.add_options()("log-ring", "Also write log records into a shared-memory ring",
+                          cxxopts::value<std::string>()->default_value(""));
+    options.add_options()("log-socket", "Also send log records to a Unix datagram socket",
+                          cxxopts::value<std::string>()->default_value(""));
+    options.add_options()("log-index", "Write a sidecar index every N file records (0 = off)",
+                          cxxopts::value<std::uint32_t>()->default_value("0"));
+    options.add_options()("query-log", "Print lines of an indexed log file and exit",
+                          cxxopts::value<std::string>()->default_value(""));
+    options.add_options()("from", "Query start time (YYYY-mm-dd HH:MM:SS)",
+                          cxxopts::value<std::string>()->default_value(""));
+    options.add_options()("to", "Query end time (YYYY-mm-dd HH:MM:SS)",
+                          cxxopts::value<std::string>()->default_value(""));
+    options.add_options()("levels", "Query levels, e.g. WRN,ERR (default: all)",
+                          cxxopts::value<std::string>()->default_value(""));
+    options.add_options()("collect", "Collector mode: drain the named shared-memory log ring",
+                          cxxopts::value<std::string>()->default_value(""));
+    options.add_options()("collect-output", "Output file for collector mode",
+                          cxxopts::value<std::string>()->default_value("collected.log"));
     auto result = options.parse(argc, argv);
 
 #if !defined(__EMSCRIPTEN__)
@@ -32,13 +207,25 @@ int main(int argc, char **argv) {
       return EXIT_SUCCESS;
     }
 
+    if (const auto logPath = result["query-log"].as<std::string>(); !logPath.empty()) {
+      return runQuery(logPath, result["from"].as<std::string>(), result["to"].as<std::string>(),
+                      result["levels"].as<std::string>());
+    }
+
+    if (const auto ringName = result["collect"].as<std::string>(); !ringName.empty()) {
+      return runCollector(ringName, result["collect-output"].as<std::string>());
+    }
+
     // ---
     auto ctx = UtilsFactory::createFullContext(
         appName, LoggerConfig{.level = Level::LOG_INFO,
                               .enableFileLogging = result["write2file"].as<bool>(),
                               .logFilePath = "application.log",
                               .colorOutput = true,
-                              .appPrefix = appName});
+                              .appPrefix = appName,
+                              .sharedMemoryRing = result["log-ring"].as<std::string>(),
+                              .logSocketPath = result["log-socket"].as<std::string>(),
+                              .logIndexInterval = result["log-index"].as<std::uint32_t>()});
     // ---
     ctx.logger->infoStream()
         << appName << " (c) "
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace nixoncpp::utils {
+
+  /**
+   * @brief Immutable value published through an atomically swapped shared_ptr (RCU-style)
+   *
+   * Readers call load() and keep the returned snapshot for as long as they need it, without
+   * taking any lock. Writers copy the current value, modify the copy and publish it; writers
+   * are serialized among themselves so read-modify-write updates are never lost.
+   *
+   * @tparam T Snapshot type, must be copy-constructible
+   */
+  template <typename T>
+  class AtomicSnapshot {
+  public:
+    AtomicSnapshot() : current_(std::make_shared<const T>()) {}
+    explicit AtomicSnapshot(T initial) : current_(std::make_shared<const T>(std::move(initial))) {}
+
+    /**
+     * @brief Start from an existing snapshot, such as one loaded from another AtomicSnapshot
+     *
+     * @param snapshot Must not be null
+     */
+    explicit AtomicSnapshot(std::shared_ptr<const T> snapshot) noexcept
+        : current_(std::move(snapshot)) {}
+
+    AtomicSnapshot(const AtomicSnapshot &) = delete;
+    AtomicSnapshot &operator=(const AtomicSnapshot &) = delete;
+    AtomicSnapshot(AtomicSnapshot &&) = delete;
+    AtomicSnapshot &operator=(AtomicSnapshot &&) = delete;
+    ~AtomicSnapshot() = default;
+
+    /**
+     * @brief Get the current snapshot
+     *
+     * @return std::shared_ptr<const T> Never null
+     */
+    [[nodiscard]]
+    std::shared_ptr<const T> load() const noexcept {
+#if defined(__cpp_lib_atomic_shared_ptr)
+      return current_.load(std::memory_order_acquire);
+#else
+      return std::atomic_load_explicit(&current_, std::memory_order_acquire);
+#endif
+    }
+
+    /**
+     * @brief Replace the snapshot with a new value
+     *
+     * @param value
+     */
+    void store(T value) {
+      std::lock_guard<std::mutex> lock(writeMutex_);
+      publish(std::make_shared<const T>(std::move(value)));
+    }
+
+    /**
+     * @brief Publish an existing snapshot without copying or allocating
+     *
+     * @param snapshot Must not be null
+     */
+    void adopt(std::shared_ptr<const T> snapshot) {
+      std::lock_guard<std::mutex> lock(writeMutex_);
+      publish(std::move(snapshot));
+    }
+
+    /**
+     * @brief Copy the current snapshot, apply a mutation and publish the result
+     *
+     * @tparam Fn Callable taking T&
+     * @param mutate
+     */
+    template <typename Fn>
+    void update(Fn &&mutate) {
+      std::lock_guard<std::mutex> lock(writeMutex_);
+      T next = *load();
+      std::forward<Fn>(mutate)(next);
+      publish(std::make_shared<const T>(std::move(next)));
+    }
+
+  private:
+    void publish(std::shared_ptr<const T> next) noexcept {
+#if defined(__cpp_lib_atomic_shared_ptr)
+      current_.store(std::move(next), std::memory_order_release);
+#else
+      std::atomic_store_explicit(&current_, std::move(next), std::memory_order_release);
+#endif
+    }
+
+#if defined(__cpp_lib_atomic_shared_ptr)
+    std::atomic<std::shared_ptr<const T>> current_;
+#else
+    // Accessed only through the std::atomic_load/std::atomic_store overloads
+    std::shared_ptr<const T> current_;
+#endif
+    std::mutex writeMutex_;
+  };
+
+} // namespace nixoncpp::utils
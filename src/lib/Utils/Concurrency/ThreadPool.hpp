@@ -0,0 +1,88 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace nixoncpp::utils {
+
+  /**
+   * @brief Fixed-size pool of worker threads executing submitted tasks in FIFO order
+   *
+   * A pool with zero threads runs every task inline in submit(), which keeps callers working
+   * on targets without thread support (single-threaded WebAssembly).
+   *
+   * Tasks must not block waiting for other tasks of the same pool.
+   */
+  class ThreadPool final {
+  public:
+    /**
+     * @brief Start the worker threads
+     *
+     * @param threadCount Number of workers; defaultThreadCount() if omitted
+     */
+    explicit ThreadPool(std::size_t threadCount = defaultThreadCount());
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+    ThreadPool(ThreadPool &&) = delete;
+    ThreadPool &operator=(ThreadPool &&) = delete;
+
+    /**
+     * @brief Finish all queued tasks, then join the workers
+     */
+    ~ThreadPool();
+
+    /**
+     * @brief Queue a task
+     *
+     * @tparam Fn Callable without arguments
+     * @param task
+     * @return std::future of the task's result; exceptions are delivered through it
+     */
+    template <typename Fn>
+    [[nodiscard]]
+    std::future<std::invoke_result_t<std::decay_t<Fn>>> submit(Fn &&task) {
+      using R = std::invoke_result_t<std::decay_t<Fn>>;
+      auto packaged = std::make_shared<std::packaged_task<R()>>(std::forward<Fn>(task));
+      auto future = packaged->get_future();
+      enqueue([packaged] { (*packaged)(); });
+      return future;
+    }
+
+    /**
+     * @brief Number of worker threads (0 = tasks run inline)
+     *
+     * @return std::size_t
+     */
+    [[nodiscard]]
+    std::size_t threadCount() const noexcept {
+      return workers_.size();
+    }
+
+    /**
+     * @brief Hardware concurrency, at least 1; 0 on targets without threads
+     *
+     * @return std::size_t
+     */
+    [[nodiscard]]
+    static std::size_t defaultThreadCount() noexcept;
+
+  private:
+    void enqueue(std::function<void()> task);
+    void workerLoop();
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::deque<std::function<void()>> tasks_;
+    bool stopping_ = false;
+    std::vector<std::thread> workers_;
+  };
+
+} // namespace nixoncpp::utils
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <Utils/Concurrency/ThreadPool.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace nixoncpp::utils {
+
+  /**
+   * @brief Per-worker job deques for recursive work such as walking a tree
+   *
+   * Every worker takes jobs from the back of its own deque (depth first, which keeps few
+   * directories open in a tree walk) and, when that runs dry, steals from the front of another
+   * worker's (the oldest, usually largest subtrees). Jobs may push further jobs. Workers wait
+   * while others still run jobs that may produce more, and all of them return once no job is
+   * queued or running, or after stop(). A job that throws stops the others; runOn() rethrows
+   * the first exception once every worker has returned.
+   *
+   * @tparam Job Movable and default-constructible
+   */
+  template <typename Job>
+  class WorkStealingQueues final {
+  public:
+    explicit WorkStealingQueues(std::size_t workers) : queues_(workers) {}
+
+    WorkStealingQueues(const WorkStealingQueues &) = delete;
+    WorkStealingQueues &operator=(const WorkStealingQueues &) = delete;
+    WorkStealingQueues(WorkStealingQueues &&) = delete;
+    WorkStealingQueues &operator=(WorkStealingQueues &&) = delete;
+    ~WorkStealingQueues() = default;
+
+    [[nodiscard]]
+    std::size_t workers() const noexcept {
+      return queues_.size();
+    }
+
+    /**
+     * @brief Queue a job on a worker's deque
+     *
+     * @param worker Usually the worker calling push()
+     * @param job
+     */
+    void push(std::size_t worker, Job job) {
+      outstanding_.fetch_add(1);
+      {
+        const std::lock_guard lock(queues_[worker].mutex);
+        queues_[worker].jobs.push_back(std::move(job));
+      }
+      queued_.fetch_add(1);
+      wake(false);
+    }
+
+    /**
+     * @brief Make every worker return; jobs still queued are dropped unrun
+     */
+    void stop() {
+      stopped_.store(true);
+      wake(true);
+    }
+
+    [[nodiscard]]
+    bool stopped() const noexcept {
+      return stopped_.load();
+    }
+
+    /**
+     * @brief Run jobs as one worker until the work is done or stopped
+     *
+     * A job that throws stops every worker; the exception is kept for runOn().
+     *
+     * @param self Index of this worker, below workers()
+     * @param handle Called as handle(self, job)
+     */
+    template <typename Handler>
+    void run(std::size_t self, Handler &handle) {
+      Job job;
+      for (;;) {
+        if (!take(self, job)) {
+          std::unique_lock lock(idleMutex_);
+          sleepers_.fetch_add(1);
+          idle_.wait(lock, [this] {
+            return outstanding_.load() == 0 || stopped_.load() || queued_.load() > 0;
+          });
+          sleepers_.fetch_sub(1);
+          if (outstanding_.load() == 0 || stopped_.load()) {
+            return;
+          }
+          continue;
+        }
+        if (!stopped_.load()) {
+          try {
+            handle(self, job);
+          } catch (...) {
+            fail(std::current_exception());
+          }
+        }
+        job = Job{};
+        if (outstanding_.fetch_sub(1) == 1) {
+          wake(true);
+        }
+      }
+    }
+
+    /**
+     * @brief Run worker 0 on the calling thread and the others on the pool, until done
+     *
+     * The calling thread takes part, so a busy or threadless pool only reduces the
+     * parallelism.
+     *
+     * @param pool Needed when workers() > 1; must not be the pool the caller runs on
+     * @param handle Called as handle(worker, job), from several threads at once
+     * @throws The first exception thrown by a job, after every worker has returned
+     */
+    template <typename Handler>
+    void runOn(ThreadPool *pool, Handler &handle) {
+      std::vector<std::future<void>> helpers;
+      try {
+        helpers.reserve(queues_.size() - 1);
+        for (std::size_t worker = 1; worker < queues_.size(); ++worker) {
+          helpers.push_back(pool->submit([this, &handle, worker] { run(worker, handle); }));
+        }
+        run(0, handle);
+      } catch (...) {
+        fail(std::current_exception());
+      }
+      // The helpers reference handle and this object: wait for all of them before leaving
+      for (auto &helper : helpers) {
+        try {
+          helper.get();
+        } catch (...) {
+          fail(std::current_exception());
+        }
+      }
+      if (failure_) {
+        std::rethrow_exception(failure_);
+      }
+    }
+
+  private:
+    struct Queue {
+      std::mutex mutex;
+      std::deque<Job> jobs;
+    };
+
+    bool take(std::size_t self, Job &job) {
+      for (std::size_t step = 0; step < queues_.size(); ++step) {
+        auto &queue = queues_[(self + step) % queues_.size()];
+        const std::lock_guard lock(queue.mutex);
+        if (queue.jobs.empty()) {
+          continue;
+        }
+        if (step == 0) {
+          job = std::move(queue.jobs.back());
+          queue.jobs.pop_back();
+        } else {
+          job = std::move(queue.jobs.front());
+          queue.jobs.pop_front();
+        }
+        queued_.fetch_sub(1);
+        return true;
+      }
+      return false;
+    }
+
+    void fail(std::exception_ptr error) {
+      {
+        const std::lock_guard lock(failureMutex_);
+        if (!failure_) {
+          failure_ = std::move(error);
+        }
+      }
+      stop();
+    }
+
+    void wake(bool all) {
+      if (sleepers_.load() == 0) {
+        return;
+      }
+      { const std::lock_guard lock(idleMutex_); }
+      if (all) {
+        idle_.notify_all();
+      } else {
+        idle_.notify_one();
+      }
+    }
+
+    std::vector<Queue> queues_;
+    std::atomic<std::size_t> outstanding_{0}; // Queued or running
+    std::atomic<std::size_t> queued_{0};
+    std::atomic<std::size_t> sleepers_{0};
+    std::atomic<bool> stopped_{false};
+    std::mutex idleMutex_;
+    std::condition_variable idle_;
+    std::mutex failureMutex_;
+    std::exception_ptr failure_; // First exception thrown by a job
+  };
+
+} // namespace nixoncpp::utils
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+
+namespace nixoncpp::utils {
+
+  /**
+   * @brief Expected access pattern of a file
+   *
+   * Forwarded to madvise() for mappings and to posix_fadvise() for reads and writes.
+   */
+  enum class AccessPattern : std::uint8_t { Normal, Sequential, Random, WillNeed, DontNeed };
+
+} // namespace nixoncpp::utils
@@ -0,0 +1,271 @@
+#include "CachingFileReader.hpp"
+#include <Utils/Filesystem/PosixIo.hpp>
+#include <algorithm>
+#include <chrono>
+#include <system_error>
+#include <utility>
+
+namespace nixoncpp::utils {
+
+  CachingFileReader::CachingFileReader(std::shared_ptr<IFileReader> inner,
+                                       std::size_t capacityBytes)
+      : inner_(std::move(inner)), capacityBytes_(capacityBytes) {}
+
+  std::optional<CachingFileReader::Stamp>
+      CachingFileReader::stampOf(const std::filesystem::path &filePath) {
+#if defined(NIXONCPP_HAS_POSIX_IO) && defined(STATX_INO)
+    struct statx info{};
+    if (::statx(AT_FDCWD, filePath.c_str(), 0, STATX_INO | STATX_SIZE | STATX_MTIME, &info) !=
+        0) {
+      return std::nullopt;
+    }
+    return Stamp{
+        .device = (static_cast<std::uint64_t>(info.stx_dev_major) << 32) | info.stx_dev_minor,
+        .inode = info.stx_ino,
+        .size = info.stx_size,
+        .mtimeNs = static_cast<std::int64_t>(info.stx_mtime.tv_sec) * 1'000'000'000 +
+                   info.stx_mtime.tv_nsec,
+    };
+#elif defined(NIXONCPP_HAS_POSIX_IO)
+    struct stat info{};
+    if (::stat(filePath.c_str(), &info) != 0) {
+      return std::nullopt;
+    }
+#if defined(__APPLE__)
+    const auto &mtime = info.st_mtimespec;
+#else
+    const auto &mtime = info.st_mtim;
+#endif
+    return Stamp{
+        .device = static_cast<std::uint64_t>(info.st_dev),
+        .inode = static_cast<std::uint64_t>(info.st_ino),
+        .size = static_cast<std::uint64_t>(info.st_size),
+        .mtimeNs = static_cast<std::int64_t>(mtime.tv_sec) * 1'000'000'000 + mtime.tv_nsec,
+    };
+#else
+    std::error_code ec;
+    const auto size = std::filesystem::file_size(filePath, ec);
+    if (ec) {
+      return std::nullopt;
+    }
+    const auto mtime = std::filesystem::last_write_time(filePath, ec);
+    if (ec) {
+      return std::nullopt;
+    }
+    return Stamp{
+        .size = static_cast<std::uint64_t>(size),
+        .mtimeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       mtime.time_since_epoch())
+                       .count(),
+    };
+#endif
+  }
+
+  std::shared_ptr<const std::string>
+      CachingFileReader::lookup(const Key &key, const std::optional<Stamp> &stamp) const {
+    std::lock_guard lock(mutex_);
+    if (auto found = index_.find(key); found != index_.end()) {
+      if (stamp && found->second->stamp == *stamp) {
+        entries_.splice(entries_.begin(), entries_, found->second);
+        ++stats_.hits;
+        return found->second->content;
+      }
+      eraseLocked(found->second);
+    }
+    ++stats_.misses;
+    return nullptr;
+  }
+
+  std::shared_ptr<const std::string>
+      CachingFileReader::store(const Key &key, const std::optional<Stamp> &stamp,
+                               std::string content) const {
+    auto shared = std::make_shared<const std::string>(std::move(content));
+    if (!stamp || shared->size() > capacityBytes_) {
+      return shared;
+    }
+
+    std::lock_guard lock(mutex_);
+    // A concurrent miss on the same path may have stored first; the newest read wins
+    if (auto found = index_.find(key); found != index_.end()) {
+      eraseLocked(found->second);
+    }
+    entries_.push_front(Entry{.key = key, .stamp = *stamp, .content = shared});
+    index_.emplace(key, entries_.begin());
+    bytes_ += shared->size();
+    while (bytes_ > capacityBytes_) {
+      eraseLocked(std::prev(entries_.end()));
+      ++stats_.evictions;
+    }
+    return shared;
+  }
+
+  void CachingFileReader::eraseLocked(std::list<Entry>::iterator entry) const {
+    bytes_ -= entry->content->size();
+    index_.erase(entry->key);
+    entries_.erase(entry);
+  }
+
+  Result<std::shared_ptr<const std::string>, FileError>
+      CachingFileReader::readShared(const std::filesystem::path &filePath,
+                                    const ReadOptions &options) const {
+    // Stamp before reading: a write racing with the read invalidates the entry next time
+    const auto stamp = stampOf(filePath);
+    if (auto cached = lookup(filePath.native(), stamp)) {
+      return cached;
+    }
+
+    auto content = inner_->read(filePath, options);
+    if (!content) {
+      return content.error();
+    }
+    return store(filePath.native(), stamp, std::move(content.value()));
+  }
+
+  Result<std::string, FileError>
+      CachingFileReader::read(const std::filesystem::path &filePath) const {
+    return read(filePath, ReadOptions{});
+  }
+
+  Result<std::vector<uint8_t>, FileError>
+      CachingFileReader::readBytes(const std::filesystem::path &filePath) const {
+    return readBytes(filePath, ReadOptions{});
+  }
+
+  Result<std::string, FileError> CachingFileReader::read(const std::filesystem::path &filePath,
+                                                         const ReadOptions &options) const {
+    auto content = readShared(filePath, options);
+    if (!content) {
+      return content.error();
+    }
+    return *content.value();
+  }
+
+  Result<std::vector<uint8_t>, FileError>
+      CachingFileReader::readBytes(const std::filesystem::path &filePath,
+                                   const ReadOptions &options) const {
+    auto content = readShared(filePath, options);
+    if (!content) {
+      return content.error();
+    }
+    const auto &text = *content.value();
+    return std::vector<uint8_t>(text.begin(), text.end());
+  }
+
+  Result<std::vector<std::string>, FileError>
+      CachingFileReader::readLines(const std::filesystem::path &filePath) const {
+    auto content = readShared(filePath);
+    if (!content) {
+      return content.error();
+    }
+
+    // Same splitting as std::getline: no empty entry after a final newline
+    std::vector<std::string> lines;
+    std::string_view rest = *content.value();
+    while (!rest.empty()) {
+      const auto end = rest.find('\n');
+      lines.emplace_back(rest.substr(0, end));
+      if (end == std::string_view::npos) {
+        break;
+      }
+      rest.remove_prefix(end + 1);
+    }
+    return lines;
+  }
+
+  Result<std::size_t, FileError>
+      CachingFileReader::readInto(const std::filesystem::path &filePath,
+                                  std::span<std::byte> destination, std::uint64_t offset) const {
+    return inner_->readInto(filePath, destination, offset);
+  }
+
+  Result<std::vector<uint8_t>, FileError>
+      CachingFileReader::readRange(const std::filesystem::path &filePath, std::uint64_t offset,
+                                   std::size_t length) const {
+    return inner_->readRange(filePath, offset, length);
+  }
+
+  std::vector<Result<std::string, FileError>>
+      CachingFileReader::readMany(std::span<const std::filesystem::path> filePaths) const {
+    std::vector<std::optional<Result<std::string, FileError>>> slots(filePaths.size());
+    std::vector<std::optional<Stamp>> stamps(filePaths.size());
+    std::vector<std::size_t> missing;
+    std::vector<std::filesystem::path> missingPaths;
+    for (std::size_t i = 0; i < filePaths.size(); ++i) {
+      stamps[i] = stampOf(filePaths[i]);
+      if (auto cached = lookup(filePaths[i].native(), stamps[i])) {
+        slots[i].emplace(*cached);
+      } else {
+        missing.push_back(i);
+        missingPaths.push_back(filePaths[i]);
+      }
+    }
+
+    // Misses go to the wrapped reader in one batch so it can order and overlap them
+    auto loaded = inner_->readMany(missingPaths);
+    for (std::size_t j = 0; j < missing.size(); ++j) {
+      const auto index = missing[j];
+      if (loaded[j]) {
+        const auto &key = filePaths[index].native();
+        slots[index].emplace(*store(key, stamps[index], std::move(loaded[j].value())));
+      } else {
+        slots[index].emplace(loaded[j].error());
+      }
+    }
+
+    std::vector<Result<std::string, FileError>> results;
+    results.reserve(filePaths.size());
+    for (auto &slot : slots) {
+      results.push_back(std::move(*slot));
+    }
+    return results;
+  }
+
+  Result<LineReader, FileError> CachingFileReader::lines(const std::filesystem::path &filePath,
+                                                         std::size_t chunkSize) const {
+    return inner_->lines(filePath, chunkSize);
+  }
+
+  Result<MappedFile, FileError> CachingFileReader::map(const std::filesystem::path &filePath,
+                                                       AccessPattern pattern) const {
+    return inner_->map(filePath, pattern);
+  }
+
+  bool CachingFileReader::exists(const std::filesystem::path &filePath) const {
+    return inner_->exists(filePath);
+  }
+
+  Result<std::uintmax_t, FileError>
+      CachingFileReader::getSize(const std::filesystem::path &filePath) const {
+    return inner_->getSize(filePath);
+  }
+
+  void CachingFileReader::invalidate(const std::filesystem::path &filePath) {
+    std::lock_guard lock(mutex_);
+    if (auto found = index_.find(filePath.native()); found != index_.end()) {
+      eraseLocked(found->second);
+    }
+  }
+
+  void CachingFileReader::clear() {
+    std::lock_guard lock(mutex_);
+    index_.clear();
+    entries_.clear();
+    bytes_ = 0;
+  }
+
+  std::size_t CachingFileReader::size() const {
+    std::lock_guard lock(mutex_);
+    return entries_.size();
+  }
+
+  std::size_t CachingFileReader::sizeBytes() const {
+    std::lock_guard lock(mutex_);
+    return bytes_;
+  }
+
+  CachingFileReaderStats CachingFileReader::stats() const {
+    std::lock_guard lock(mutex_);
+    return stats_;
+  }
+
+} // namespace nixoncpp::utils
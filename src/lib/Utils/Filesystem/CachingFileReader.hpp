@@ -0,0 +1,199 @@
+#pragma once
+
+#include <Utils/Filesystem/IFileReader.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace nixoncpp::utils {
+
+  /**
+   * @brief Hit/miss counters of a CachingFileReader
+   */
+  struct CachingFileReaderStats {
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0; // Includes entries found stale on revalidation
+    std::uint64_t evictions = 0;
+  };
+
+  /**
+   * @brief IFileReader decorator keeping whole-file contents in a byte-budgeted LRU
+   *
+   * Every lookup revalidates the cached entry with one stat (statx on Linux) and compares
+   * device, inode, size and modification time, so replaced and rewritten files are picked up.
+   * The stamp is taken before the file is read: a file modified while being read is simply
+   * read again on the next lookup. Changes that keep size, inode and mtime identical (within
+   * the filesystem's timestamp granularity) are not detected.
+   *
+   * Contents are stored as shared immutable buffers: readShared() hands them out without
+   * copying, read()/readBytes()/readLines() copy from them. Ranged, streaming and mapped
+   * access (readInto, readRange, lines, map) goes straight to the wrapped reader. Errors are
+   * never cached. Thread-safe.
+   */
+  class CachingFileReader final : public IFileReader {
+  public:
+    static constexpr std::size_t kDefaultCapacityBytes = 64 * 1024 * 1024;
+
+    /**
+     * @brief Wrap a reader
+     *
+     * @param inner Reader used on cache misses
+     * @param capacityBytes Total size of cached contents; larger files are never cached
+     */
+    explicit CachingFileReader(std::shared_ptr<IFileReader> inner,
+                               std::size_t capacityBytes = kDefaultCapacityBytes);
+    CachingFileReader(const CachingFileReader &) = delete;
+    CachingFileReader &operator=(const CachingFileReader &) = delete;
+    CachingFileReader(CachingFileReader &&) = delete;
+    CachingFileReader &operator=(CachingFileReader &&) = delete;
+    ~CachingFileReader() override = default;
+
+    /**
+     * @brief Content of a file as a shared buffer, read from disk only when it changed
+     *
+     * @param filePath
+     * @param options Forwarded to the wrapped reader on a miss
+     * @return Result<std::shared_ptr<const std::string>, FileError>
+     */
+    [[nodiscard]]
+    Result<std::shared_ptr<const std::string>, FileError>
+        readShared(const std::filesystem::path &filePath,
+                   const ReadOptions &options = ReadOptions{}) const;
+
+    [[nodiscard]]
+    Result<std::string, FileError> read(const std::filesystem::path &filePath) const override;
+
+    [[nodiscard]]
+    Result<std::vector<uint8_t>, FileError>
+        readBytes(const std::filesystem::path &filePath) const override;
+
+    [[nodiscard]]
+    Result<std::string, FileError> read(const std::filesystem::path &filePath,
+                                        const ReadOptions &options) const override;
+
+    [[nodiscard]]
+    Result<std::vector<uint8_t>, FileError>
+        readBytes(const std::filesystem::path &filePath, const ReadOptions &options) const override;
+
+    [[nodiscard]]
+    Result<std::vector<std::string>, FileError>
+        readLines(const std::filesystem::path &filePath) const override;
+
+    [[nodiscard]]
+    Result<std::size_t, FileError> readInto(const std::filesystem::path &filePath,
+                                            std::span<std::byte> destination,
+                                            std::uint64_t offset = 0) const override;
+
+    [[nodiscard]]
+    Result<std::vector<uint8_t>, FileError> readRange(const std::filesystem::path &filePath,
+                                                      std::uint64_t offset,
+                                                      std::size_t length) const override;
+
+    [[nodiscard]]
+    std::vector<Result<std::string, FileError>>
+        readMany(std::span<const std::filesystem::path> filePaths) const override;
+
+    [[nodiscard]]
+    Result<LineReader, FileError>
+        lines(const std::filesystem::path &filePath,
+              std::size_t chunkSize = LineReader::kDefaultChunkSize) const override;
+
+    [[nodiscard]]
+    Result<MappedFile, FileError>
+        map(const std::filesystem::path &filePath,
+            AccessPattern pattern = AccessPattern::Sequential) const override;
+
+    [[nodiscard]]
+    bool exists(const std::filesystem::path &filePath) const override;
+
+    [[nodiscard]]
+    Result<std::uintmax_t, FileError> getSize(const std::filesystem::path &filePath) const override;
+
+    /**
+     * @brief Drop the cached content of a file, if any
+     *
+     * @param filePath
+     */
+    void invalidate(const std::filesystem::path &filePath);
+
+    /**
+     * @brief Drop all cached contents
+     *
+     */
+    void clear();
+
+    /**
+     * @brief Number of cached files
+     *
+     * @return std::size_t
+     */
+    [[nodiscard]]
+    std::size_t size() const;
+
+    /**
+     * @brief Total size of the cached contents in bytes
+     *
+     * @return std::size_t
+     */
+    [[nodiscard]]
+    std::size_t sizeBytes() const;
+
+    /**
+     * @brief Snapshot of the counters
+     *
+     * @return CachingFileReaderStats
+     */
+    [[nodiscard]]
+    CachingFileReaderStats stats() const;
+
+  private:
+    /**
+     * @brief Identity and version of a file's content as reported by stat
+     */
+    struct Stamp {
+      std::uint64_t device = 0;
+      std::uint64_t inode = 0;
+      std::uint64_t size = 0;
+      std::int64_t mtimeNs = 0;
+
+      bool operator==(const Stamp &) const = default;
+    };
+
+    using Key = std::filesystem::path::string_type;
+    struct Entry {
+      Key key;
+      Stamp stamp;
+      std::shared_ptr<const std::string> content;
+    };
+
+    [[nodiscard]]
+    static std::optional<Stamp> stampOf(const std::filesystem::path &filePath);
+
+    /**
+     * @brief Cached content if still valid; counts a hit or a miss and drops stale entries
+     */
+    [[nodiscard]]
+    std::shared_ptr<const std::string> lookup(const Key &key,
+                                              const std::optional<Stamp> &stamp) const;
+
+    std::shared_ptr<const std::string> store(const Key &key, const std::optional<Stamp> &stamp,
+                                             std::string content) const;
+
+    void eraseLocked(std::list<Entry>::iterator entry) const;
+
+    std::shared_ptr<IFileReader> inner_;
+    std::size_t capacityBytes_;
+    mutable std::mutex mutex_;
+    mutable std::list<Entry> entries_; // Most recently used first
+    mutable std::unordered_map<Key, std::list<Entry>::iterator> index_;
+    mutable std::size_t bytes_ = 0;
+    mutable CachingFileReaderStats stats_;
+  };
+
+} // namespace nixoncpp::utils
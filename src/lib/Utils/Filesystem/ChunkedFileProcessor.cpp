@@ -0,0 +1,25 @@
+#include "ChunkedFileProcessor.hpp"
+#include <Utils/String/NewlineScanner.hpp>
+#include <algorithm>
+
+namespace nixoncpp::utils {
+
+  std::vector<std::string_view> splitLineAligned(std::string_view text, std::size_t chunkSize) {
+    std::vector<std::string_view> chunks;
+    chunkSize = std::max<std::size_t>(chunkSize, 1);
+    chunks.reserve(text.size() / chunkSize + 1);
+
+    const char *const end = text.data() + text.size();
+    const char *begin = text.data();
+    while (begin < end) {
+      const char *target = begin + std::min(chunkSize, static_cast<std::size_t>(end - begin));
+      // Extend the chunk to include the line that crosses the target boundary
+      const char *newline = findNewline(target - 1, end);
+      const char *chunkEnd = newline == end ? end : newline + 1;
+      chunks.emplace_back(begin, static_cast<std::size_t>(chunkEnd - begin));
+      begin = chunkEnd;
+    }
+    return chunks;
+  }
+
+} // namespace nixoncpp::utils
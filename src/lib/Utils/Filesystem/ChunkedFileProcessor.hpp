@@ -0,0 +1,150 @@
+#pragma once
+
+#include <Utils/Concurrency/ThreadPool.hpp>
+#include <Utils/Filesystem/IFileReader.hpp>
+#include <Utils/UtilsError.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace nixoncpp::utils {
+
+  /**
+   * @brief Order in which per-chunk results are handed to the reduce function
+   */
+  enum class ResultOrder : std::uint8_t {
+    Ordered,  // File order; reduce runs on the calling thread
+    Unordered // Completion order; reduce runs on the workers, serialized by a mutex
+  };
+
+  /**
+   * @brief Options for ChunkedFileProcessor::process()
+   */
+  struct ChunkOptions {
+    std::size_t chunkSize = 4 * 1024 * 1024; // Target bytes per chunk
+    ResultOrder order = ResultOrder::Ordered;
+  };
+
+  /**
+   * @brief Split text into consecutive chunks of about chunkSize bytes, each ending after '\n'
+   *
+   * Only the last chunk may lack a trailing newline. A line longer than chunkSize makes its
+   * chunk correspondingly larger; lines are never split.
+   *
+   * @param text
+   * @param chunkSize
+   * @return std::vector<std::string_view> Views into text
+   */
+  [[nodiscard]]
+  std::vector<std::string_view> splitLineAligned(std::string_view text, std::size_t chunkSize);
+
+  /**
+   * @brief Map/reduce over newline-aligned chunks of a memory-mapped file
+   *
+   * The file is mapped once through the injected IFileReader, split with splitLineAligned()
+   * and every chunk is passed to the map function on the thread pool. Nothing is copied; the
+   * chunk views stay valid for the duration of process().
+   */
+  class ChunkedFileProcessor final {
+  public:
+    ChunkedFileProcessor(std::shared_ptr<IFileReader> fileReader, std::shared_ptr<ThreadPool> pool)
+        : fileReader_(std::move(fileReader)), pool_(std::move(pool)) {}
+
+    ChunkedFileProcessor(const ChunkedFileProcessor &) = delete;
+    ChunkedFileProcessor &operator=(const ChunkedFileProcessor &) = delete;
+    ChunkedFileProcessor(ChunkedFileProcessor &&) = delete;
+    ChunkedFileProcessor &operator=(ChunkedFileProcessor &&) = delete;
+    ~ChunkedFileProcessor() = default;
+
+    /**
+     * @brief Run map on every chunk and fold the results with reduce
+     *
+     * map is called concurrently and must be thread-safe. An exception thrown by map or reduce
+     * is rethrown after all submitted chunks have finished. Must not be called from a task of
+     * the same pool.
+     *
+     * @tparam Acc Accumulator type
+     * @tparam MapFn Part(std::string_view chunk)
+     * @tparam ReduceFn Acc(Acc, Part)
+     * @param filePath
+     * @param init Initial accumulator
+     * @param map
+     * @param reduce
+     * @param options
+     * @return Result<Acc, FileError> Error only if the file cannot be mapped
+     */
+    template <typename Acc, typename MapFn, typename ReduceFn>
+    [[nodiscard]]
+    Result<Acc, FileError> process(const std::filesystem::path &filePath, Acc init, MapFn map,
+                                   ReduceFn reduce, const ChunkOptions &options = {}) const {
+      auto mapped = fileReader_->map(filePath, AccessPattern::Sequential);
+      if (!mapped) {
+        return mapped.error();
+      }
+      const auto chunks = splitLineAligned(mapped.value().view(), options.chunkSize);
+
+      Acc accumulator = std::move(init);
+      std::exception_ptr failure;
+
+      if (options.order == ResultOrder::Ordered) {
+        using Part = std::invoke_result_t<MapFn &, std::string_view>;
+        std::vector<std::future<Part>> parts;
+        parts.reserve(chunks.size());
+        for (const auto chunk : chunks) {
+          parts.push_back(pool_->submit([&map, chunk] { return map(chunk); }));
+        }
+        // Consume in file order; keep waiting after a failure so no task outlives this frame
+        for (auto &part : parts) {
+          try {
+            auto value = part.get();
+            if (!failure) {
+              accumulator = reduce(std::move(accumulator), std::move(value));
+            }
+          } catch (...) {
+            if (!failure) {
+              failure = std::current_exception();
+            }
+          }
+        }
+      } else {
+        std::mutex reduceMutex;
+        std::vector<std::future<void>> done;
+        done.reserve(chunks.size());
+        for (const auto chunk : chunks) {
+          done.push_back(pool_->submit([&, chunk] {
+            auto value = map(chunk);
+            std::lock_guard<std::mutex> lock(reduceMutex);
+            accumulator = reduce(std::move(accumulator), std::move(value));
+          }));
+        }
+        for (auto &task : done) {
+          try {
+            task.get();
+          } catch (...) {
+            if (!failure) {
+              failure = std::current_exception();
+            }
+          }
+        }
+      }
+
+      if (failure) {
+        std::rethrow_exception(failure);
+      }
+      return accumulator;
+    }
+
+  private:
+    std::shared_ptr<IFileReader> fileReader_;
+    std::shared_ptr<ThreadPool> pool_;
+  };
+
+} // namespace nixoncpp::utils
@@ -0,0 +1,142 @@
+#include "CompressedFileReader.hpp"
+#include <utility>
+
+namespace nixoncpp::utils {
+
+  CompressedFileReader::CompressedFileReader(std::shared_ptr<IFileReader> inner)
+      : inner_(std::move(inner)) {}
+
+  Result<std::optional<std::string>, FileError>
+      CompressedFileReader::decode(const std::filesystem::path &filePath) {
+    auto format = detectCompression(filePath);
+    if (!format) {
+      return format.error();
+    }
+    if (format.value() == CompressionFormat::None) {
+      return std::optional<std::string>{};
+    }
+    auto decoder = DecompressingReader::open(filePath);
+    if (!decoder) {
+      return decoder.error();
+    }
+    auto content = decoder.value().readAll();
+    if (!content) {
+      return content.error();
+    }
+    return std::optional<std::string>(std::move(content.value()));
+  }
+
+  Result<std::string, FileError>
+      CompressedFileReader::read(const std::filesystem::path &filePath) const {
+    return read(filePath, ReadOptions{});
+  }
+
+  Result<std::vector<uint8_t>, FileError>
+      CompressedFileReader::readBytes(const std::filesystem::path &filePath) const {
+    return readBytes(filePath, ReadOptions{});
+  }
+
+  Result<std::string, FileError> CompressedFileReader::read(const std::filesystem::path &filePath,
+                                                            const ReadOptions &options) const {
+    auto decoded = decode(filePath);
+    if (!decoded) {
+      return decoded.error();
+    }
+    if (!decoded.value()) {
+      return inner_->read(filePath, options);
+    }
+    return std::move(*decoded.value());
+  }
+
+  Result<std::vector<uint8_t>, FileError>
+      CompressedFileReader::readBytes(const std::filesystem::path &filePath,
+                                      const ReadOptions &options) const {
+    auto decoded = decode(filePath);
+    if (!decoded) {
+      return decoded.error();
+    }
+    if (!decoded.value()) {
+      return inner_->readBytes(filePath, options);
+    }
+    const auto &content = *decoded.value();
+    return std::vector<uint8_t>(content.begin(), content.end());
+  }
+
+  Result<std::vector<std::string>, FileError>
+      CompressedFileReader::readLines(const std::filesystem::path &filePath) const {
+    auto decoded = decode(filePath);
+    if (!decoded) {
+      return decoded.error();
+    }
+    if (!decoded.value()) {
+      return inner_->readLines(filePath);
+    }
+
+    // Same splitting as std::getline: no empty entry after a final newline
+    std::vector<std::string> lines;
+    std::string_view rest = *decoded.value();
+    while (!rest.empty()) {
+      const auto end = rest.find('\n');
+      lines.emplace_back(rest.substr(0, end));
+      if (end == std::string_view::npos) {
+        break;
+      }
+      rest.remove_prefix(end + 1);
+    }
+    return lines;
+  }
+
+  Result<std::size_t, FileError>
+      CompressedFileReader::readInto(const std::filesystem::path &filePath,
+                                     std::span<std::byte> destination,
+                                     std::uint64_t offset) const {
+    return inner_->readInto(filePath, destination, offset);
+  }
+
+  Result<std::vector<uint8_t>, FileError>
+      CompressedFileReader::readRange(const std::filesystem::path &filePath, std::uint64_t offset,
+                                      std::size_t length) const {
+    return inner_->readRange(filePath, offset, length);
+  }
+
+  std::vector<Result<std::string, FileError>>
+      CompressedFileReader::readMany(std::span<const std::filesystem::path> filePaths) const {
+    std::vector<Result<std::string, FileError>> results;
+    results.reserve(filePaths.size());
+    for (const auto &filePath : filePaths) {
+      results.push_back(read(filePath));
+    }
+    return results;
+  }
+
+  Result<LineReader, FileError> CompressedFileReader::lines(const std::filesystem::path &filePath,
+                                                            std::size_t chunkSize) const {
+    auto format = detectCompression(filePath);
+    if (!format) {
+      return format.error();
+    }
+    if (format.value() == CompressionFormat::None) {
+      return inner_->lines(filePath, chunkSize);
+    }
+    auto decoder = DecompressingReader::open(filePath);
+    if (!decoder) {
+      return decoder.error();
+    }
+    return LineReader::decompressing(std::move(decoder.value()), chunkSize);
+  }
+
+  Result<MappedFile, FileError> CompressedFileReader::map(const std::filesystem::path &filePath,
+                                                          AccessPattern pattern) const {
+    return inner_->map(filePath, pattern);
+  }
+
+  bool CompressedFileReader::exists(const std::filesystem::path &filePath) const {
+    return inner_->exists(filePath);
+  }
+
+  Result<std::uintmax_t, FileError>
+      CompressedFileReader::getSize(const std::filesystem::path &filePath) const {
+    return inner_->getSize(filePath);
+  }
+
+} // namespace nixoncpp::utils
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <Utils/Filesystem/Compression.hpp>
+#include <Utils/Filesystem/IFileReader.hpp>
+#include <memory>
+
+namespace nixoncpp::utils {
+
+  /**
+   * @brief IFileReader decorator decoding gzip and zstd files on the fly
+   *
+   * The format is detected from the magic bytes, not the file name. read(), readBytes(),
+   * readLines(), readMany() and lines() return the decoded content; lines() streams it in
+   * bounded memory. Plain files are passed to the wrapped reader unchanged. Ranged and mapped
+   * access (readInto, readRange, map) and getSize() refer to the bytes on disk.
+   */
+  class CompressedFileReader final : public IFileReader {
+  public:
+    /**
+     * @brief Wrap a reader
+     *
+     * @param inner Reader used for plain files and raw access
+     */
+    explicit CompressedFileReader(std::shared_ptr<IFileReader> inner);
+    CompressedFileReader(const CompressedFileReader &) = delete;
+    CompressedFileReader &operator=(const CompressedFileReader &) = delete;
+    CompressedFileReader(CompressedFileReader &&) = delete;
+    CompressedFileReader &operator=(CompressedFileReader &&) = delete;
+    ~CompressedFileReader() override = default;
+
+    [[nodiscard]]
+    Result<std::string, FileError> read(const std::filesystem::path &filePath) const override;
+
+    [[nodiscard]]
+    Result<std::vector<uint8_t>, FileError>
+        readBytes(const std::filesystem::path &filePath) const override;
+
+    [[nodiscard]]
+    Result<std::string, FileError> read(const std::filesystem::path &filePath,
+                                        const ReadOptions &options) const override;
+
+    [[nodiscard]]
+    Result<std::vector<uint8_t>, FileError>
+        readBytes(const std::filesystem::path &filePath, const ReadOptions &options) const override;
+
+    [[nodiscard]]
+    Result<std::vector<std::string>, FileError>
+        readLines(const std::filesystem::path &filePath) const override;
+
+    [[nodiscard]]
+    Result<std::size_t, FileError> readInto(const std::filesystem::path &filePath,
+                                            std::span<std::byte> destination,
+                                            std::uint64_t offset = 0) const override;
+
+    [[nodiscard]]
+    Result<std::vector<uint8_t>, FileError> readRange(const std::filesystem::path &filePath,
+                                                      std::uint64_t offset,
+                                                      std::size_t length) const override;
+
+    [[nodiscard]]
+    std::vector<Result<std::string, FileError>>
+        readMany(std::span<const std::filesystem::path> filePaths) const override;
+
+    [[nodiscard]]
+    Result<LineReader, FileError>
+        lines(const std::filesystem::path &filePath,
+              std::size_t chunkSize = LineReader::kDefaultChunkSize) const override;
+
+    [[nodiscard]]
+    Result<MappedFile, FileError>
+        map(const std::filesystem::path &filePath,
+            AccessPattern pattern = AccessPattern::Sequential) const override;
+
+    [[nodiscard]]
+    bool exists(const std::filesystem::path &filePath) const override;
+
+    [[nodiscard]]
+    Result<std::uintmax_t, FileError> getSize(const std::filesystem::path &filePath) const override;
+
+  private:
+    /**
+     * @brief Decoded content of a compressed file, or nothing for a plain file
+     */
+    [[nodiscard]]
+    static Result<std::optional<std::string>, FileError>
+        decode(const std::filesystem::path &filePath);
+
+    std::shared_ptr<IFileReader> inner_;
+  };
+
+} // namespace nixoncpp::utils
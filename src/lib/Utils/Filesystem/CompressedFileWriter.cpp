@@ -0,0 +1,149 @@
+#include "CompressedFileWriter.hpp"
+#include <utility>
+
+namespace nixoncpp::utils {
+
+  namespace {
+    constexpr std::size_t kLineStagingSize = 64 * 1024;
+
+    std::span<const std::byte> asBytes(std::string_view text) noexcept {
+      return std::as_bytes(std::span(text.data(), text.size()));
+    }
+  } // namespace
+
+  CompressedFileWriter::CompressedFileWriter(std::shared_ptr<IFileWriter> inner,
+                                             CompressionOptions options)
+      : inner_(std::move(inner)), options_(options) {}
+
+  Result<void, FileError> CompressedFileWriter::write(const std::filesystem::path &filePath,
+                                                      const std::string &content,
+                                                      bool append) const {
+    return write(filePath, std::string_view(content), WriteOptions{.append = append});
+  }
+
+  Result<void, FileError> CompressedFileWriter::writeBytes(const std::filesystem::path &filePath,
+                                                           const std::vector<uint8_t> &data,
+                                                           bool append) const {
+    return writeBytes(filePath, std::span<const uint8_t>(data), WriteOptions{.append = append});
+  }
+
+  Result<void, FileError> CompressedFileWriter::write(const std::filesystem::path &filePath,
+                                                      std::string_view content,
+                                                      const WriteOptions &options) const {
+    const auto format = compressionForExtension(filePath);
+    if (format == CompressionFormat::None) {
+      return inner_->write(filePath, content, options);
+    }
+    auto writer = CompressingWriter::create(filePath, format, options_, options.append);
+    if (!writer) {
+      return writer.error();
+    }
+    if (auto written = writer.value().write(asBytes(content)); !written) {
+      return written.error();
+    }
+    return writer.value().finish();
+  }
+
+  Result<void, FileError> CompressedFileWriter::writeBytes(const std::filesystem::path &filePath,
+                                                           std::span<const uint8_t> data,
+                                                           const WriteOptions &options) const {
+    if (compressionForExtension(filePath) == CompressionFormat::None) {
+      return inner_->writeBytes(filePath, data, options);
+    }
+    return write(filePath,
+                 std::string_view(reinterpret_cast<const char *>(data.data()), data.size()),
+                 options);
+  }
+
+  template <typename Lines>
+  Result<void, FileError> CompressedFileWriter::compressLines(const std::filesystem::path &filePath,
+                                                              CompressionFormat format,
+                                                              const Lines &lines,
+                                                              bool append) const {
+    auto writer = CompressingWriter::create(filePath, format, options_, append);
+    if (!writer) {
+      return writer.error();
+    }
+
+    // Short lines are coalesced so the encoder sees a few large inputs instead of many tiny ones
+    std::string staging;
+    staging.reserve(kLineStagingSize);
+    for (const auto &line : lines) {
+      if (staging.size() + line.size() + 1 > kLineStagingSize && !staging.empty()) {
+        if (auto written = writer.value().write(asBytes(staging)); !written) {
+          return written.error();
+        }
+        staging.clear();
+      }
+      staging.append(line);
+      staging.push_back('\n');
+    }
+    if (!staging.empty()) {
+      if (auto written = writer.value().write(asBytes(staging)); !written) {
+        return written.error();
+      }
+    }
+    return writer.value().finish();
+  }
+
+  Result<void, FileError> CompressedFileWriter::writeLines(const std::filesystem::path &filePath,
+                                                           const std::vector<std::string> &lines,
+                                                           bool append) const {
+    const auto format = compressionForExtension(filePath);
+    if (format == CompressionFormat::None) {
+      return inner_->writeLines(filePath, lines, append);
+    }
+    return compressLines(filePath, format, lines, append);
+  }
+
+  Result<void, FileError>
+      CompressedFileWriter::writeLines(const std::filesystem::path &filePath,
+                                       std::span<const std::string_view> lines,
+                                       bool append) const {
+    const auto format = compressionForExtension(filePath);
+    if (format == CompressionFormat::None) {
+      return inner_->writeLines(filePath, lines, append);
+    }
+    return compressLines(filePath, format, lines, append);
+  }
+
+  Result<FileAppender, FileError>
+      CompressedFileWriter::openAppender(const std::filesystem::path &filePath,
+                                         const AppenderOptions &options) const {
+    if (compressionForExtension(filePath) != CompressionFormat::None) {
+      return FileError{
+          .code = FileErrorCode::InvalidPath,
+          .message = "Appenders write plain bytes and cannot target a compressed file",
+          .path = filePath.string(),
+      };
+    }
+    return inner_->openAppender(filePath, options);
+  }
+
+  Result<void, FileError> CompressedFileWriter::writeAtomic(const std::filesystem::path &filePath,
+                                                            std::string_view content) const {
+    const auto format = compressionForExtension(filePath);
+    if (format == CompressionFormat::None) {
+      return inner_->writeAtomic(filePath, content);
+    }
+    auto encoded = compress(asBytes(content), format, options_);
+    if (!encoded) {
+      FileError error = encoded.error();
+      error.path = filePath.string();
+      return error;
+    }
+    return inner_->writeAtomic(filePath, encoded.value());
+  }
+
+  Result<std::uintmax_t, FileError>
+      CompressedFileWriter::copyFile(const std::filesystem::path &source,
+                                     const std::filesystem::path &destination,
+                                     const CopyOptions &options) const {
+    return inner_->copyFile(source, destination, options);
+  }
+
+  Result<void, FileError> CompressedFileWriter::touch(const std::filesystem::path &filePath) const {
+    return inner_->touch(filePath);
+  }
+
+} // namespace nixoncpp::utils
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <Utils/Filesystem/Compression.hpp>
+#include <Utils/Filesystem/IFileWriter.hpp>
+#include <memory>
+
+namespace nixoncpp::utils {
+
+  /**
+   * @brief IFileWriter decorator compressing files named "*.gz" and "*.zst"
+   *
+   * The format follows the file extension; other paths go to the wrapped writer unchanged.
+   * Content is encoded through one fixed-size output buffer, and appending adds a new gzip
+   * member or zstd frame. Appenders cannot compress, so openAppender() on a compressed path
+   * fails. copyFile() and touch() always delegate.
+   */
+  class CompressedFileWriter final : public IFileWriter {
+  public:
+    /**
+     * @brief Wrap a writer
+     *
+     * @param inner Writer used for plain files
+     * @param options Encoder settings, e.g. zstd worker threads
+     */
+    explicit CompressedFileWriter(std::shared_ptr<IFileWriter> inner,
+                                  CompressionOptions options = CompressionOptions{});
+    CompressedFileWriter(const CompressedFileWriter &) = delete;
+    CompressedFileWriter &operator=(const CompressedFileWriter &) = delete;
+    CompressedFileWriter(CompressedFileWriter &&) = delete;
+    CompressedFileWriter &operator=(CompressedFileWriter &&) = delete;
+    ~CompressedFileWriter() override = default;
+
+    [[nodiscard]]
+    Result<void, FileError> write(const std::filesystem::path &filePath, const std::string &content,
+                                  bool append = false) const override;
+
+    [[nodiscard]]
+    Result<void, FileError> writeBytes(const std::filesystem::path &filePath,
+                                       const std::vector<uint8_t> &data,
+                                       bool append = false) const override;
+
+    [[nodiscard]]
+    Result<void, FileError> write(const std::filesystem::path &filePath, std::string_view content,
+                                  const WriteOptions &options) const override;
+
+    [[nodiscard]]
+    Result<void, FileError> writeBytes(const std::filesystem::path &filePath,
+                                       std::span<const uint8_t> data,
+                                       const WriteOptions &options) const override;
+
+    [[nodiscard]]
+    Result<void, FileError> writeLines(const std::filesystem::path &filePath,
+                                       const std::vector<std::string> &lines,
+                                       bool append = false) const override;
+
+    [[nodiscard]]
+    Result<void, FileError> writeLines(const std::filesystem::path &filePath,
+                                       std::span<const std::string_view> lines,
+                                       bool append = false) const override;
+
+    [[nodiscard]]
+    Result<FileAppender, FileError>
+        openAppender(const std::filesystem::path &filePath,
+                     const AppenderOptions &options = AppenderOptions{}) const override;
+
+    [[nodiscard]]
+    Result<void, FileError> writeAtomic(const std::filesystem::path &filePath,
+                                        std::string_view content) const override;
+
+    [[nodiscard]]
+    Result<std::uintmax_t, FileError>
+        copyFile(const std::filesystem::path &source, const std::filesystem::path &destination,
+                 const CopyOptions &options = CopyOptions{}) const override;
+
+    [[nodiscard]]
+    Result<void, FileError> touch(const std::filesystem::path &filePath) const override;
+
+  private:
+    template <typename Lines>
+    [[nodiscard]]
+    Result<void, FileError> compressLines(const std::filesystem::path &filePath,
+                                          CompressionFormat format, const Lines &lines,
+                                          bool append) const;
+
+    std::shared_ptr<IFileWriter> inner_;
+    CompressionOptions options_;
+  };
+
+} // namespace nixoncpp::utils
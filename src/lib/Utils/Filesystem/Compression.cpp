@@ -0,0 +1,803 @@
+#include "Compression.hpp"
+#include <Utils/Filesystem/PosixIo.hpp>
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <limits>
+#include <new>
+#include <optional>
+#include <vector>
+
+#if defined(NIXONCPP_HAS_ZLIB)
+#include <zlib.h>
+#endif
+#if defined(NIXONCPP_HAS_ZSTD)
+#include <zstd.h>
+#endif
+
+namespace nixoncpp::utils {
+
+  namespace {
+    constexpr std::array<std::byte, 2> kGzipMagic = {std::byte{0x1f}, std::byte{0x8b}};
+    constexpr std::array<std::byte, 4> kZstdMagic = {std::byte{0x28}, std::byte{0xb5},
+                                                     std::byte{0x2f}, std::byte{0xfd}};
+
+    constexpr std::size_t kMinReadAllChunk = 64 * 1024;
+    // Decoded size announced by a zstd frame header that is trusted for preallocation
+    constexpr std::uint64_t kMaxSizeHint = 1ULL << 30;
+
+    std::string_view formatName(CompressionFormat format) noexcept {
+      switch (format) {
+      case CompressionFormat::None: return "plain";
+      case CompressionFormat::Gzip: return "gzip";
+      case CompressionFormat::Zstd: return "zstd";
+      }
+      return "unknown";
+    }
+
+    FileError unavailableError(CompressionFormat format, const std::filesystem::path &filePath) {
+      return FileError{
+          .code = FileErrorCode::Unknown,
+          .message = fmt::format("{} support not available in this build (requires {})",
+                                 formatName(format),
+                                 format == CompressionFormat::Gzip ? "zlib" : "libzstd"),
+          .path = filePath.string(),
+      };
+    }
+
+    [[maybe_unused]] FileError corruptError(const std::filesystem::path &filePath,
+                                            std::string_view detail) {
+      return FileError{
+          .code = FileErrorCode::ReadError,
+          .message = fmt::format("Corrupt compressed data: {}", detail),
+          .path = filePath.string(),
+      };
+    }
+
+    [[maybe_unused]] FileError truncatedError(const std::filesystem::path &filePath) {
+      return FileError{
+          .code = FileErrorCode::ReadError,
+          .message = "Compressed file ends before the end of its data",
+          .path = filePath.string(),
+      };
+    }
+
+    [[maybe_unused]] FileError encoderError(const std::filesystem::path &filePath,
+                                            std::string_view detail) {
+      return FileError{
+          .code = FileErrorCode::WriteError,
+          .message = fmt::format("Compression failed: {}", detail),
+          .path = filePath.string(),
+      };
+    }
+
+    std::optional<FileError> isDirectoryError(const std::filesystem::path &filePath) {
+      std::error_code ec;
+      if (std::filesystem::is_directory(filePath, ec)) {
+        return FileError{
+            .code = FileErrorCode::IsDirectory,
+            .message = "Path is a directory, not a file",
+            .path = filePath.string(),
+        };
+      }
+      return std::nullopt;
+    }
+
+    std::optional<FileError> emptyPathError(const std::filesystem::path &filePath) {
+      if (filePath.empty()) {
+        return FileError{
+            .code = FileErrorCode::InvalidPath,
+            .message = "Empty file path",
+            .path = "",
+        };
+      }
+      return std::nullopt;
+    }
+  } // namespace
+
+  bool isCompressionAvailable(CompressionFormat format) noexcept {
+    switch (format) {
+    case CompressionFormat::None: return true;
+    case CompressionFormat::Gzip:
+#if defined(NIXONCPP_HAS_ZLIB)
+      return true;
+#else
+      return false;
+#endif
+    case CompressionFormat::Zstd:
+#if defined(NIXONCPP_HAS_ZSTD)
+      return true;
+#else
+      return false;
+#endif
+    }
+    return false;
+  }
+
+  CompressionFormat detectCompression(std::span<const std::byte> header) noexcept {
+    if (header.size() >= kZstdMagic.size() &&
+        std::equal(kZstdMagic.begin(), kZstdMagic.end(), header.begin())) {
+      return CompressionFormat::Zstd;
+    }
+    if (header.size() >= kGzipMagic.size() &&
+        std::equal(kGzipMagic.begin(), kGzipMagic.end(), header.begin())) {
+      return CompressionFormat::Gzip;
+    }
+    return CompressionFormat::None;
+  }
+
+  CompressionFormat compressionForExtension(const std::filesystem::path &filePath) noexcept {
+    const auto extension = filePath.extension();
+    if (extension == ".gz") {
+      return CompressionFormat::Gzip;
+    }
+    if (extension == ".zst" || extension == ".zstd") {
+      return CompressionFormat::Zstd;
+    }
+    return CompressionFormat::None;
+  }
+
+  Result<CompressionFormat, FileError> detectCompression(const std::filesystem::path &filePath) {
+    if (auto error = emptyPathError(filePath)) {
+      return *error;
+    }
+    if (auto error = isDirectoryError(filePath)) {
+      return *error;
+    }
+    std::array<std::byte, kZstdMagic.size()> header{};
+    std::size_t got = 0;
+#if defined(NIXONCPP_HAS_POSIX_IO)
+    auto fd = detail::openFile(filePath, O_RDONLY);
+    if (!fd) {
+      return detail::makeErrnoError(errno, FileErrorCode::ReadError,
+                                    "Failed to open file for reading", filePath);
+    }
+    while (got < header.size()) {
+      const auto read = ::pread(fd.get(), header.data() + got, header.size() - got,
+                                static_cast<off_t>(got));
+      if (read < 0 && errno == EINTR) {
+        continue;
+      }
+      if (read < 0) {
+        return detail::makeErrnoError(errno, FileErrorCode::ReadError,
+                                      "I/O error while reading file", filePath);
+      }
+      if (read == 0) {
+        break;
+      }
+      got += static_cast<std::size_t>(read);
+    }
+#else
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+      std::error_code ec;
+      return FileError{
+          .code = std::filesystem::exists(filePath, ec) ? FileErrorCode::ReadError
+                                                        : FileErrorCode::NotFound,
+          .message = "Failed to open file for reading",
+          .path = filePath.string(),
+      };
+    }
+    file.read(reinterpret_cast<char *>(header.data()), static_cast<std::streamsize>(header.size()));
+    got = static_cast<std::size_t>(file.gcount());
+#endif
+    return detectCompression(std::span<const std::byte>(header.data(), got));
+  }
+
+  // ============================================================================
+  // DecompressingReader
+  // ============================================================================
+
+  struct DecompressingReader::Impl {
+    std::filesystem::path path;
+    CompressionFormat format = CompressionFormat::None;
+#if defined(NIXONCPP_HAS_POSIX_IO)
+    detail::UniqueFd fd;
+#else
+    std::ifstream stream;
+#endif
+    std::vector<std::byte> input = std::vector<std::byte>(kInputBufferSize);
+    std::size_t inPos = 0;
+    std::size_t inEnd = 0;
+    bool inputEof = false;
+    bool streamEnded = false; // At a gzip member or zstd frame boundary
+    std::size_t sizeHint = 0;
+#if defined(NIXONCPP_HAS_ZLIB)
+    z_stream zlib{};
+    bool zlibActive = false;
+#endif
+#if defined(NIXONCPP_HAS_ZSTD)
+    ZSTD_DCtx *zstd = nullptr;
+#endif
+
+    Impl() = default;
+    Impl(const Impl &) = delete;
+    Impl &operator=(const Impl &) = delete;
+    Impl(Impl &&) = delete;
+    Impl &operator=(Impl &&) = delete;
+
+    ~Impl() {
+#if defined(NIXONCPP_HAS_ZLIB)
+      if (zlibActive) {
+        inflateEnd(&zlib);
+      }
+#endif
+#if defined(NIXONCPP_HAS_ZSTD)
+      ZSTD_freeDCtx(zstd);
+#endif
+    }
+
+    /**
+     * @brief Read raw file bytes
+     */
+    Result<std::size_t, FileError> readRaw(std::span<std::byte> destination) {
+#if defined(NIXONCPP_HAS_POSIX_IO)
+      for (;;) {
+        const auto got = ::read(fd.get(), destination.data(), destination.size());
+        if (got >= 0) {
+          return static_cast<std::size_t>(got);
+        }
+        if (errno != EINTR) {
+          return detail::makeErrnoError(errno, FileErrorCode::ReadError,
+                                        "I/O error while reading file", path);
+        }
+      }
+#else
+      stream.read(reinterpret_cast<char *>(destination.data()),
+                  static_cast<std::streamsize>(destination.size()));
+      if (stream.bad()) {
+        return FileError{
+            .code = FileErrorCode::ReadError,
+            .message = "I/O error while reading file",
+            .path = path.string(),
+        };
+      }
+      return static_cast<std::size_t>(stream.gcount());
+#endif
+    }
+
+    std::optional<FileError> refill() {
+      inPos = 0;
+      inEnd = 0;
+      auto got = readRaw(input);
+      if (!got) {
+        return got.error();
+      }
+      inEnd = got.value();
+      inputEof = inEnd == 0;
+      return std::nullopt;
+    }
+
+    Result<std::size_t, FileError> readPlain(std::span<std::byte> destination) {
+      if (inPos < inEnd) {
+        const auto count = std::min(destination.size(), inEnd - inPos);
+        std::copy_n(input.data() + inPos, count, destination.data());
+        inPos += count;
+        return count;
+      }
+      return readRaw(destination);
+    }
+
+#if defined(NIXONCPP_HAS_ZLIB)
+    Result<std::size_t, FileError> readGzip(std::span<std::byte> destination) {
+      const auto capacity = static_cast<uInt>(
+          std::min<std::size_t>(destination.size(), std::numeric_limits<uInt>::max()));
+      zlib.next_out = reinterpret_cast<Bytef *>(destination.data());
+      zlib.avail_out = capacity;
+      while (zlib.avail_out == capacity) {
+        if (inPos == inEnd && !inputEof) {
+          if (auto error = refill()) {
+            return *error;
+          }
+        }
+        if (streamEnded) {
+          if (inPos == inEnd) {
+            break;
+          }
+          inflateReset(&zlib); // Another member follows
+          streamEnded = false;
+        }
+        zlib.next_in = reinterpret_cast<Bytef *>(input.data() + inPos);
+        zlib.avail_in = static_cast<uInt>(inEnd - inPos);
+        const int status = inflate(&zlib, Z_NO_FLUSH);
+        inPos = inEnd - zlib.avail_in;
+        if (status == Z_STREAM_END) {
+          streamEnded = true;
+        } else if (status == Z_BUF_ERROR) {
+          if (inPos == inEnd && inputEof) {
+            return truncatedError(path);
+          }
+        } else if (status != Z_OK) {
+          return corruptError(path, zlib.msg != nullptr ? zlib.msg : "inflate failed");
+        }
+      }
+      return static_cast<std::size_t>(capacity - zlib.avail_out);
+    }
+#endif
+
+#if defined(NIXONCPP_HAS_ZSTD)
+    Result<std::size_t, FileError> readZstd(std::span<std::byte> destination) {
+      ZSTD_outBuffer out{destination.data(), destination.size(), 0};
+      while (out.pos == 0) {
+        if (inPos == inEnd && !inputEof) {
+          if (auto error = refill()) {
+            return *error;
+          }
+        }
+        ZSTD_inBuffer in{input.data(), inEnd, inPos};
+        const std::size_t status = ZSTD_decompressStream(zstd, &out, &in);
+        const bool progressed = in.pos != inPos || out.pos != 0;
+        inPos = in.pos;
+        if (ZSTD_isError(status) != 0U) {
+          return corruptError(path, ZSTD_getErrorName(status));
+        }
+        if (progressed) {
+          streamEnded = status == 0;
+        }
+        if (out.pos == 0 && inPos == inEnd && inputEof) {
+          if (streamEnded) {
+            break;
+          }
+          return truncatedError(path);
+        }
+      }
+      return out.pos;
+    }
+#endif
+  };
+
+  DecompressingReader::DecompressingReader(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+  DecompressingReader::DecompressingReader(DecompressingReader &&other) noexcept = default;
+  DecompressingReader &
+      DecompressingReader::operator=(DecompressingReader &&other) noexcept = default;
+  DecompressingReader::~DecompressingReader() = default;
+
+  Result<DecompressingReader, FileError>
+      DecompressingReader::open(const std::filesystem::path &filePath) {
+    if (auto error = emptyPathError(filePath)) {
+      return *error;
+    }
+
+    auto impl = std::make_unique<Impl>();
+    impl->path = filePath;
+#if defined(NIXONCPP_HAS_POSIX_IO)
+    impl->fd = detail::openFile(filePath, O_RDONLY);
+    if (!impl->fd) {
+      return detail::makeErrnoError(errno, FileErrorCode::ReadError,
+                                    "Failed to open file for reading", filePath);
+    }
+    struct stat info{};
+    if (::fstat(impl->fd.get(), &info) == 0) {
+      if (S_ISDIR(info.st_mode)) {
+        return *isDirectoryError(filePath);
+      }
+      impl->sizeHint = static_cast<std::size_t>(info.st_size);
+    }
+    detail::adviseFile(impl->fd.get(), 0, 0, AccessPattern::Sequential);
+#else
+    if (auto error = isDirectoryError(filePath)) {
+      return *error;
+    }
+    impl->stream.open(filePath, std::ios::binary);
+    if (!impl->stream.is_open()) {
+      std::error_code ec;
+      return FileError{
+          .code = std::filesystem::exists(filePath, ec) ? FileErrorCode::ReadError
+                                                        : FileErrorCode::NotFound,
+          .message = "Failed to open file for reading",
+          .path = filePath.string(),
+      };
+    }
+#endif
+
+    if (auto error = impl->refill()) {
+      return *error;
+    }
+    impl->format =
+        detectCompression(std::span<const std::byte>(impl->input.data(), impl->inEnd));
+    if (!isCompressionAvailable(impl->format)) {
+      return unavailableError(impl->format, filePath);
+    }
+
+    switch (impl->format) {
+    case CompressionFormat::None: break;
+    case CompressionFormat::Gzip:
+#if defined(NIXONCPP_HAS_ZLIB)
+      // 15 window bits + 16: expect a gzip header and trailer
+      if (inflateInit2(&impl->zlib, 15 + 16) != Z_OK) {
+        return corruptError(filePath, "failed to initialise zlib");
+      }
+      impl->zlibActive = true;
+      impl->sizeHint = 0; // The decoded size is only stored at the end of the member
+#endif
+      break;
+    case CompressionFormat::Zstd:
+#if defined(NIXONCPP_HAS_ZSTD)
+      impl->zstd = ZSTD_createDCtx();
+      if (impl->zstd == nullptr) {
+        throw std::bad_alloc();
+      }
+      {
+        const auto contentSize = ZSTD_getFrameContentSize(impl->input.data(), impl->inEnd);
+        impl->sizeHint = contentSize <= kMaxSizeHint ? static_cast<std::size_t>(contentSize) : 0;
+      }
+#endif
+      break;
+    }
+    return DecompressingReader(std::move(impl));
+  }
+
+  Result<std::size_t, FileError> DecompressingReader::read(std::span<std::byte> destination) {
+    if (destination.empty()) {
+      return std::size_t{0};
+    }
+    switch (impl_->format) {
+    case CompressionFormat::None: return impl_->readPlain(destination);
+    case CompressionFormat::Gzip:
+#if defined(NIXONCPP_HAS_ZLIB)
+      return impl_->readGzip(destination);
+#else
+      break;
+#endif
+    case CompressionFormat::Zstd:
+#if defined(NIXONCPP_HAS_ZSTD)
+      return impl_->readZstd(destination);
+#else
+      break;
+#endif
+    }
+    return unavailableError(impl_->format, impl_->path);
+  }
+
+  Result<std::string, FileError> DecompressingReader::readAll() {
+    std::string content;
+    // One extra byte lets a correctly sized read observe the end without growing the buffer
+    content.resize(impl_->sizeHint + 1);
+    std::size_t total = 0;
+    for (;;) {
+      if (total == content.size()) {
+        content.resize(std::max(content.size() * 2, kMinReadAllChunk));
+      }
+      auto got = read(std::as_writable_bytes(std::span(content.data() + total,
+                                                       content.size() - total)));
+      if (!got) {
+        return got.error();
+      }
+      if (got.value() == 0) {
+        break;
+      }
+      total += got.value();
+    }
+    content.resize(total);
+    return content;
+  }
+
+  CompressionFormat DecompressingReader::format() const noexcept { return impl_->format; }
+
+  // ============================================================================
+  // CompressingWriter
+  // ============================================================================
+
+  struct CompressingWriter::Impl {
+    std::filesystem::path path;
+    CompressionFormat format = CompressionFormat::None;
+    std::string *memory = nullptr; // Output goes here instead of a file, see compress()
+#if defined(NIXONCPP_HAS_POSIX_IO)
+    detail::UniqueFd fd;
+#else
+    std::ofstream stream;
+#endif
+    std::vector<std::byte> output = std::vector<std::byte>(kOutputBufferSize);
+    bool finished = false;
+#if defined(NIXONCPP_HAS_ZLIB)
+    z_stream zlib{};
+    bool zlibActive = false;
+#endif
+#if defined(NIXONCPP_HAS_ZSTD)
+    ZSTD_CCtx *zstd = nullptr;
+#endif
+
+    Impl() = default;
+    Impl(const Impl &) = delete;
+    Impl &operator=(const Impl &) = delete;
+    Impl(Impl &&) = delete;
+    Impl &operator=(Impl &&) = delete;
+
+    ~Impl() {
+#if defined(NIXONCPP_HAS_ZLIB)
+      if (zlibActive) {
+        deflateEnd(&zlib);
+      }
+#endif
+#if defined(NIXONCPP_HAS_ZSTD)
+      ZSTD_freeCCtx(zstd);
+#endif
+    }
+
+    std::optional<FileError> start([[maybe_unused]] const CompressionOptions &options) {
+      switch (format) {
+      case CompressionFormat::None: break;
+      case CompressionFormat::Gzip:
+#if defined(NIXONCPP_HAS_ZLIB)
+        if (deflateInit2(&zlib,
+                         options.level == 0 ? Z_DEFAULT_COMPRESSION
+                                            : std::clamp(options.level, 1, 9),
+                         Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+          return encoderError(path, "failed to initialise zlib");
+        }
+        zlibActive = true;
+#endif
+        break;
+      case CompressionFormat::Zstd:
+#if defined(NIXONCPP_HAS_ZSTD)
+        zstd = ZSTD_createCCtx();
+        if (zstd == nullptr) {
+          throw std::bad_alloc();
+        }
+        if (options.level != 0) {
+          ZSTD_CCtx_setParameter(zstd, ZSTD_c_compressionLevel, options.level);
+        }
+        if (options.threads > 0) {
+          // Fails on a libzstd built without multithreading; compression then stays inline
+          ZSTD_CCtx_setParameter(zstd, ZSTD_c_nbWorkers, static_cast<int>(options.threads));
+        }
+#endif
+        break;
+      }
+      return std::nullopt;
+    }
+
+    std::optional<FileError> writeRaw(std::span<const std::byte> data) {
+      if (data.empty()) {
+        return std::nullopt;
+      }
+      if (memory != nullptr) {
+        memory->append(reinterpret_cast<const char *>(data.data()), data.size());
+        return std::nullopt;
+      }
+#if defined(NIXONCPP_HAS_POSIX_IO)
+      std::array<iovec, 1> piece{{{const_cast<std::byte *>(data.data()), data.size()}}};
+      if (!detail::writeAllVectored(fd.get(), piece)) {
+        return detail::makeErrnoError(errno, FileErrorCode::WriteError,
+                                      "I/O error while writing file", path);
+      }
+#else
+      stream.write(reinterpret_cast<const char *>(data.data()),
+                   static_cast<std::streamsize>(data.size()));
+      if (!stream) {
+        return FileError{
+            .code = FileErrorCode::WriteError,
+            .message = "I/O error while writing file",
+            .path = path.string(),
+        };
+      }
+#endif
+      return std::nullopt;
+    }
+
+    std::optional<FileError> closeRaw() {
+      if (memory != nullptr) {
+        return std::nullopt;
+      }
+#if defined(NIXONCPP_HAS_POSIX_IO)
+      if (::close(fd.release()) != 0 && errno != EINTR) {
+        return detail::makeErrnoError(errno, FileErrorCode::WriteError,
+                                      "I/O error while closing file", path);
+      }
+#else
+      stream.close();
+      if (!stream) {
+        return FileError{
+            .code = FileErrorCode::WriteError,
+            .message = "I/O error while closing file",
+            .path = path.string(),
+        };
+      }
+#endif
+      return std::nullopt;
+    }
+
+    std::optional<FileError> encode(std::span<const std::byte> data) {
+      switch (format) {
+      case CompressionFormat::None: return writeRaw(data);
+      case CompressionFormat::Gzip:
+#if defined(NIXONCPP_HAS_ZLIB)
+        while (!data.empty()) {
+          const auto piece = data.first(std::min<std::size_t>(data.size(), 1U << 30));
+          zlib.next_in = reinterpret_cast<Bytef *>(const_cast<std::byte *>(piece.data()));
+          zlib.avail_in = static_cast<uInt>(piece.size());
+          do {
+            zlib.next_out = reinterpret_cast<Bytef *>(output.data());
+            zlib.avail_out = static_cast<uInt>(output.size());
+            if (deflate(&zlib, Z_NO_FLUSH) == Z_STREAM_ERROR) {
+              return encoderError(path, "deflate failed");
+            }
+            if (auto error = writeRaw(std::span(output).first(output.size() - zlib.avail_out))) {
+              return error;
+            }
+          } while (zlib.avail_out == 0);
+          data = data.subspan(piece.size());
+        }
+#endif
+        break;
+      case CompressionFormat::Zstd: {
+#if defined(NIXONCPP_HAS_ZSTD)
+        ZSTD_inBuffer in{data.data(), data.size(), 0};
+        while (in.pos < in.size) {
+          ZSTD_outBuffer out{output.data(), output.size(), 0};
+          const std::size_t status = ZSTD_compressStream2(zstd, &out, &in, ZSTD_e_continue);
+          if (ZSTD_isError(status) != 0U) {
+            return encoderError(path, ZSTD_getErrorName(status));
+          }
+          if (auto error = writeRaw(std::span(output).first(out.pos))) {
+            return error;
+          }
+        }
+#endif
+        break;
+      }
+      }
+      return std::nullopt;
+    }
+
+    std::optional<FileError> end() {
+      switch (format) {
+      case CompressionFormat::None: break;
+      case CompressionFormat::Gzip:
+#if defined(NIXONCPP_HAS_ZLIB)
+        zlib.next_in = nullptr;
+        zlib.avail_in = 0;
+        for (;;) {
+          zlib.next_out = reinterpret_cast<Bytef *>(output.data());
+          zlib.avail_out = static_cast<uInt>(output.size());
+          const int status = deflate(&zlib, Z_FINISH);
+          if (status != Z_OK && status != Z_STREAM_END && status != Z_BUF_ERROR) {
+            return encoderError(path, "deflate failed");
+          }
+          if (auto error = writeRaw(std::span(output).first(output.size() - zlib.avail_out))) {
+            return error;
+          }
+          if (status == Z_STREAM_END) {
+            break;
+          }
+        }
+#endif
+        break;
+      case CompressionFormat::Zstd:
+#if defined(NIXONCPP_HAS_ZSTD)
+        for (;;) {
+          ZSTD_inBuffer in{nullptr, 0, 0};
+          ZSTD_outBuffer out{output.data(), output.size(), 0};
+          const std::size_t remaining = ZSTD_compressStream2(zstd, &out, &in, ZSTD_e_end);
+          if (ZSTD_isError(remaining) != 0U) {
+            return encoderError(path, ZSTD_getErrorName(remaining));
+          }
+          if (auto error = writeRaw(std::span(output).first(out.pos))) {
+            return error;
+          }
+          if (remaining == 0) {
+            break;
+          }
+        }
+#endif
+        break;
+      }
+      return closeRaw();
+    }
+  };
+
+  CompressingWriter::CompressingWriter(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+  CompressingWriter::CompressingWriter(CompressingWriter &&other) noexcept = default;
+  CompressingWriter &CompressingWriter::operator=(CompressingWriter &&other) noexcept {
+    if (this != &other) {
+      if (impl_) {
+        (void)finish();
+      }
+      impl_ = std::move(other.impl_);
+    }
+    return *this;
+  }
+
+  CompressingWriter::~CompressingWriter() {
+    if (impl_) {
+      (void)finish();
+    }
+  }
+
+  Result<CompressingWriter, FileError>
+      CompressingWriter::create(const std::filesystem::path &filePath, CompressionFormat format,
+                                const CompressionOptions &options, bool append) {
+    if (auto error = emptyPathError(filePath)) {
+      return *error;
+    }
+    if (!isCompressionAvailable(format)) {
+      return unavailableError(format, filePath);
+    }
+    if (auto error = isDirectoryError(filePath)) {
+      return *error;
+    }
+    if (filePath.has_parent_path()) {
+      std::error_code ec;
+      std::filesystem::create_directories(filePath.parent_path(), ec);
+      if (ec) {
+        return FileError{
+            .code = FileErrorCode::WriteError,
+            .message = fmt::format("Failed to create parent directory: {}", ec.message()),
+            .path = filePath.parent_path().string(),
+        };
+      }
+    }
+
+    auto impl = std::make_unique<Impl>();
+    impl->path = filePath;
+    impl->format = format;
+#if defined(NIXONCPP_HAS_POSIX_IO)
+    impl->fd = detail::openFile(filePath, O_WRONLY | O_CREAT | (append ? O_APPEND : O_TRUNC));
+    if (!impl->fd) {
+      return detail::makeErrnoError(errno, FileErrorCode::WriteError,
+                                    "Failed to open file for writing", filePath);
+    }
+#else
+    impl->stream.open(filePath, std::ios::binary | (append ? std::ios::app : std::ios::trunc));
+    if (!impl->stream.is_open()) {
+      return FileError{
+          .code = FileErrorCode::WriteError,
+          .message = "Failed to open file for writing",
+          .path = filePath.string(),
+      };
+    }
+#endif
+    if (auto error = impl->start(options)) {
+      return *error;
+    }
+    return CompressingWriter(std::move(impl));
+  }
+
+  Result<void, FileError> CompressingWriter::write(std::span<const std::byte> data) {
+    if (impl_->finished) {
+      return FileError{
+          .code = FileErrorCode::WriteError,
+          .message = "Compressed stream already finished",
+          .path = impl_->path.string(),
+      };
+    }
+    if (auto error = impl_->encode(data)) {
+      return *error;
+    }
+    return {};
+  }
+
+  Result<void, FileError> CompressingWriter::finish() {
+    if (impl_->finished) {
+      return {};
+    }
+    impl_->finished = true;
+    if (auto error = impl_->end()) {
+      return *error;
+    }
+    return {};
+  }
+
+  Result<std::string, FileError> compress(std::span<const std::byte> data,
+                                          CompressionFormat format,
+                                          const CompressionOptions &options) {
+    if (!isCompressionAvailable(format)) {
+      return unavailableError(format, {});
+    }
+    std::string compressed;
+    CompressingWriter::Impl impl;
+    impl.format = format;
+    impl.memory = &compressed;
+    if (auto error = impl.start(options)) {
+      return *error;
+    }
+    if (auto error = impl.encode(data)) {
+      return *error;
+    }
+    if (auto error = impl.end()) {
+      return *error;
+    }
+    return compressed;
+  }
+
+} // namespace nixoncpp::utils
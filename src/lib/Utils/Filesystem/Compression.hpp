@@ -0,0 +1,194 @@
+#pragma once
+
+#include <Utils/UtilsError.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string>
+
+namespace nixoncpp::utils {
+
+  /**
+   * @brief Container formats understood by the compressed file streams
+   */
+  enum class CompressionFormat : std::uint8_t {
+    None, // Plain bytes
+    Gzip, // RFC 1952; needs the build to link zlib
+    Zstd, // Zstandard frames; needs the build to link libzstd
+  };
+
+  /**
+   * @brief Encoder settings of CompressingWriter
+   */
+  struct CompressionOptions {
+    int level = 0;         // 0 = library default; gzip 1-9, zstd 1-22
+    unsigned threads = 0;  // zstd worker threads; 0 compresses on the calling thread
+  };
+
+  /**
+   * @brief Whether this build can read and write a format
+   *
+   * @param format
+   * @return bool
+   */
+  [[nodiscard]]
+  bool isCompressionAvailable(CompressionFormat format) noexcept;
+
+  /**
+   * @brief Format announced by the magic bytes at the start of a file
+   *
+   * @param header First bytes of the file (4 are enough)
+   * @return CompressionFormat None if no known magic is present
+   */
+  [[nodiscard]]
+  CompressionFormat detectCompression(std::span<const std::byte> header) noexcept;
+
+  /**
+   * @brief Format announced by the magic bytes of a file on disk
+   *
+   * @param filePath
+   * @return Result<CompressionFormat, FileError>
+   */
+  [[nodiscard]]
+  Result<CompressionFormat, FileError> detectCompression(const std::filesystem::path &filePath);
+
+  /**
+   * @brief Format conventionally used for a file name (".gz", ".zst")
+   *
+   * @param filePath
+   * @return CompressionFormat None for any other extension
+   */
+  [[nodiscard]]
+  CompressionFormat compressionForExtension(const std::filesystem::path &filePath) noexcept;
+
+  /**
+   * @brief Compress a buffer in memory into one gzip member or zstd frame
+   *
+   * @param data
+   * @param format
+   * @param options
+   * @return Result<std::string, FileError>
+   */
+  [[nodiscard]]
+  Result<std::string, FileError> compress(std::span<const std::byte> data,
+                                          CompressionFormat format,
+                                          const CompressionOptions &options = CompressionOptions{});
+
+  /**
+   * @brief Streaming decoder of a possibly compressed file
+   *
+   * The format is detected from the magic bytes; plain files are passed through unchanged.
+   * Concatenated gzip members and zstd frames are decoded as one stream. Memory use is bounded
+   * by one input buffer plus the decoder state, independent of the file size. Move-only.
+   */
+  class DecompressingReader final {
+  public:
+    static constexpr std::size_t kInputBufferSize = 128 * 1024;
+
+    DecompressingReader(const DecompressingReader &) = delete;
+    DecompressingReader &operator=(const DecompressingReader &) = delete;
+    DecompressingReader(DecompressingReader &&other) noexcept;
+    DecompressingReader &operator=(DecompressingReader &&other) noexcept;
+    ~DecompressingReader();
+
+    /**
+     * @brief Open a file and detect its format
+     *
+     * @param filePath
+     * @return Result<DecompressingReader, FileError>
+     */
+    [[nodiscard]]
+    static Result<DecompressingReader, FileError> open(const std::filesystem::path &filePath);
+
+    /**
+     * @brief Decode the next bytes of the file
+     *
+     * @param destination
+     * @return Result<std::size_t, FileError> Bytes stored, 0 at the end of the data
+     */
+    [[nodiscard]]
+    Result<std::size_t, FileError> read(std::span<std::byte> destination);
+
+    /**
+     * @brief Decode the rest of the file
+     *
+     * @return Result<std::string, FileError>
+     */
+    [[nodiscard]]
+    Result<std::string, FileError> readAll();
+
+    [[nodiscard]]
+    CompressionFormat format() const noexcept;
+
+  private:
+    struct Impl;
+
+    explicit DecompressingReader(std::unique_ptr<Impl> impl);
+
+    std::unique_ptr<Impl> impl_;
+  };
+
+  /**
+   * @brief Streaming encoder writing a compressed file
+   *
+   * Output is produced through one fixed-size buffer, so memory use does not grow with the
+   * amount written. Appending adds a new gzip member or zstd frame, which readers decode as a
+   * continuation of the existing data. The destructor finishes the stream but cannot report
+   * errors; call finish() to check them. Move-only.
+   */
+  class CompressingWriter final {
+  public:
+    static constexpr std::size_t kOutputBufferSize = 128 * 1024;
+
+    CompressingWriter(const CompressingWriter &) = delete;
+    CompressingWriter &operator=(const CompressingWriter &) = delete;
+    CompressingWriter(CompressingWriter &&other) noexcept;
+    CompressingWriter &operator=(CompressingWriter &&other) noexcept;
+    ~CompressingWriter();
+
+    /**
+     * @brief Create (or append to) a file, creating missing parent directories
+     *
+     * @param filePath
+     * @param format None writes plain bytes
+     * @param options
+     * @param append
+     * @return Result<CompressingWriter, FileError>
+     */
+    [[nodiscard]]
+    static Result<CompressingWriter, FileError>
+        create(const std::filesystem::path &filePath, CompressionFormat format,
+               const CompressionOptions &options = CompressionOptions{}, bool append = false);
+
+    /**
+     * @brief Compress and write data
+     *
+     * @param data
+     * @return Result<void, FileError>
+     */
+    [[nodiscard]]
+    Result<void, FileError> write(std::span<const std::byte> data);
+
+    /**
+     * @brief End the stream and close the file; later writes fail
+     *
+     * @return Result<void, FileError>
+     */
+    [[nodiscard]]
+    Result<void, FileError> finish();
+
+  private:
+    struct Impl;
+
+    friend Result<std::string, FileError> compress(std::span<const std::byte> data,
+                                                   CompressionFormat format,
+                                                   const CompressionOptions &options);
+
+    explicit CompressingWriter(std::unique_ptr<Impl> impl);
+
+    std::unique_ptr<Impl> impl_;
+  };
+
+} // namespace nixoncpp::utils
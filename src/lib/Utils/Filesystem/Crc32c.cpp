@@ -0,0 +1,249 @@
+#include "Crc32c.hpp"
+#include <array>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(_M_X64))
+#define NIXONCPP_CRC32C_X86 1
+#include <immintrin.h>
+#elif defined(__GNUC__) && defined(__aarch64__)
+#define NIXONCPP_CRC32C_ARM 1
+#include <arm_acle.h>
+#if defined(__linux__)
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#endif
+#endif
+
+namespace nixoncpp::utils {
+
+  namespace {
+    using UpdateFn = std::uint32_t (*)(std::uint32_t, const unsigned char *, std::size_t) noexcept;
+
+    constexpr std::uint32_t kPolynomial = 0x82F63B78; // Castagnoli, bit-reflected
+
+    using Table = std::array<std::array<std::uint32_t, 256>, 8>;
+
+    constexpr Table makeTable() {
+      Table table{};
+      for (std::uint32_t i = 0; i < 256; ++i) {
+        std::uint32_t crc = i;
+        for (int bit = 0; bit < 8; ++bit) {
+          crc = (crc >> 1) ^ ((crc & 1U) != 0 ? kPolynomial : 0U);
+        }
+        table[0][i] = crc;
+      }
+      for (std::size_t slice = 1; slice < table.size(); ++slice) {
+        for (std::size_t i = 0; i < 256; ++i) {
+          const auto previous = table[slice - 1][i];
+          table[slice][i] = (previous >> 8) ^ table[0][previous & 0xFF];
+        }
+      }
+      return table;
+    }
+
+    constexpr Table kTable = makeTable();
+
+    std::uint32_t updateTable(std::uint32_t crc, const unsigned char *data,
+                              std::size_t size) noexcept {
+      while (size >= 8) {
+        const std::uint32_t low = crc ^ (static_cast<std::uint32_t>(data[0]) |
+                                         (static_cast<std::uint32_t>(data[1]) << 8) |
+                                         (static_cast<std::uint32_t>(data[2]) << 16) |
+                                         (static_cast<std::uint32_t>(data[3]) << 24));
+        crc = kTable[7][low & 0xFF] ^ kTable[6][(low >> 8) & 0xFF] ^
+              kTable[5][(low >> 16) & 0xFF] ^ kTable[4][low >> 24] ^ kTable[3][data[4]] ^
+              kTable[2][data[5]] ^ kTable[1][data[6]] ^ kTable[0][data[7]];
+        data += 8;
+        size -= 8;
+      }
+      while (size > 0) {
+        crc = (crc >> 8) ^ kTable[0][(crc ^ *data++) & 0xFF];
+        --size;
+      }
+      return crc;
+    }
+
+#if defined(NIXONCPP_CRC32C_X86) || defined(NIXONCPP_CRC32C_ARM)
+    // The hardware paths split large inputs into three lanes checksummed in parallel, hiding
+    // the latency of the CRC instruction, and merge them by shifting each lane's register
+    // over the zero bytes that follow it.
+    constexpr std::size_t kLaneBytes = 8 * 1024;
+
+    /**
+     * @brief Linear map advancing a CRC register over a fixed number of zero bytes
+     */
+    class ZeroShift {
+    public:
+      static ZeroShift over(std::size_t zeroBytes) noexcept {
+        ZeroShift shift;
+        std::array<std::uint32_t, 32> basis{};
+        for (std::size_t bit = 0; bit < basis.size(); ++bit) {
+          std::uint32_t crc = 1U << bit;
+          for (std::size_t i = 0; i < zeroBytes; ++i) {
+            crc = (crc >> 8) ^ kTable[0][crc & 0xFF];
+          }
+          basis[bit] = crc;
+        }
+        shift.tabulate(basis);
+        return shift;
+      }
+
+      [[nodiscard]]
+      ZeroShift twice() const noexcept {
+        ZeroShift shift;
+        std::array<std::uint32_t, 32> basis{};
+        for (std::size_t bit = 0; bit < basis.size(); ++bit) {
+          basis[bit] = apply(apply(1U << bit));
+        }
+        shift.tabulate(basis);
+        return shift;
+      }
+
+      [[nodiscard]]
+      std::uint32_t apply(std::uint32_t crc) const noexcept {
+        return table_[0][crc & 0xFF] ^ table_[1][(crc >> 8) & 0xFF] ^
+               table_[2][(crc >> 16) & 0xFF] ^ table_[3][crc >> 24];
+      }
+
+    private:
+      void tabulate(const std::array<std::uint32_t, 32> &basis) noexcept {
+        for (std::size_t byte = 0; byte < table_.size(); ++byte) {
+          for (std::uint32_t value = 0; value < 256; ++value) {
+            std::uint32_t image = 0;
+            for (std::size_t bit = 0; bit < 8; ++bit) {
+              if ((value & (1U << bit)) != 0) {
+                image ^= basis[(byte * 8) + bit];
+              }
+            }
+            table_[byte][value] = image;
+          }
+        }
+      }
+
+      std::array<std::array<std::uint32_t, 256>, 4> table_{};
+    };
+
+    struct LaneShifts {
+      ZeroShift oneLane;
+      ZeroShift twoLanes;
+    };
+
+    const LaneShifts &laneShifts() noexcept {
+      static const LaneShifts shifts = [] {
+        const auto oneLane = ZeroShift::over(kLaneBytes);
+        return LaneShifts{.oneLane = oneLane, .twoLanes = oneLane.twice()};
+      }();
+      return shifts;
+    }
+
+    std::uint64_t load64(const unsigned char *data) noexcept {
+      std::uint64_t word = 0;
+      std::memcpy(&word, data, sizeof(word));
+      return word;
+    }
+#endif
+
+#if defined(NIXONCPP_CRC32C_X86)
+    __attribute__((target("sse4.2"))) std::uint32_t
+        updateSse42(std::uint32_t crc, const unsigned char *data, std::size_t size) noexcept {
+      if (size >= 3 * kLaneBytes) {
+        const auto &shifts = laneShifts();
+        do {
+          std::uint64_t first = crc;
+          std::uint64_t second = 0;
+          std::uint64_t third = 0;
+          for (std::size_t i = 0; i < kLaneBytes; i += 8) {
+            first = _mm_crc32_u64(first, load64(data + i));
+            second = _mm_crc32_u64(second, load64(data + kLaneBytes + i));
+            third = _mm_crc32_u64(third, load64(data + (2 * kLaneBytes) + i));
+          }
+          crc = shifts.twoLanes.apply(static_cast<std::uint32_t>(first)) ^
+                shifts.oneLane.apply(static_cast<std::uint32_t>(second)) ^
+                static_cast<std::uint32_t>(third);
+          data += 3 * kLaneBytes;
+          size -= 3 * kLaneBytes;
+        } while (size >= 3 * kLaneBytes);
+      }
+      std::uint64_t wide = crc;
+      for (; size >= 8; data += 8, size -= 8) {
+        wide = _mm_crc32_u64(wide, load64(data));
+      }
+      crc = static_cast<std::uint32_t>(wide);
+      for (; size > 0; ++data, --size) {
+        crc = _mm_crc32_u8(crc, *data);
+      }
+      return crc;
+    }
+#endif
+
+#if defined(NIXONCPP_CRC32C_ARM)
+#if defined(__clang__)
+#define NIXONCPP_CRC32C_TARGET __attribute__((target("crc")))
+#else
+#define NIXONCPP_CRC32C_TARGET __attribute__((target("+crc")))
+#endif
+    [[maybe_unused]] NIXONCPP_CRC32C_TARGET std::uint32_t
+        updateArmv8(std::uint32_t crc, const unsigned char *data, std::size_t size) noexcept {
+      if (size >= 3 * kLaneBytes) {
+        const auto &shifts = laneShifts();
+        do {
+          std::uint32_t first = crc;
+          std::uint32_t second = 0;
+          std::uint32_t third = 0;
+          for (std::size_t i = 0; i < kLaneBytes; i += 8) {
+            first = __crc32cd(first, load64(data + i));
+            second = __crc32cd(second, load64(data + kLaneBytes + i));
+            third = __crc32cd(third, load64(data + (2 * kLaneBytes) + i));
+          }
+          crc = shifts.twoLanes.apply(first) ^ shifts.oneLane.apply(second) ^ third;
+          data += 3 * kLaneBytes;
+          size -= 3 * kLaneBytes;
+        } while (size >= 3 * kLaneBytes);
+      }
+      for (; size >= 8; data += 8, size -= 8) {
+        crc = __crc32cd(crc, load64(data));
+      }
+      for (; size > 0; ++data, --size) {
+        crc = __crc32cb(crc, *data);
+      }
+      return crc;
+    }
+#endif
+
+    struct Implementation {
+      UpdateFn update;
+      std::string_view name;
+    };
+
+    Implementation selectImplementation() noexcept {
+#if defined(NIXONCPP_CRC32C_X86)
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("sse4.2")) {
+        return {updateSse42, "sse4.2"};
+      }
+#elif defined(NIXONCPP_CRC32C_ARM)
+#if defined(__linux__)
+      if ((::getauxval(AT_HWCAP) & HWCAP_CRC32) != 0) {
+        return {updateArmv8, "armv8"};
+      }
+#elif defined(__APPLE__) || defined(__ARM_FEATURE_CRC32)
+      return {updateArmv8, "armv8"};
+#endif
+#endif
+      return {updateTable, "table"};
+    }
+
+    const Implementation &implementation() noexcept {
+      static const Implementation selected = selectImplementation();
+      return selected;
+    }
+  } // namespace
+
+  std::uint32_t crc32c(std::uint32_t crc, std::span<const std::byte> data) noexcept {
+    const auto *bytes = reinterpret_cast<const unsigned char *>(data.data());
+    return ~implementation().update(~crc, bytes, data.size());
+  }
+
+  std::string_view crc32cImplementationName() noexcept { return implementation().name; }
+
+} // namespace nixoncpp::utils
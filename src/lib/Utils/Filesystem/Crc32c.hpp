@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace nixoncpp::utils {
+
+  /**
+   * @brief CRC-32C (Castagnoli) of a block, continuing a running checksum
+   *
+   * Uses the CRC32 instructions of SSE4.2 (x86-64) or ARMv8 when the CPU has them, running
+   * three independent streams over large inputs, and a slicing-by-8 table elsewhere.
+   *
+   * @param crc 0 for the first block, then the result of the previous call
+   * @param data
+   * @return std::uint32_t e.g. 0xE3069283 for "123456789"
+   */
+  [[nodiscard]]
+  std::uint32_t crc32c(std::uint32_t crc, std::span<const std::byte> data) noexcept;
+
+  /**
+   * @brief Name of the CRC-32C implementation selected for this CPU ("sse4.2", "armv8" or
+   * "table")
+   *
+   * @return std::string_view
+   */
+  [[nodiscard]]
+  std::string_view crc32cImplementationName() noexcept;
+
+} // namespace nixoncpp::utils
@@ -1,9 +1,23 @@
 #include "DirectoryManager.hpp"
+#include <algorithm>
+#include <exception>
 #include <fmt/core.h>
+#include <future>
+#include <optional>
 #include <system_error>
+#include <utility>
+#include <vector>
 
 namespace nixoncpp::utils {
 
+  namespace {
+    bool isWithin(const std::filesystem::path &path, const std::filesystem::path &root) {
+      return std::mismatch(root.begin(), root.end(), path.begin(), path.end()).first == root.end();
+    }
+  } // namespace
+
+  DirectoryManager::DirectoryManager(std::shared_ptr<ThreadPool> pool) : pool_(std::move(pool)) {}
+
   Result<void, FileError>
       DirectoryManager::createDirectory(const std::filesystem::path &dirPath) const {
     if (dirPath.empty()) {
@@ -69,7 +83,8 @@ namespace nixoncpp::utils {
   }
 
   Result<std::uintmax_t, FileError>
-      DirectoryManager::removeDirectoryRecursive(const std::filesystem::path &dirPath) const {
+      DirectoryManager::removeDirectoryRecursive(const std::filesystem::path &dirPath,
+                                                 const RemoveProgress &progress) const {
     if (dirPath.empty()) {
       return FileError{
           .code = FileErrorCode::InvalidPath,
@@ -87,17 +102,142 @@ namespace nixoncpp::utils {
       };
     }
 
-    auto removed = std::filesystem::remove_all(dirPath, ec);
+    return detail::removeTree(dirPath, pool_.get(), progress);
+  }
 
-    if (ec) {
+  Result<std::uintmax_t, FileError>
+      DirectoryManager::copyTree(const std::filesystem::path &source,
+                                 const std::filesystem::path &destination,
+                                 const CopyOptions &options) const {
+    if (source.empty() || destination.empty()) {
+      return FileError{
+          .code = FileErrorCode::InvalidPath,
+          .message = "Empty directory path",
+          .path = "",
+      };
+    }
+
+    std::error_code ec;
+    if (!std::filesystem::exists(source, ec) || ec) {
+      return FileError{
+          .code = FileErrorCode::NotFound,
+          .message = "Directory does not exist",
+          .path = source.string(),
+      };
+    }
+
+    if (!std::filesystem::is_directory(source, ec) || ec) {
+      return FileError{
+          .code = FileErrorCode::NotDirectory,
+          .message = "Path is not a directory",
+          .path = source.string(),
+      };
+    }
+
+    // Copying into the tree being walked would never terminate
+    const auto sourceRoot = std::filesystem::weakly_canonical(source, ec);
+    const auto destinationRoot = std::filesystem::weakly_canonical(destination, ec);
+    if (!ec && isWithin(destinationRoot, sourceRoot)) {
+      return FileError{
+          .code = FileErrorCode::InvalidPath,
+          .message = "Destination is inside the source directory",
+          .path = destination.string(),
+      };
+    }
+
+    std::filesystem::create_directories(destination, ec);
+    if (ec || !std::filesystem::is_directory(destination, ec)) {
       return FileError{
           .code = FileErrorCode::WriteError,
-          .message = fmt::format("Failed to remove directory recursively: {}", ec.message()),
-          .path = dirPath.string(),
+          .message = fmt::format("Failed to create directory: {}", ec.message()),
+          .path = destination.string(),
+      };
+    }
+
+    // Create the directory structure and symlinks first, then copy the files
+    std::uintmax_t created = 0;
+    std::vector<std::pair<std::filesystem::path, std::filesystem::path>> files;
+    for (const auto &entry : std::filesystem::recursive_directory_iterator(source, ec)) {
+      if (ec) {
+        break;
+      }
+      const auto target = destination / entry.path().lexically_relative(source);
+      std::error_code entryEc;
+      if (entry.is_symlink(entryEc)) {
+        if (options.overwrite && std::filesystem::is_symlink(target, entryEc)) {
+          std::filesystem::remove(target, entryEc);
+        }
+        std::filesystem::copy_symlink(entry.path(), target, entryEc);
+      } else if (entry.is_directory(entryEc)) {
+        if (!std::filesystem::create_directory(target, entry.path(), entryEc) && !entryEc) {
+          continue; // Merged into an existing directory
+        }
+      } else if (entry.is_regular_file(entryEc)) {
+        files.emplace_back(entry.path(), target);
+        continue;
+      } else {
+        continue;
+      }
+      if (entryEc) {
+        return FileError{
+            .code = FileErrorCode::WriteError,
+            .message = fmt::format("Failed to copy entry: {}", entryEc.message()),
+            .path = target.string(),
+        };
+      }
+      ++created;
+    }
+    if (ec) {
+      return FileError{
+          .code = FileErrorCode::ReadError,
+          .message = fmt::format("Error reading directory recursively: {}", ec.message()),
+          .path = source.string(),
       };
     }
 
-    return removed;
+    std::optional<FileError> firstError;
+    const auto account = [&](const Result<std::uintmax_t, FileError> &copied) {
+      if (copied) {
+        ++created;
+      } else if (!firstError) {
+        firstError = copied.error();
+      }
+    };
+    if (pool_) {
+      std::vector<std::future<Result<std::uintmax_t, FileError>>> pending;
+      std::exception_ptr failure;
+      try {
+        pending.reserve(files.size());
+        for (const auto &[from, to] : files) {
+          pending.push_back(pool_->submit(
+              [&from, &to, &options] { return detail::copyFileContents(from, to, options); }));
+        }
+      } catch (...) {
+        failure = std::current_exception();
+      }
+      // The tasks reference files and options: wait for all of them before leaving
+      for (auto &copied : pending) {
+        try {
+          account(copied.get());
+        } catch (...) {
+          if (!failure) {
+            failure = std::current_exception();
+          }
+        }
+      }
+      if (failure) {
+        std::rethrow_exception(failure);
+      }
+    } else {
+      for (const auto &[from, to] : files) {
+        account(detail::copyFileContents(from, to, options));
+      }
+    }
+
+    if (firstError) {
+      return *firstError;
+    }
+    return created;
   }
 
   bool DirectoryManager::exists(const std::filesystem::path &dirPath) const {
@@ -179,6 +319,25 @@ namespace nixoncpp::utils {
 
   Result<std::vector<std::filesystem::path>, FileError>
       DirectoryManager::listEntriesRecursive(const std::filesystem::path &dirPath) const {
+    auto walked = walk(dirPath);
+    if (!walked) {
+      return walked.error();
+    }
+
+    std::vector<std::filesystem::path> entries;
+    entries.reserve(walked.value().size());
+    for (auto &entry : walked.value()) {
+      entries.push_back(std::move(entry.path));
+    }
+    // The parallel walk finishes directories in any order; a parent compares below its contents
+    std::sort(entries.begin(), entries.end());
+
+    return entries;
+  }
+
+  Result<std::vector<DirectoryEntry>, FileError>
+      DirectoryManager::walk(const std::filesystem::path &dirPath,
+                             const WalkOptions &options) const {
     if (dirPath.empty()) {
       return FileError{
           .code = FileErrorCode::InvalidPath,
@@ -204,20 +363,75 @@ namespace nixoncpp::utils {
       };
     }
 
-    std::vector<std::filesystem::path> entries;
+    return detail::walkDirectory(dirPath, options, pool_.get());
+  }
 
-    for (const auto &entry : std::filesystem::recursive_directory_iterator(dirPath, ec)) {
-      if (ec) {
-        return FileError{
-            .code = FileErrorCode::ReadError,
-            .message = fmt::format("Error reading directory recursively: {}", ec.message()),
-            .path = dirPath.string(),
-        };
-      }
-      entries.push_back(entry.path());
+  Result<DirectoryRange, FileError>
+      DirectoryManager::iterate(const std::filesystem::path &dirPath,
+                                const WalkOptions &options) const {
+    return DirectoryRange::open(dirPath, options);
+  }
+
+  Result<DirectorySnapshot, FileError>
+      DirectoryManager::snapshot(const std::filesystem::path &dirPath) const {
+    if (dirPath.empty()) {
+      return FileError{
+          .code = FileErrorCode::InvalidPath,
+          .message = "Empty directory path",
+          .path = "",
+      };
     }
 
-    return entries;
+    std::error_code ec;
+    if (!std::filesystem::exists(dirPath, ec) || ec) {
+      return FileError{
+          .code = FileErrorCode::NotFound,
+          .message = "Directory does not exist",
+          .path = dirPath.string(),
+      };
+    }
+
+    if (!std::filesystem::is_directory(dirPath, ec) || ec) {
+      return FileError{
+          .code = FileErrorCode::NotDirectory,
+          .message = "Path is not a directory",
+          .path = dirPath.string(),
+      };
+    }
+
+    return detail::scanDirectory(dirPath, nullptr, RescanOptions{}, pool_.get());
+  }
+
+  Result<DirectorySnapshot, FileError>
+      DirectoryManager::rescan(const std::filesystem::path &dirPath,
+                               const DirectorySnapshot &previous,
+                               const RescanOptions &options) const {
+    if (dirPath.empty()) {
+      return FileError{
+          .code = FileErrorCode::InvalidPath,
+          .message = "Empty directory path",
+          .path = "",
+      };
+    }
+
+    std::error_code ec;
+    if (!std::filesystem::exists(dirPath, ec) || ec) {
+      return FileError{
+          .code = FileErrorCode::NotFound,
+          .message = "Directory does not exist",
+          .path = dirPath.string(),
+      };
+    }
+
+    if (!std::filesystem::is_directory(dirPath, ec) || ec) {
+      return FileError{
+          .code = FileErrorCode::NotDirectory,
+          .message = "Path is not a directory",
+          .path = dirPath.string(),
+      };
+    }
+
+    return detail::scanDirectory(dirPath, &previous, options, pool_.get());
   }
 
   Result<std::filesystem::path, FileError> DirectoryManager::getCurrentDirectory() const {
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <Utils/Concurrency/ThreadPool.hpp>
 #include <Utils/Filesystem/IDirectoryManager.hpp>
+#include <memory>
 
 namespace nixoncpp::utils {
 
@@ -11,6 +13,16 @@ namespace nixoncpp::utils {
   class DirectoryManager final : public IDirectoryManager {
   public:
     DirectoryManager() = default;
+
+    /**
+     * @brief Directory manager whose copyTree() copies files, whose removeDirectoryRecursive()
+     * empties directories and whose walk(), listEntriesRecursive() and snapshot() read
+     * directories in parallel on the pool
+     *
+     * @param pool
+     */
+    explicit DirectoryManager(std::shared_ptr<ThreadPool> pool);
+
     DirectoryManager(const DirectoryManager &) = delete;
     DirectoryManager &operator=(const DirectoryManager &) = delete;
     DirectoryManager(DirectoryManager &&) = delete;
@@ -25,7 +37,13 @@ namespace nixoncpp::utils {
 
     [[nodiscard]]
     Result<std::uintmax_t, FileError>
-        removeDirectoryRecursive(const std::filesystem::path &dirPath) const override;
+        removeDirectoryRecursive(const std::filesystem::path &dirPath,
+                                 const RemoveProgress &progress = RemoveProgress{}) const override;
+
+    [[nodiscard]]
+    Result<std::uintmax_t, FileError>
+        copyTree(const std::filesystem::path &source, const std::filesystem::path &destination,
+                 const CopyOptions &options = CopyOptions{}) const override;
 
     [[nodiscard]]
     bool exists(const std::filesystem::path &dirPath) const override;
@@ -41,11 +59,33 @@ namespace nixoncpp::utils {
     Result<std::vector<std::filesystem::path>, FileError>
         listEntriesRecursive(const std::filesystem::path &dirPath) const override;
 
+    [[nodiscard]]
+    Result<std::vector<DirectoryEntry>, FileError>
+        walk(const std::filesystem::path &dirPath,
+             const WalkOptions &options = WalkOptions{}) const override;
+
+    [[nodiscard]]
+    Result<DirectoryRange, FileError>
+        iterate(const std::filesystem::path &dirPath,
+                const WalkOptions &options = WalkOptions{}) const override;
+
+    [[nodiscard]]
+    Result<DirectorySnapshot, FileError>
+        snapshot(const std::filesystem::path &dirPath) const override;
+
+    [[nodiscard]]
+    Result<DirectorySnapshot, FileError>
+        rescan(const std::filesystem::path &dirPath, const DirectorySnapshot &previous,
+               const RescanOptions &options = RescanOptions{}) const override;
+
     [[nodiscard]]
     Result<std::filesystem::path, FileError> getCurrentDirectory() const override;
 
     [[nodiscard]]
     Result<std::filesystem::path, FileError> getTempDirectory() const override;
+
+  private:
+    std::shared_ptr<ThreadPool> pool_;
   };
 
 } // namespace nixoncpp::utils
\ No newline at end of file
@@ -0,0 +1,264 @@
+#include "DirectoryRange.hpp"
+#include <Utils/Filesystem/DirectoryStream.hpp>
+#include <chrono>
+#include <fmt/core.h>
+#include <utility>
+#include <vector>
+
+namespace nixoncpp::utils {
+
+#if defined(NIXONCPP_HAS_POSIX_IO)
+  namespace {
+    /**
+     * @brief Directory being read, one per level of the walk
+     */
+    struct Frame {
+      detail::UniqueFd fd;
+      detail::DirectoryStream stream;
+      std::filesystem::path path;
+      std::size_t depth = 0; // Depth of the entries inside
+      dev_t device = 0;      // Identity, recorded under SymlinkPolicy::Follow
+      ino_t inode = 0;
+    };
+  } // namespace
+
+  struct DirectoryRange::Impl {
+    WalkOptions options;
+    std::size_t rootLength = 0; // See detail::relativePathOffset()
+    std::vector<Frame> frames;
+    DirectoryEntry current;
+    bool descendPending = false; // current is a directory to read before the next entry
+    bool descendViaSymlink = false;
+    std::optional<FileError> error;
+
+    // Push a directory; false when it was not entered (vanished or closes a symlink cycle)
+    bool enter(int parentFd, const std::filesystem::path &path, std::size_t depth,
+               bool viaSymlink) {
+      const auto name = parentFd == AT_FDCWD ? path : path.filename();
+      auto fd = detail::openDirectoryAt(parentFd, name.c_str(), viaSymlink);
+      if (!fd) {
+        if (parentFd != AT_FDCWD && errno == ENOENT) {
+          return false;
+        }
+        fail(detail::makeErrnoError(errno, FileErrorCode::ReadError, "Failed to open directory",
+                                    path));
+        return false;
+      }
+
+      const int dirFd = fd.get();
+      Frame frame{.fd = std::move(fd), .stream = detail::DirectoryStream(dirFd), .path = path,
+                  .depth = depth};
+      if (options.symlinks == SymlinkPolicy::Follow) {
+        struct stat info{};
+        if (::fstat(dirFd, &info) == 0) {
+          frame.device = info.st_dev;
+          frame.inode = info.st_ino;
+          // Every directory on the path from the root is on the stack
+          for (const auto &ancestor : frames) {
+            if (viaSymlink && ancestor.device == info.st_dev && ancestor.inode == info.st_ino) {
+              return false;
+            }
+          }
+        }
+      }
+      frames.push_back(std::move(frame));
+      return true;
+    }
+
+    void fail(FileError failure) {
+      error = std::move(failure);
+      frames.clear();
+    }
+
+    const DirectoryEntry *next() {
+      for (;;) {
+        if (descendPending) {
+          descendPending = false;
+          const auto &parent = frames.back();
+          enter(parent.fd.get(), current.path, parent.depth + 1, descendViaSymlink);
+        }
+        if (frames.empty()) {
+          return nullptr;
+        }
+
+        auto &top = frames.back();
+        detail::RawDirectoryEntry raw;
+        if (!top.stream.next(raw)) {
+          if (top.stream.error() != 0) {
+            fail(detail::makeErrnoError(top.stream.error(), FileErrorCode::ReadError,
+                                        "Error reading directory", top.path));
+          } else {
+            frames.pop_back();
+          }
+          continue;
+        }
+
+        detail::EntryDecision decision;
+        if (const int err = detail::resolveEntry(top.fd.get(), raw, top.path, rootLength,
+                                                 top.depth, options, current, decision);
+            err != 0) {
+          if (err != ENOENT) {
+            fail(detail::makeErrnoError(err, FileErrorCode::ReadError, "Failed to stat entry",
+                                        top.path / raw.name));
+          }
+          continue;
+        }
+        descendPending = decision.descend;
+        descendViaSymlink = decision.viaSymlink;
+        if (decision.report) {
+          return &current;
+        }
+      }
+    }
+  };
+#else
+  struct DirectoryRange::Impl {
+    WalkOptions options;
+    std::filesystem::path root;
+    std::filesystem::recursive_directory_iterator it;
+    bool started = false;
+    DirectoryEntry current;
+    std::optional<FileError> error;
+
+    static EntryType typeOf(const std::filesystem::file_status &status) noexcept {
+      switch (status.type()) {
+      case std::filesystem::file_type::regular: return EntryType::Regular;
+      case std::filesystem::file_type::directory: return EntryType::Directory;
+      case std::filesystem::file_type::symlink: return EntryType::Symlink;
+      case std::filesystem::file_type::none:
+      case std::filesystem::file_type::not_found:
+      case std::filesystem::file_type::unknown: return EntryType::Unknown;
+      default: return EntryType::Other;
+      }
+    }
+
+    const DirectoryEntry *next() {
+      std::error_code ec;
+      if (started) {
+        it.increment(ec);
+      }
+      started = true;
+      for (; !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+        const auto depth = static_cast<std::size_t>(it.depth());
+        std::error_code entryEc;
+        const auto status = it->symlink_status(entryEc);
+        const auto type = typeOf(status);
+        if (type == EntryType::Symlink && options.symlinks == SymlinkPolicy::Skip) {
+          continue;
+        }
+
+        current.path = it->path();
+        current.type = type;
+        current.depth = depth;
+        current.stat = std::nullopt;
+        if (options.withStat || options.filter.needsStat()) {
+          EntryStat stat;
+          if (type == EntryType::Regular) {
+            stat.size = it->file_size(entryEc);
+          }
+          const auto modified = it->last_write_time(entryEc).time_since_epoch();
+          stat.modifiedNs =
+              std::chrono::duration_cast<std::chrono::nanoseconds>(modified).count();
+          stat.mode = static_cast<std::uint32_t>(status.permissions());
+          current.stat = stat;
+        }
+
+        const bool isDirectory =
+            type == EntryType::Directory ||
+            (type == EntryType::Symlink && options.symlinks == SymlinkPolicy::Follow &&
+             it->is_directory(entryEc));
+        bool descend = isDirectory && depth < options.maxDepth;
+        bool report = options.filter.acceptsName(current.path.filename().string(), type);
+        if (const auto &glob = options.filter.glob; glob && (descend || report)) {
+          const auto relative = current.path.lexically_relative(root).generic_string();
+          report = report && glob->matches(relative);
+          descend = descend && glob->canMatchBelow(relative);
+        }
+        descend = descend && !(options.prune && options.prune(current));
+        if (!descend) {
+          it.disable_recursion_pending();
+        }
+        if (report && options.filter.acceptsEntry(current)) {
+          return &current;
+        }
+      }
+      if (ec) {
+        error = FileError{
+            .code = FileErrorCode::ReadError,
+            .message = fmt::format("Error reading directory recursively: {}", ec.message()),
+            .path = root.string(),
+        };
+      }
+      return nullptr;
+    }
+  };
+#endif
+
+  DirectoryRange::DirectoryRange(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+  DirectoryRange::DirectoryRange(DirectoryRange &&other) noexcept = default;
+
+  DirectoryRange &DirectoryRange::operator=(DirectoryRange &&other) noexcept = default;
+
+  DirectoryRange::~DirectoryRange() = default;
+
+  Result<DirectoryRange, FileError> DirectoryRange::open(const std::filesystem::path &root,
+                                                         WalkOptions options) {
+    if (root.empty()) {
+      return FileError{
+          .code = FileErrorCode::InvalidPath,
+          .message = "Empty directory path",
+          .path = "",
+      };
+    }
+
+    auto impl = std::make_unique<Impl>();
+    impl->options = std::move(options);
+#if defined(NIXONCPP_HAS_POSIX_IO)
+    impl->rootLength = detail::relativePathOffset(root);
+    if (!impl->enter(AT_FDCWD, root, 0, true)) {
+      return *impl->error;
+    }
+#else
+    std::error_code ec;
+    if (!std::filesystem::exists(root, ec) || ec) {
+      return FileError{
+          .code = FileErrorCode::NotFound,
+          .message = "Directory does not exist",
+          .path = root.string(),
+      };
+    }
+    if (!std::filesystem::is_directory(root, ec) || ec) {
+      return FileError{
+          .code = FileErrorCode::NotDirectory,
+          .message = "Path is not a directory",
+          .path = root.string(),
+      };
+    }
+    auto directoryOptions = std::filesystem::directory_options::none;
+    if (impl->options.symlinks == SymlinkPolicy::Follow) {
+      directoryOptions = std::filesystem::directory_options::follow_directory_symlink;
+    }
+    impl->root = root;
+    impl->it = std::filesystem::recursive_directory_iterator(root, directoryOptions, ec);
+    if (ec) {
+      return FileError{
+          .code = FileErrorCode::ReadError,
+          .message = fmt::format("Error reading directory: {}", ec.message()),
+          .path = root.string(),
+      };
+    }
+#endif
+    return DirectoryRange(std::move(impl));
+  }
+
+  const DirectoryEntry *DirectoryRange::next() {
+    return impl_ ? impl_->next() : nullptr;
+  }
+
+  const std::optional<FileError> &DirectoryRange::error() const noexcept {
+    static const std::optional<FileError> kNone;
+    return impl_ ? impl_->error : kNone;
+  }
+
+} // namespace nixoncpp::utils
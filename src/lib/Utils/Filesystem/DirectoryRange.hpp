@@ -0,0 +1,114 @@
+#pragma once
+
+#include <Utils/Filesystem/DirectoryWalk.hpp>
+#include <Utils/UtilsError.hpp>
+#include <cstddef>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <optional>
+
+namespace nixoncpp::utils {
+
+  /**
+   * @brief Lazy depth-first walk of a directory tree
+   *
+   * Directories are read only as far as the range is consumed, so stopping early skips the
+   * rest of the tree, and memory use is bounded by one read buffer per open directory level
+   * instead of the size of the tree. WalkOptions are applied while reading: filtered-out
+   * entries are never materialized and pruned subtrees are never opened. A directory is
+   * yielded before its contents. Move-only.
+   */
+  class DirectoryRange final {
+  public:
+    /**
+     * @brief Input iterator over the entries of a DirectoryRange
+     */
+    class Iterator {
+    public:
+      using iterator_category = std::input_iterator_tag;
+      using value_type = DirectoryEntry;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const DirectoryEntry *;
+      using reference = const DirectoryEntry &;
+
+      Iterator() = default;
+      explicit Iterator(DirectoryRange *range) : range_(range) { ++*this; }
+
+      reference operator*() const { return *entry_; }
+      pointer operator->() const { return entry_; }
+
+      Iterator &operator++() {
+        if (range_ != nullptr) {
+          entry_ = range_->next();
+          if (entry_ == nullptr) {
+            range_ = nullptr;
+          }
+        }
+        return *this;
+      }
+
+      void operator++(int) { ++*this; }
+
+      friend bool operator==(const Iterator &it, std::default_sentinel_t) {
+        return it.range_ == nullptr;
+      }
+
+    private:
+      DirectoryRange *range_ = nullptr;
+      const DirectoryEntry *entry_ = nullptr;
+    };
+
+    DirectoryRange(const DirectoryRange &) = delete;
+    DirectoryRange &operator=(const DirectoryRange &) = delete;
+    DirectoryRange(DirectoryRange &&other) noexcept;
+    DirectoryRange &operator=(DirectoryRange &&other) noexcept;
+    ~DirectoryRange();
+
+    /**
+     * @brief Open the root directory of a walk
+     *
+     * @param root
+     * @param options
+     * @return Result<DirectoryRange, FileError>
+     */
+    [[nodiscard]]
+    static Result<DirectoryRange, FileError> open(const std::filesystem::path &root,
+                                                  WalkOptions options = WalkOptions{});
+
+    /**
+     * @brief Advance to the next entry that passes the filter
+     *
+     * @return const DirectoryEntry* Valid until the next call; null at the end of the walk or
+     * on a read error (see error())
+     */
+    [[nodiscard]]
+    const DirectoryEntry *next();
+
+    /**
+     * @brief Read error that ended the walk early, if any
+     *
+     * @return const std::optional<FileError>&
+     */
+    [[nodiscard]]
+    const std::optional<FileError> &error() const noexcept;
+
+    [[nodiscard]]
+    Iterator begin() {
+      return Iterator(this);
+    }
+
+    [[nodiscard]]
+    std::default_sentinel_t end() const noexcept {
+      return {};
+    }
+
+  private:
+    struct Impl;
+
+    explicit DirectoryRange(std::unique_ptr<Impl> impl);
+
+    std::unique_ptr<Impl> impl_;
+  };
+
+} // namespace nixoncpp::utils
@@ -0,0 +1,206 @@
+#include "DirectoryRemoval.hpp"
+#include <Utils/Concurrency/ThreadPool.hpp>
+#include <Utils/Concurrency/WorkStealingQueues.hpp>
+#include <Utils/Filesystem/DirectoryStream.hpp>
+#include <atomic>
+#include <fmt/core.h>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <system_error>
+
+namespace nixoncpp::utils::detail {
+
+#if defined(NIXONCPP_HAS_POSIX_IO)
+  namespace {
+    /**
+     * @brief Directory being emptied
+     */
+    struct RemovalNode {
+      std::shared_ptr<RemovalNode> parent;      // Null for the root
+      std::shared_ptr<const UniqueFd> parentFd; // Null for the root, which is used by path
+      std::string name;                         // Relative to parentFd
+      std::filesystem::path path;
+      std::atomic<std::size_t> pending{1}; // Its own listing plus subdirectories still present
+    };
+
+    class ParallelRemoval {
+    public:
+      ParallelRemoval(std::size_t workers, const RemoveProgress &progress)
+          : queues_(workers), progress_(progress) {}
+
+      void run(const std::filesystem::path &root, ThreadPool *pool) {
+        auto node = std::make_shared<RemovalNode>();
+        node->name = root.string();
+        node->path = root;
+        queues_.push(0, std::move(node));
+        auto handle = [this](std::size_t worker, const std::shared_ptr<RemovalNode> &job) {
+          emptyDirectory(worker, job);
+        };
+        queues_.runOn(pool, handle);
+      }
+
+      [[nodiscard]]
+      Result<std::uintmax_t, FileError> result() {
+        if (error_) {
+          return *error_;
+        }
+        return removed_.load();
+      }
+
+    private:
+      void fail(FileError error) {
+        {
+          const std::lock_guard lock(errorMutex_);
+          if (!error_) {
+            error_ = std::move(error);
+          }
+        }
+        queues_.stop();
+      }
+
+      void count(std::uintmax_t removed) {
+        removed_.fetch_add(removed);
+        if (progress_) {
+          const std::lock_guard lock(progressMutex_);
+          progress_(removed_.load());
+        }
+      }
+
+      // Unlink every entry that is not a directory and queue the subdirectories
+      void emptyDirectory(std::size_t self, const std::shared_ptr<RemovalNode> &node) {
+        const bool isRoot = !node->parentFd;
+        auto fd = openDirectoryAt(isRoot ? AT_FDCWD : node->parentFd->get(), node->name.c_str(),
+                                  isRoot);
+        if (!fd) {
+          if (!isRoot && errno == ENOENT) {
+            release(node);
+            return;
+          }
+          fail(makeErrnoError(errno, FileErrorCode::WriteError, "Failed to open directory",
+                              node->path));
+          return;
+        }
+
+        const int dirFd = fd.get();
+        std::shared_ptr<const UniqueFd> shared;
+        std::uintmax_t removed = 0;
+        DirectoryStream stream(dirFd);
+        RawDirectoryEntry raw;
+        while (stream.next(raw)) {
+          auto type = raw.type;
+          if (type == EntryType::Unknown) {
+            struct stat info{};
+            if (::fstatat(dirFd, raw.name.data(), &info, AT_SYMLINK_NOFOLLOW) != 0) {
+              if (errno == ENOENT) {
+                continue;
+              }
+              fail(makeErrnoError(errno, FileErrorCode::WriteError, "Failed to stat entry",
+                                  node->path / raw.name));
+              return;
+            }
+            type = entryTypeFromMode(info.st_mode);
+          }
+
+          if (type == EntryType::Directory) {
+            // The subdirectory is opened and removed relative to this descriptor, so it stays
+            // open until then
+            if (!shared) {
+              shared = std::make_shared<const UniqueFd>(std::move(fd));
+            }
+            auto child = std::make_shared<RemovalNode>();
+            child->parent = node;
+            child->parentFd = shared;
+            child->name = std::string(raw.name);
+            child->path = node->path / raw.name;
+            node->pending.fetch_add(1);
+            queues_.push(self, std::move(child));
+            continue;
+          }
+          if (::unlinkat(dirFd, raw.name.data(), 0) == 0) {
+            ++removed;
+          } else if (errno != ENOENT) {
+            fail(makeErrnoError(errno, FileErrorCode::WriteError, "Failed to remove entry",
+                                node->path / raw.name));
+            return;
+          }
+        }
+        if (stream.error() != 0) {
+          fail(makeErrnoError(stream.error(), FileErrorCode::ReadError,
+                              "Error reading directory", node->path));
+          return;
+        }
+        if (removed > 0) {
+          count(removed);
+        }
+        release(node);
+      }
+
+      // Drop one pending item of a directory, removing it and then its emptied ancestors
+      void release(std::shared_ptr<RemovalNode> node) {
+        while (node && node->pending.fetch_sub(1) == 1) {
+          const int rc = node->parentFd
+                             ? ::unlinkat(node->parentFd->get(), node->name.c_str(), AT_REMOVEDIR)
+                             : ::unlinkat(AT_FDCWD, node->path.c_str(), AT_REMOVEDIR);
+          if (rc == 0) {
+            count(1);
+          } else if (errno != ENOENT) {
+            fail(makeErrnoError(errno, FileErrorCode::WriteError, "Failed to remove directory",
+                                node->path));
+            return;
+          }
+          node = node->parent;
+        }
+      }
+
+      WorkStealingQueues<std::shared_ptr<RemovalNode>> queues_;
+      const RemoveProgress &progress_;
+      std::atomic<std::uintmax_t> removed_{0};
+      std::mutex progressMutex_;
+      std::mutex errorMutex_;
+      std::optional<FileError> error_;
+    };
+  } // namespace
+#endif
+
+  Result<std::uintmax_t, FileError> removeTree(const std::filesystem::path &root,
+                                               ThreadPool *pool,
+                                               const RemoveProgress &progress) {
+#if defined(NIXONCPP_HAS_POSIX_IO)
+    struct stat info{};
+    if (::lstat(root.c_str(), &info) != 0) {
+      return makeErrnoError(errno, FileErrorCode::WriteError, "Failed to remove", root);
+    }
+    if (!S_ISDIR(info.st_mode)) {
+      if (::unlink(root.c_str()) != 0) {
+        return makeErrnoError(errno, FileErrorCode::WriteError, "Failed to remove", root);
+      }
+      if (progress) {
+        progress(1);
+      }
+      return std::uintmax_t{1};
+    }
+
+    ParallelRemoval removal((pool ? pool->threadCount() : 0) + 1, progress);
+    removal.run(root, pool);
+    return removal.result();
+#else
+    (void)pool;
+    std::error_code ec;
+    const auto removed = std::filesystem::remove_all(root, ec);
+    if (ec) {
+      return FileError{
+          .code = FileErrorCode::WriteError,
+          .message = fmt::format("Failed to remove directory recursively: {}", ec.message()),
+          .path = root.string(),
+      };
+    }
+    if (progress) {
+      progress(removed);
+    }
+    return removed;
+#endif
+  }
+
+} // namespace nixoncpp::utils::detail
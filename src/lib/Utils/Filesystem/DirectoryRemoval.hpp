@@ -0,0 +1,44 @@
+#pragma once
+
+#include <Utils/UtilsError.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+
+namespace nixoncpp::utils {
+
+  class ThreadPool;
+
+  /**
+   * @brief Progress of IDirectoryManager::removeDirectoryRecursive(), called with the number
+   * of entries removed so far, each time a directory has been emptied
+   *
+   * Calls are serialized and the count never decreases, but they may come from pool threads.
+   */
+  using RemoveProgress = std::function<void(std::uintmax_t removed)>;
+
+  namespace detail {
+
+    /**
+     * @brief Remove a directory tree, emptying directories in parallel on the pool
+     *
+     * Directories are listed with getdents64 and their entries unlinked with unlinkat(2)
+     * relative to the directory's descriptor, so no entry is looked up by its full path or
+     * stat'ed unless the filesystem does not report its type. Subdirectories are spread over
+     * the pool like the directories of detail::walkDirectory(), and each directory is removed
+     * as soon as its last subdirectory is. Symlinks are removed, never followed. Other
+     * platforms use std::filesystem::remove_all().
+     *
+     * @param root Removed itself as well; a symlink or file is just unlinked
+     * @param pool May be null; must not be the pool the caller runs on
+     * @param progress May be empty
+     * @return Result<std::uintmax_t, FileError> Number of entries removed, root included
+     */
+    [[nodiscard]]
+    Result<std::uintmax_t, FileError> removeTree(const std::filesystem::path &root,
+                                                 ThreadPool *pool,
+                                                 const RemoveProgress &progress);
+
+  } // namespace detail
+
+} // namespace nixoncpp::utils
@@ -0,0 +1,432 @@
+#include "DirectorySnapshot.hpp"
+#include <Utils/Concurrency/ThreadPool.hpp>
+#include <Utils/Filesystem/Crc32c.hpp>
+#include <Utils/Filesystem/DirectoryStream.hpp>
+#include <algorithm>
+#include <chrono>
+#include <fmt/core.h>
+#include <optional>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+namespace nixoncpp::utils {
+
+  namespace {
+    constexpr std::string_view kMagic{"NXSNAP\0\1", 8}; // Format name and version
+    constexpr std::size_t kHeaderSize = kMagic.size() + 5 * sizeof(std::uint64_t);
+    constexpr std::size_t kRecordSize =
+        5 * sizeof(std::uint64_t) + 2 * sizeof(std::uint32_t) + sizeof(std::uint8_t);
+
+    template <typename T>
+    void putLittleEndian(std::string &out, T value) {
+      auto bits = static_cast<std::make_unsigned_t<T>>(value);
+      for (std::size_t byte = 0; byte < sizeof(T); ++byte) {
+        out.push_back(static_cast<char>(bits & 0xFFU));
+        bits = static_cast<std::make_unsigned_t<T>>(bits >> 8U);
+      }
+    }
+
+    template <typename T>
+    T getLittleEndian(std::string_view data, std::size_t &offset) {
+      std::make_unsigned_t<T> bits = 0;
+      for (std::size_t byte = 0; byte < sizeof(T); ++byte) {
+        const auto value = static_cast<unsigned char>(data[offset + byte]);
+        bits |= static_cast<std::make_unsigned_t<T>>(value) << (8 * byte);
+      }
+      offset += sizeof(T);
+      return static_cast<T>(bits);
+    }
+
+    FileError corruptSnapshot(std::string_view detail) {
+      return FileError{
+          .code = FileErrorCode::ReadError,
+          .message = fmt::format("Corrupt directory snapshot: {}", detail),
+          .path = "",
+      };
+    }
+
+    std::string_view parentOf(std::string_view relativePath) noexcept {
+      const auto slash = relativePath.rfind('/');
+      return slash == std::string_view::npos ? std::string_view() : relativePath.substr(0, slash);
+    }
+
+    bool isModified(const SnapshotRecord &before, const SnapshotRecord &after) noexcept {
+      if (before.type != after.type || before.inode != after.inode) {
+        return true;
+      }
+      // A directory's size and mtime change with its entries, which are compared themselves
+      return before.type != EntryType::Directory &&
+             (before.size != after.size || before.modifiedNs != after.modifiedNs);
+    }
+  } // namespace
+
+  void DirectorySnapshot::Builder::setRoot(std::uint64_t inode, std::int64_t modifiedNs,
+                                           std::int64_t scanStartNs) {
+    rootInode_ = inode;
+    rootModifiedNs_ = modifiedNs;
+    scanStartNs_ = scanStartNs;
+  }
+
+  void DirectorySnapshot::Builder::add(std::string_view relativePath, EntryType type,
+                                       const EntryStat &stat) {
+    records_.push_back(SnapshotRecord{
+        .pathHash = hashPath(relativePath),
+        .parentHash = hashPath(parentOf(relativePath)),
+        .inode = stat.inode,
+        .size = stat.size,
+        .modifiedNs = stat.modifiedNs,
+        .pathOffset = static_cast<std::uint32_t>(paths_.size()),
+        .pathLength = static_cast<std::uint32_t>(relativePath.size()),
+        .type = type,
+    });
+    paths_.append(relativePath);
+  }
+
+  DirectorySnapshot DirectorySnapshot::Builder::finish() && {
+    DirectorySnapshot snapshot;
+    snapshot.paths_ = std::move(paths_);
+    snapshot.records_ = std::move(records_);
+    snapshot.rootInode_ = rootInode_;
+    snapshot.rootModifiedNs_ = rootModifiedNs_;
+    snapshot.scanStartNs_ = scanStartNs_;
+    std::sort(snapshot.records_.begin(), snapshot.records_.end(),
+              [&snapshot](const SnapshotRecord &a, const SnapshotRecord &b) {
+                if (a.pathHash != b.pathHash) {
+                  return a.pathHash < b.pathHash;
+                }
+                return snapshot.pathOf(a) < snapshot.pathOf(b);
+              });
+    return snapshot;
+  }
+
+  std::uint64_t DirectorySnapshot::hashPath(std::string_view relativePath) noexcept {
+    std::uint64_t hash = 0xCBF29CE484222325ULL;
+    for (const char c : relativePath) {
+      hash ^= static_cast<unsigned char>(c);
+      hash *= 0x100000001B3ULL;
+    }
+    return hash;
+  }
+
+  std::string DirectorySnapshot::serialize() const {
+    std::string out;
+    out.reserve(kHeaderSize + records_.size() * kRecordSize + paths_.size() +
+                sizeof(std::uint32_t));
+    out.append(kMagic);
+    putLittleEndian(out, rootInode_);
+    putLittleEndian(out, rootModifiedNs_);
+    putLittleEndian(out, scanStartNs_);
+    putLittleEndian(out, static_cast<std::uint64_t>(records_.size()));
+    putLittleEndian(out, static_cast<std::uint64_t>(paths_.size()));
+    for (const auto &record : records_) {
+      putLittleEndian(out, record.pathHash);
+      putLittleEndian(out, record.parentHash);
+      putLittleEndian(out, record.inode);
+      putLittleEndian(out, static_cast<std::uint64_t>(record.size));
+      putLittleEndian(out, record.modifiedNs);
+      putLittleEndian(out, record.pathOffset);
+      putLittleEndian(out, record.pathLength);
+      out.push_back(static_cast<char>(record.type));
+    }
+    out.append(paths_);
+    const auto crc = crc32c(0, std::as_bytes(std::span(out.data(), out.size())));
+    putLittleEndian(out, crc);
+    return out;
+  }
+
+  Result<DirectorySnapshot, FileError> DirectorySnapshot::deserialize(std::string_view data) {
+    if (data.size() < kHeaderSize + sizeof(std::uint32_t) || !data.starts_with(kMagic)) {
+      return corruptSnapshot("not a directory snapshot");
+    }
+    auto crcOffset = data.size() - sizeof(std::uint32_t);
+    const auto expectedCrc = getLittleEndian<std::uint32_t>(data, crcOffset);
+    if (crc32c(0, std::as_bytes(std::span(data.data(), data.size() - sizeof(std::uint32_t)))) !=
+        expectedCrc) {
+      return corruptSnapshot("checksum mismatch");
+    }
+
+    DirectorySnapshot snapshot;
+    std::size_t offset = kMagic.size();
+    snapshot.rootInode_ = getLittleEndian<std::uint64_t>(data, offset);
+    snapshot.rootModifiedNs_ = getLittleEndian<std::int64_t>(data, offset);
+    snapshot.scanStartNs_ = getLittleEndian<std::int64_t>(data, offset);
+    const auto count = getLittleEndian<std::uint64_t>(data, offset);
+    const auto pathBytes = getLittleEndian<std::uint64_t>(data, offset);
+    const auto available = data.size() - kHeaderSize - sizeof(std::uint32_t);
+    if (count > available / kRecordSize || pathBytes != available - count * kRecordSize) {
+      return corruptSnapshot("sizes do not match the data");
+    }
+
+    snapshot.records_.reserve(count);
+    for (std::uint64_t index = 0; index < count; ++index) {
+      SnapshotRecord record;
+      record.pathHash = getLittleEndian<std::uint64_t>(data, offset);
+      record.parentHash = getLittleEndian<std::uint64_t>(data, offset);
+      record.inode = getLittleEndian<std::uint64_t>(data, offset);
+      record.size = getLittleEndian<std::uint64_t>(data, offset);
+      record.modifiedNs = getLittleEndian<std::int64_t>(data, offset);
+      record.pathOffset = getLittleEndian<std::uint32_t>(data, offset);
+      record.pathLength = getLittleEndian<std::uint32_t>(data, offset);
+      const auto type = static_cast<std::uint8_t>(data[offset++]);
+      if (type > static_cast<std::uint8_t>(EntryType::Other) ||
+          std::uint64_t{record.pathOffset} + record.pathLength > pathBytes) {
+        return corruptSnapshot("record out of range");
+      }
+      if (!snapshot.records_.empty() && record.pathHash < snapshot.records_.back().pathHash) {
+        return corruptSnapshot("records out of order");
+      }
+      record.type = static_cast<EntryType>(type);
+      snapshot.records_.push_back(record);
+    }
+    snapshot.paths_.assign(data.substr(offset, pathBytes));
+    return snapshot;
+  }
+
+  SnapshotDiff DirectorySnapshot::diff(const DirectorySnapshot &newer) const {
+    SnapshotDiff changes;
+    const auto &before = records_;
+    const auto &after = newer.records_;
+    std::size_t i = 0;
+    std::size_t j = 0;
+    while (i < before.size() || j < after.size()) {
+      int order = 0;
+      if (i == before.size()) {
+        order = 1;
+      } else if (j == after.size()) {
+        order = -1;
+      } else if (before[i].pathHash != after[j].pathHash) {
+        order = before[i].pathHash < after[j].pathHash ? -1 : 1;
+      } else {
+        const auto comparison = pathOf(before[i]).compare(newer.pathOf(after[j]));
+        order = comparison < 0 ? -1 : (comparison > 0 ? 1 : 0);
+      }
+
+      if (order < 0) {
+        changes.removed.emplace_back(pathOf(before[i++]));
+      } else if (order > 0) {
+        changes.added.emplace_back(newer.pathOf(after[j++]));
+      } else {
+        if (isModified(before[i], after[j])) {
+          changes.modified.emplace_back(newer.pathOf(after[j]));
+        }
+        ++i;
+        ++j;
+      }
+    }
+    return changes;
+  }
+
+  const SnapshotRecord *DirectorySnapshot::find(std::string_view relativePath) const noexcept {
+    const auto hash = hashPath(relativePath);
+    auto it = std::lower_bound(records_.begin(), records_.end(), hash,
+                               [](const SnapshotRecord &record, std::uint64_t value) {
+                                 return record.pathHash < value;
+                               });
+    for (; it != records_.end() && it->pathHash == hash; ++it) {
+      if (pathOf(*it) == relativePath) {
+        return &*it;
+      }
+    }
+    return nullptr;
+  }
+
+} // namespace nixoncpp::utils
+
+namespace nixoncpp::utils::detail {
+
+  namespace {
+    std::int64_t nowNs() {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                 std::chrono::system_clock::now().time_since_epoch())
+          .count();
+    }
+
+    // Timestamps come from a clock that may lag real time by a tick, and some filesystems
+    // store whole seconds; a directory changed this close to a scan may keep its mtime
+    constexpr std::int64_t kRacyWindowNs = 2'000'000'000;
+
+    Result<DirectorySnapshot, FileError> fullScan(const std::filesystem::path &root,
+                                                  std::int64_t scanStartNs, ThreadPool *pool) {
+      WalkOptions options;
+      options.withStat = true;
+      auto entries = walkDirectory(root, options, pool);
+      if (!entries) {
+        return entries.error();
+      }
+
+      DirectorySnapshot::Builder builder;
+#if defined(NIXONCPP_HAS_POSIX_IO)
+      struct stat info{};
+      if (::stat(root.c_str(), &info) != 0) {
+        return makeErrnoError(errno, FileErrorCode::ReadError, "Failed to stat directory", root);
+      }
+      const auto rootStat = entryStatFrom(info);
+      builder.setRoot(rootStat.inode, rootStat.modifiedNs, scanStartNs);
+#else
+      std::error_code ec;
+      const auto modified = std::filesystem::last_write_time(root, ec).time_since_epoch();
+      builder.setRoot(0, std::chrono::duration_cast<std::chrono::nanoseconds>(modified).count(),
+                      scanStartNs);
+#endif
+      const auto rootLength = [&root] {
+        const auto generic = root.generic_string();
+        return generic.ends_with('/') ? generic.size() : generic.size() + 1;
+      }();
+      for (const auto &entry : entries.value()) {
+        const auto path = entry.path.generic_string();
+        builder.add(std::string_view(path).substr(rootLength), entry.type,
+                    entry.stat.value_or(EntryStat{}));
+      }
+      return std::move(builder).finish();
+    }
+
+#if defined(NIXONCPP_HAS_POSIX_IO)
+    /**
+     * @brief Depth-first rescan that lists only the directories changed since a snapshot
+     *
+     * Entries of an unchanged directory are stat'ed by their recorded names.
+     */
+    class IncrementalScan {
+    public:
+      IncrementalScan(const DirectorySnapshot &previous, std::int64_t scanStartNs)
+          : previous_(previous), trustedBeforeNs_(previous.scanStartNs() - kRacyWindowNs),
+            scanStartNs_(scanStartNs) {
+        for (std::uint32_t index = 0; index < previous.records().size(); ++index) {
+          children_[previous.records()[index].parentHash].push_back(index);
+        }
+      }
+
+      Result<DirectorySnapshot, FileError> run(const std::filesystem::path &root) {
+        auto fd = openDirectoryAt(AT_FDCWD, root.c_str(), true);
+        struct stat info{};
+        if (!fd || ::fstat(fd.get(), &info) != 0) {
+          return makeErrnoError(errno, FileErrorCode::ReadError, "Failed to open directory",
+                                root);
+        }
+        const auto rootStat = entryStatFrom(info);
+        builder_.setRoot(rootStat.inode, rootStat.modifiedNs, scanStartNs_);
+        const bool unchanged = rootStat.inode == previous_.rootInode() &&
+                               rootStat.modifiedNs == previous_.rootModifiedNs();
+        std::string relative;
+        visit(fd.get(), root, relative, unchanged && isTrusted(rootStat.modifiedNs));
+        if (error_) {
+          return *error_;
+        }
+        return std::move(builder_).finish();
+      }
+
+    private:
+      [[nodiscard]]
+      bool isTrusted(std::int64_t modifiedNs) const noexcept {
+        return modifiedNs < trustedBeforeNs_;
+      }
+
+      // relative is the directory's path, extended in place for its entries
+      void visit(int dirFd, const std::filesystem::path &path, std::string &relative,
+                 bool unchanged) {
+        const auto baseLength = relative.size();
+        const auto enterName = [&relative, baseLength](std::string_view name) {
+          relative.resize(baseLength);
+          if (baseLength > 0) {
+            relative.push_back('/');
+          }
+          relative.append(name);
+        };
+
+        if (unchanged) {
+          const auto known = children_.find(DirectorySnapshot::hashPath(relative));
+          if (known == children_.end()) {
+            return;
+          }
+          for (const auto index : known->second) {
+            const auto &record = previous_.records()[index];
+            const auto recordPath = previous_.pathOf(record);
+            if (parentOf(recordPath) != std::string_view(relative).substr(0, baseLength)) {
+              continue; // Another directory whose path has the same hash
+            }
+            // The names are known, but files may have been written in place: stat each one
+            const auto name = recordPath.substr(recordPath.rfind('/') + 1);
+            enterName(name);
+            addEntry(dirFd, name, path, relative, &record);
+            if (error_) {
+              return;
+            }
+          }
+          relative.resize(baseLength);
+          return;
+        }
+
+        DirectoryStream stream(dirFd);
+        RawDirectoryEntry raw;
+        while (!error_ && stream.next(raw)) {
+          enterName(raw.name);
+          addEntry(dirFd, raw.name, path, relative, previous_.find(relative));
+        }
+        if (!error_ && stream.error() != 0) {
+          error_ = makeErrnoError(stream.error(), FileErrorCode::ReadError,
+                                  "Error reading directory", path);
+        }
+        relative.resize(baseLength);
+      }
+
+      // Stat an entry of the directory being visited and descend if it is a directory
+      void addEntry(int dirFd, std::string_view name, const std::filesystem::path &directory,
+                    std::string &relative, const SnapshotRecord *before) {
+        const std::string ownedName(name); // Names from a snapshot are not NUL-terminated
+        struct stat info{};
+        if (::fstatat(dirFd, ownedName.c_str(), &info, AT_SYMLINK_NOFOLLOW) != 0) {
+          if (errno != ENOENT) {
+            error_ = makeErrnoError(errno, FileErrorCode::ReadError, "Failed to stat entry",
+                                    directory / ownedName);
+          }
+          return;
+        }
+        const auto stat = entryStatFrom(info);
+        const auto type = entryTypeFromMode(info.st_mode);
+        builder_.add(relative, type, stat);
+        if (type != EntryType::Directory) {
+          return;
+        }
+
+        auto fd = openDirectoryAt(dirFd, ownedName.c_str(), false);
+        if (!fd) {
+          if (errno != ENOENT) {
+            error_ = makeErrnoError(errno, FileErrorCode::ReadError, "Failed to open directory",
+                                    directory / ownedName);
+          }
+          return;
+        }
+        const bool unchanged = before != nullptr && before->type == EntryType::Directory &&
+                               before->inode == stat.inode &&
+                               before->modifiedNs == stat.modifiedNs && isTrusted(stat.modifiedNs);
+        visit(fd.get(), directory / ownedName, relative, unchanged);
+      }
+
+      const DirectorySnapshot &previous_;
+      const std::int64_t trustedBeforeNs_;
+      const std::int64_t scanStartNs_;
+      std::unordered_map<std::uint64_t, std::vector<std::uint32_t>> children_; // By parentHash
+      DirectorySnapshot::Builder builder_;
+      std::optional<FileError> error_;
+    };
+#endif
+  } // namespace
+
+  Result<DirectorySnapshot, FileError> scanDirectory(const std::filesystem::path &root,
+                                                     const DirectorySnapshot *previous,
+                                                     const RescanOptions &options,
+                                                     ThreadPool *pool) {
+    const auto scanStartNs = nowNs();
+#if defined(NIXONCPP_HAS_POSIX_IO)
+    if (previous != nullptr && options.skipUnchangedDirectories) {
+      return IncrementalScan(*previous, scanStartNs).run(root);
+    }
+#else
+    (void)previous;
+    (void)options;
+#endif
+    return fullScan(root, scanStartNs, pool);
+  }
+
+} // namespace nixoncpp::utils::detail
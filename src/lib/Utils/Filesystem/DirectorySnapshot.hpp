@@ -0,0 +1,214 @@
+#pragma once
+
+#include <Utils/Filesystem/DirectoryWalk.hpp>
+#include <Utils/UtilsError.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace nixoncpp::utils {
+
+  class ThreadPool;
+
+  /**
+   * @brief Entry of a DirectorySnapshot
+   */
+  struct SnapshotRecord {
+    std::uint64_t pathHash = 0;   // Of the path relative to the snapshot root
+    std::uint64_t parentHash = 0; // pathHash of the containing directory ("" for the root)
+    std::uint64_t inode = 0;
+    std::uintmax_t size = 0;
+    std::int64_t modifiedNs = 0;
+    std::uint32_t pathOffset = 0; // Into the snapshot's path table
+    std::uint32_t pathLength = 0;
+    EntryType type = EntryType::Unknown;
+  };
+
+  /**
+   * @brief Changes between two snapshots of a directory, as paths relative to its root
+   */
+  struct SnapshotDiff {
+    std::vector<std::filesystem::path> added;
+    std::vector<std::filesystem::path> removed;
+    // Files whose type, inode, size or mtime changed; directories whose type or inode changed
+    std::vector<std::filesystem::path> modified;
+
+    [[nodiscard]]
+    bool empty() const noexcept {
+      return added.empty() && removed.empty() && modified.empty();
+    }
+  };
+
+  /**
+   * @brief Behaviour of IDirectoryManager::rescan()
+   */
+  struct RescanOptions {
+    // Take the names in a directory whose inode and mtime match the previous snapshot from it
+    // instead of listing the directory; each of them is still stat'ed, so in-place writes to
+    // existing files are seen. A directory's mtime changes whenever an entry is created,
+    // removed or renamed in it, so the known names are complete. Directories modified shortly
+    // before the previous scan began are always listed, as their mtime may not have moved since.
+    bool skipUnchangedDirectories = true;
+  };
+
+  /**
+   * @brief Compact record of a directory tree: type, inode, size and mtime of every entry
+   *
+   * Records are kept sorted by the hash of their relative path, with the paths themselves in
+   * one shared table, so two snapshots are compared in a single merge pass and looking up a
+   * path is a binary search. Snapshots serialize to a checksummed binary format.
+   */
+  class DirectorySnapshot final {
+  public:
+    /**
+     * @brief Collects the entries of a snapshot in any order
+     */
+    class Builder {
+    public:
+      /**
+       * @brief Set the identity of the snapshot root and when the scan began
+       *
+       * @param inode
+       * @param modifiedNs
+       * @param scanStartNs Nanoseconds since the Unix epoch
+       */
+      void setRoot(std::uint64_t inode, std::int64_t modifiedNs, std::int64_t scanStartNs);
+
+      /**
+       * @brief Add an entry
+       *
+       * @param relativePath '/'-separated, relative to the root
+       * @param type
+       * @param stat
+       */
+      void add(std::string_view relativePath, EntryType type, const EntryStat &stat);
+
+      /**
+       * @brief Sort the records into a snapshot
+       *
+       * @return DirectorySnapshot
+       */
+      [[nodiscard]]
+      DirectorySnapshot finish() &&;
+
+    private:
+      std::vector<SnapshotRecord> records_;
+      std::string paths_;
+      std::uint64_t rootInode_ = 0;
+      std::int64_t rootModifiedNs_ = 0;
+      std::int64_t scanStartNs_ = 0;
+    };
+
+    DirectorySnapshot() = default;
+
+    /**
+     * @brief Hash used for SnapshotRecord::pathHash (64-bit FNV-1a, stable across runs)
+     *
+     * @param relativePath
+     * @return std::uint64_t
+     */
+    [[nodiscard]]
+    static std::uint64_t hashPath(std::string_view relativePath) noexcept;
+
+    /**
+     * @brief Parse a snapshot written by serialize()
+     *
+     * @param data
+     * @return Result<DirectorySnapshot, FileError> ReadError if the data is corrupt
+     */
+    [[nodiscard]]
+    static Result<DirectorySnapshot, FileError> deserialize(std::string_view data);
+
+    /**
+     * @brief Binary form: header, fixed-size little-endian records, path table, CRC-32C
+     *
+     * @return std::string
+     */
+    [[nodiscard]]
+    std::string serialize() const;
+
+    /**
+     * @brief Compare with a later snapshot of the same directory in one pass over both
+     *
+     * @param newer
+     * @return SnapshotDiff Paths in hash order
+     */
+    [[nodiscard]]
+    SnapshotDiff diff(const DirectorySnapshot &newer) const;
+
+    /**
+     * @brief Record of a path
+     *
+     * @param relativePath '/'-separated, relative to the root
+     * @return const SnapshotRecord* Null if the path is not in the snapshot
+     */
+    [[nodiscard]]
+    const SnapshotRecord *find(std::string_view relativePath) const noexcept;
+
+    [[nodiscard]]
+    std::string_view pathOf(const SnapshotRecord &record) const noexcept {
+      return std::string_view(paths_).substr(record.pathOffset, record.pathLength);
+    }
+
+    [[nodiscard]]
+    std::span<const SnapshotRecord> records() const noexcept {
+      return records_;
+    }
+
+    [[nodiscard]]
+    std::size_t size() const noexcept {
+      return records_.size();
+    }
+
+    [[nodiscard]]
+    std::uint64_t rootInode() const noexcept {
+      return rootInode_;
+    }
+
+    [[nodiscard]]
+    std::int64_t rootModifiedNs() const noexcept {
+      return rootModifiedNs_;
+    }
+
+    [[nodiscard]]
+    std::int64_t scanStartNs() const noexcept {
+      return scanStartNs_;
+    }
+
+  private:
+    std::vector<SnapshotRecord> records_; // Sorted by (pathHash, path)
+    std::string paths_;
+    std::uint64_t rootInode_ = 0;
+    std::int64_t rootModifiedNs_ = 0;
+    std::int64_t scanStartNs_ = 0;
+  };
+
+  namespace detail {
+
+    /**
+     * @brief Snapshot a directory tree
+     *
+     * Without a previous snapshot the tree is read with detail::walkDirectory() on the pool.
+     * With one and RescanOptions::skipUnchangedDirectories, directories are visited on the
+     * calling thread and only those that changed since the previous scan are listed; the
+     * entries of the others are stat'ed by the names the previous snapshot recorded.
+     *
+     * @param root Must be an existing directory
+     * @param previous May be null
+     * @param options
+     * @param pool May be null; must not be the pool the caller runs on
+     * @return Result<DirectorySnapshot, FileError>
+     */
+    [[nodiscard]]
+    Result<DirectorySnapshot, FileError> scanDirectory(const std::filesystem::path &root,
+                                                       const DirectorySnapshot *previous,
+                                                       const RescanOptions &options,
+                                                       ThreadPool *pool);
+
+  } // namespace detail
+
+} // namespace nixoncpp::utils
@@ -0,0 +1,214 @@
+#include "DirectoryStream.hpp"
+
+#if defined(NIXONCPP_HAS_POSIX_IO)
+#include <cstring>
+#include <dirent.h>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+namespace nixoncpp::utils::detail {
+
+  namespace {
+    EntryType entryTypeFromDirent(unsigned char type) noexcept {
+      switch (type) {
+      case DT_REG: return EntryType::Regular;
+      case DT_DIR: return EntryType::Directory;
+      case DT_LNK: return EntryType::Symlink;
+      case DT_UNKNOWN: return EntryType::Unknown;
+      default: return EntryType::Other;
+      }
+    }
+
+    bool isDotOrDotDot(std::string_view name) noexcept {
+      return name == "." || name == "..";
+    }
+
+#if defined(__linux__)
+    // Field offsets of struct linux_dirent64; the records have variable length, so fields are
+    // copied out instead of reading the buffer through a struct
+    constexpr std::size_t kRecordLengthOffset = 16;
+    constexpr std::size_t kTypeOffset = 18;
+    constexpr std::size_t kNameOffset = 19;
+#endif
+  } // namespace
+
+  EntryType entryTypeFromMode(mode_t mode) noexcept {
+    if (S_ISREG(mode)) {
+      return EntryType::Regular;
+    }
+    if (S_ISDIR(mode)) {
+      return EntryType::Directory;
+    }
+    if (S_ISLNK(mode)) {
+      return EntryType::Symlink;
+    }
+    return EntryType::Other;
+  }
+
+  EntryStat entryStatFrom(const struct stat &info) noexcept {
+#if defined(__APPLE__)
+    const auto &modified = info.st_mtimespec;
+#else
+    const auto &modified = info.st_mtim;
+#endif
+    return EntryStat{
+        .size = static_cast<std::uintmax_t>(info.st_size),
+        .modifiedNs = static_cast<std::int64_t>(modified.tv_sec) * 1'000'000'000 +
+                      static_cast<std::int64_t>(modified.tv_nsec),
+        .inode = static_cast<std::uint64_t>(info.st_ino),
+        .device = static_cast<std::uint64_t>(info.st_dev),
+        .mode = static_cast<std::uint32_t>(info.st_mode),
+    };
+  }
+
+  int resolveEntry(int dirFd, const RawDirectoryEntry &raw, const std::filesystem::path &directory,
+                   std::size_t rootLength, std::size_t depth, const WalkOptions &options,
+                   DirectoryEntry &entry, EntryDecision &decision) {
+    decision = EntryDecision{};
+    auto type = raw.type;
+    struct stat info{};
+    bool haveStat = false;
+    const auto statEntry = [&] {
+      if (::fstatat(dirFd, raw.name.data(), &info, AT_SYMLINK_NOFOLLOW) != 0) {
+        return errno;
+      }
+      haveStat = true;
+      type = entryTypeFromMode(info.st_mode);
+      return 0;
+    };
+
+    if (type == EntryType::Unknown || options.withStat) {
+      if (const int err = statEntry(); err != 0) {
+        return err;
+      }
+    }
+    if (type == EntryType::Symlink && options.symlinks == SymlinkPolicy::Skip) {
+      return 0;
+    }
+
+    const bool canDescend = depth < options.maxDepth;
+    bool followLink = false;
+    if (type == EntryType::Symlink && options.symlinks == SymlinkPolicy::Follow && canDescend) {
+      struct stat target{};
+      followLink = ::fstatat(dirFd, raw.name.data(), &target, 0) == 0 && S_ISDIR(target.st_mode);
+    }
+    bool descend = (type == EntryType::Directory || followLink) && canDescend;
+    bool report = options.filter.acceptsName(raw.name, type);
+    if (!report && !descend) {
+      return 0;
+    }
+
+    entry.path = directory / raw.name;
+    if (const auto &glob = options.filter.glob) {
+      const auto relative = std::string_view(entry.path.native()).substr(rootLength);
+      report = report && glob->matches(relative);
+      descend = descend && glob->canMatchBelow(relative);
+      if (!report && !descend) {
+        return 0;
+      }
+    }
+    if (report && !haveStat && options.filter.needsStat()) {
+      if (const int err = statEntry(); err != 0) {
+        return err;
+      }
+    }
+    entry.type = type;
+    entry.depth = depth;
+    entry.stat = haveStat ? std::optional(entryStatFrom(info)) : std::nullopt;
+
+    decision.report = report && options.filter.acceptsEntry(entry);
+    decision.descend = descend && !(options.prune && options.prune(entry));
+    decision.viaSymlink = followLink;
+    return 0;
+  }
+
+  std::size_t relativePathOffset(const std::filesystem::path &root) noexcept {
+    const auto &native = root.native();
+    return native.ends_with('/') ? native.size() : native.size() + 1;
+  }
+
+  UniqueFd openDirectoryAt(int dirFd, const char *name, bool followSymlink) {
+    const int flags = O_RDONLY | O_DIRECTORY | O_CLOEXEC | (followSymlink ? 0 : O_NOFOLLOW);
+    int fd = -1;
+    do {
+      fd = ::openat(dirFd, name, flags);
+    } while (fd < 0 && errno == EINTR);
+    return UniqueFd{fd};
+  }
+
+#if defined(__linux__)
+  DirectoryStream::DirectoryStream(int dirFd)
+      : fd_(dirFd), buffer_(std::make_unique_for_overwrite<std::byte[]>(kBufferSize)) {}
+
+  bool DirectoryStream::next(RawDirectoryEntry &entry) {
+    for (;;) {
+      if (offset_ >= used_) {
+        const auto got = ::syscall(SYS_getdents64, fd_, buffer_.get(), kBufferSize);
+        if (got < 0) {
+          if (errno == EINTR) {
+            continue;
+          }
+          error_ = errno;
+          return false;
+        }
+        if (got == 0) {
+          return false;
+        }
+        used_ = static_cast<std::size_t>(got);
+        offset_ = 0;
+      }
+
+      const auto *record = buffer_.get() + offset_;
+      unsigned short length = 0;
+      std::memcpy(&length, record + kRecordLengthOffset, sizeof(length));
+      offset_ += length;
+
+      const auto *name = reinterpret_cast<const char *>(record + kNameOffset);
+      entry.name = std::string_view(name);
+      if (isDotOrDotDot(entry.name)) {
+        continue;
+      }
+      entry.type = entryTypeFromDirent(static_cast<unsigned char>(record[kTypeOffset]));
+      return true;
+    }
+  }
+#else
+  DirectoryStream::DirectoryStream(int dirFd) {
+    // fdopendir() takes ownership of its descriptor, which stays with the caller here
+    const int copy = ::dup(dirFd);
+    if (copy < 0) {
+      error_ = errno;
+      return;
+    }
+    dir_.reset(::fdopendir(copy));
+    if (!dir_) {
+      error_ = errno;
+      ::close(copy);
+    }
+  }
+
+  bool DirectoryStream::next(RawDirectoryEntry &entry) {
+    if (!dir_) {
+      return false;
+    }
+    for (;;) {
+      errno = 0;
+      const auto *record = ::readdir(dir_.get());
+      if (record == nullptr) {
+        error_ = errno;
+        return false;
+      }
+      entry.name = std::string_view(record->d_name);
+      if (isDotOrDotDot(entry.name)) {
+        continue;
+      }
+      entry.type = entryTypeFromDirent(record->d_type);
+      return true;
+    }
+  }
+#endif
+
+} // namespace nixoncpp::utils::detail
+#endif
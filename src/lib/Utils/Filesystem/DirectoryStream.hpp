@@ -0,0 +1,148 @@
+#pragma once
+
+#include <Utils/Filesystem/DirectoryWalk.hpp>
+#include <Utils/Filesystem/PosixIo.hpp>
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+#if defined(NIXONCPP_HAS_POSIX_IO) && !defined(__linux__)
+#include <dirent.h>
+#endif
+
+// Raw directory enumeration shared by the POSIX paths of the directory utilities.
+
+namespace nixoncpp::utils::detail {
+
+#if defined(NIXONCPP_HAS_POSIX_IO)
+  /**
+   * @brief Entry of a directory as returned by the kernel
+   */
+  struct RawDirectoryEntry {
+    std::string_view name; // NUL-terminated; valid until the next DirectoryStream::next()
+    EntryType type = EntryType::Unknown; // Unknown when the filesystem reports no d_type
+  };
+
+  /**
+   * @brief EntryType of a st_mode value
+   *
+   * @param mode
+   * @return EntryType
+   */
+  [[nodiscard]]
+  EntryType entryTypeFromMode(mode_t mode) noexcept;
+
+  /**
+   * @brief EntryStat of a stat result
+   *
+   * @param info
+   * @return EntryStat
+   */
+  [[nodiscard]]
+  EntryStat entryStatFrom(const struct stat &info) noexcept;
+
+  /**
+   * @brief What a walk does with an entry, as decided by resolveEntry()
+   */
+  struct EntryDecision {
+    bool report = false;     // Passes the filter
+    bool descend = false;    // Directory (or followed symlink) to read next
+    bool viaSymlink = false; // descend goes through a symlink
+  };
+
+  /**
+   * @brief Build the DirectoryEntry of a raw entry and apply the walk options to it
+   *
+   * Stats the entry only when its type is unknown, the options ask for stat data or the
+   * filter's size and time bounds need it for an entry that passed the name and glob checks.
+   * Entries rejected by the name checks are left without a path.
+   *
+   * @param dirFd Directory being read
+   * @param raw
+   * @param directory Path of the directory being read
+   * @param rootLength Length of the prefix of entry paths that names the walked directory
+   * (see relativePathOffset()), stripped before glob matching
+   * @param depth Depth of the entries of that directory
+   * @param options
+   * @param entry Receives the entry
+   * @param decision Receives whether to report and descend
+   * @return int 0, or the errno of a failed stat (ENOENT when the entry vanished)
+   */
+  [[nodiscard]]
+  int resolveEntry(int dirFd, const RawDirectoryEntry &raw, const std::filesystem::path &directory,
+                   std::size_t rootLength, std::size_t depth, const WalkOptions &options,
+                   DirectoryEntry &entry, EntryDecision &decision);
+
+  /**
+   * @brief Offset of the path relative to root in the paths of the entries below it
+   *
+   * @param root
+   * @return std::size_t
+   */
+  [[nodiscard]]
+  std::size_t relativePathOffset(const std::filesystem::path &root) noexcept;
+
+  /**
+   * @brief openat(2) a directory for reading, retrying on EINTR
+   *
+   * @param dirFd Directory the name is relative to, or AT_FDCWD
+   * @param name
+   * @param followSymlink Whether a symlink named by the last component is followed
+   * @return UniqueFd Invalid on failure, errno is preserved
+   */
+  [[nodiscard]]
+  UniqueFd openDirectoryAt(int dirFd, const char *name, bool followSymlink);
+
+  /**
+   * @brief Batched reader of the entries of an open directory, skipping "." and ".."
+   *
+   * Linux reads with getdents64 into a 32 KiB buffer, so one system call returns hundreds of
+   * entries; other systems use readdir(3) on a duplicate of the descriptor. The descriptor is
+   * not owned and must outlive the stream.
+   */
+  class DirectoryStream final {
+  public:
+    static constexpr std::size_t kBufferSize = 32 * 1024;
+
+    explicit DirectoryStream(int dirFd);
+    DirectoryStream(const DirectoryStream &) = delete;
+    DirectoryStream &operator=(const DirectoryStream &) = delete;
+    DirectoryStream(DirectoryStream &&) noexcept = default;
+    DirectoryStream &operator=(DirectoryStream &&) noexcept = default;
+    ~DirectoryStream() = default;
+
+    /**
+     * @brief Advance to the next entry
+     *
+     * @param entry
+     * @return false at the end of the directory or on error (see error())
+     */
+    bool next(RawDirectoryEntry &entry);
+
+    /**
+     * @brief errno of the failure that ended the listing, 0 if none
+     *
+     * @return int
+     */
+    [[nodiscard]]
+    int error() const noexcept {
+      return error_;
+    }
+
+  private:
+    int error_ = 0;
+#if defined(__linux__)
+    int fd_ = -1;
+    std::unique_ptr<std::byte[]> buffer_;
+    std::size_t used_ = 0;
+    std::size_t offset_ = 0;
+#else
+    struct DirClose {
+      void operator()(DIR *dir) const noexcept { ::closedir(dir); }
+    };
+    std::unique_ptr<DIR, DirClose> dir_;
+#endif
+  };
+#endif
+
+} // namespace nixoncpp::utils::detail
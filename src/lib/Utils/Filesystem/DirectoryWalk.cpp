@@ -0,0 +1,231 @@
+#include "DirectoryWalk.hpp"
+#include <Utils/Filesystem/DirectoryRange.hpp>
+#include <Utils/Concurrency/ThreadPool.hpp>
+#include <Utils/Concurrency/WorkStealingQueues.hpp>
+#include <Utils/Filesystem/DirectoryStream.hpp>
+#include <algorithm>
+#include <fmt/core.h>
+#include <mutex>
+#include <utility>
+
+namespace nixoncpp::utils {
+
+  bool EntryFilter::needsStat() const noexcept {
+    return minSize || maxSize || modifiedAfterNs || modifiedBeforeNs;
+  }
+
+  bool EntryFilter::acceptsName(std::string_view name, EntryType type) const {
+    if (!types.empty() && std::find(types.begin(), types.end(), type) == types.end()) {
+      return false;
+    }
+    if (extensions.empty()) {
+      return true;
+    }
+    return std::any_of(extensions.begin(), extensions.end(), [name](const auto &extension) {
+      return name.size() > extension.size() && name.ends_with(extension);
+    });
+  }
+
+  bool EntryFilter::acceptsEntry(const DirectoryEntry &entry) const {
+    if (needsStat()) {
+      if (!entry.stat) {
+        return false;
+      }
+      const auto &stat = *entry.stat;
+      if ((minSize && stat.size < *minSize) || (maxSize && stat.size > *maxSize) ||
+          (modifiedAfterNs && stat.modifiedNs <= *modifiedAfterNs) ||
+          (modifiedBeforeNs && stat.modifiedNs >= *modifiedBeforeNs)) {
+        return false;
+      }
+    }
+    return !predicate || predicate(entry);
+  }
+
+} // namespace nixoncpp::utils
+
+namespace nixoncpp::utils::detail {
+
+#if defined(NIXONCPP_HAS_POSIX_IO)
+  namespace {
+    /**
+     * @brief Identity of a directory on the path from the root, kept when following symlinks
+     */
+    struct Ancestor {
+      dev_t device;
+      ino_t inode;
+      std::shared_ptr<const Ancestor> parent;
+    };
+
+    /**
+     * @brief Directory waiting to be read
+     */
+    struct WalkJob {
+      std::shared_ptr<const UniqueFd> parent; // Null for the root, which is opened by path
+      std::string name;                       // Relative to parent
+      std::filesystem::path path;
+      std::size_t depth = 0; // Depth of the entries inside
+      bool viaSymlink = false;
+      std::shared_ptr<const Ancestor> ancestors = nullptr; // Only under SymlinkPolicy::Follow
+    };
+
+    class ParallelWalk {
+    public:
+      ParallelWalk(const std::filesystem::path &root, const WalkOptions &options,
+                   std::size_t workers)
+          : options_(options), rootLength_(relativePathOffset(root)), queues_(workers),
+            results_(workers) {}
+
+      void run(const std::filesystem::path &root, ThreadPool *pool) {
+        queues_.push(0, WalkJob{.parent = nullptr, .name = root.string(), .path = root});
+        auto handle = [this](std::size_t worker, const WalkJob &job) {
+          readDirectory(worker, job);
+        };
+        queues_.runOn(pool, handle);
+      }
+
+      [[nodiscard]]
+      Result<std::vector<DirectoryEntry>, FileError> collect() {
+        if (error_) {
+          return *error_;
+        }
+        std::size_t total = 0;
+        for (const auto &part : results_) {
+          total += part.size();
+        }
+        std::vector<DirectoryEntry> entries;
+        entries.reserve(total);
+        for (auto &part : results_) {
+          std::move(part.begin(), part.end(), std::back_inserter(entries));
+        }
+        return entries;
+      }
+
+    private:
+      void fail(FileError error) {
+        {
+          const std::lock_guard lock(errorMutex_);
+          if (!error_) {
+            error_ = std::move(error);
+          }
+        }
+        queues_.stop();
+      }
+
+      // A symlink to a directory on the path from the root would be followed forever
+      static std::shared_ptr<const Ancestor> enter(const WalkJob &job, int fd) {
+        struct stat info{};
+        if (::fstat(fd, &info) != 0) {
+          info.st_dev = 0;
+          info.st_ino = 0;
+        } else if (job.viaSymlink) {
+          for (const auto *ancestor = job.ancestors.get(); ancestor != nullptr;
+               ancestor = ancestor->parent.get()) {
+            if (ancestor->device == info.st_dev && ancestor->inode == info.st_ino) {
+              return nullptr;
+            }
+          }
+        }
+        return std::make_shared<const Ancestor>(
+            Ancestor{.device = info.st_dev, .inode = info.st_ino, .parent = job.ancestors});
+      }
+
+      void readDirectory(std::size_t self, const WalkJob &job) {
+        const bool isRoot = !job.parent;
+        auto fd = openDirectoryAt(isRoot ? AT_FDCWD : job.parent->get(), job.name.c_str(),
+                                  isRoot || job.viaSymlink);
+        if (!fd) {
+          // Entries removed while the walk runs are not an error
+          if (!isRoot && errno == ENOENT) {
+            return;
+          }
+          fail(makeErrnoError(errno, FileErrorCode::ReadError, "Failed to open directory",
+                              job.path));
+          return;
+        }
+        const int dirFd = fd.get();
+        std::shared_ptr<const Ancestor> ancestors;
+        if (options_.symlinks == SymlinkPolicy::Follow) {
+          ancestors = enter(job, dirFd);
+          if (!ancestors) {
+            return;
+          }
+        }
+
+        auto &results = results_[self];
+        std::shared_ptr<const UniqueFd> shared;
+        DirectoryStream stream(dirFd);
+        RawDirectoryEntry raw;
+        DirectoryEntry entry;
+        EntryDecision decision;
+        while (stream.next(raw)) {
+          if (const int err = resolveEntry(dirFd, raw, job.path, rootLength_, job.depth,
+                                           options_, entry, decision);
+              err != 0) {
+            if (err == ENOENT) {
+              continue;
+            }
+            fail(makeErrnoError(err, FileErrorCode::ReadError, "Failed to stat entry",
+                                job.path / raw.name));
+            return;
+          }
+          if (decision.descend) {
+            // The children are opened relative to this descriptor, so it stays open until the
+            // last of them has been read
+            if (!shared) {
+              shared = std::make_shared<const UniqueFd>(std::move(fd));
+            }
+            queues_.push(self, WalkJob{
+                           .parent = shared,
+                           .name = std::string(raw.name),
+                           .path = decision.report ? entry.path : std::move(entry.path),
+                           .depth = job.depth + 1,
+                           .viaSymlink = decision.viaSymlink,
+                           .ancestors = ancestors,
+                       });
+          }
+          if (decision.report) {
+            results.push_back(std::move(entry));
+          }
+        }
+        if (stream.error() != 0) {
+          fail(makeErrnoError(stream.error(), FileErrorCode::ReadError,
+                              "Error reading directory", job.path));
+        }
+      }
+
+      const WalkOptions &options_;
+      const std::size_t rootLength_;
+      WorkStealingQueues<WalkJob> queues_;
+      std::vector<std::vector<DirectoryEntry>> results_;
+      std::mutex errorMutex_;
+      std::optional<FileError> error_;
+    };
+  } // namespace
+#endif
+
+  Result<std::vector<DirectoryEntry>, FileError>
+      walkDirectory(const std::filesystem::path &root, const WalkOptions &options,
+                    ThreadPool *pool) {
+#if defined(NIXONCPP_HAS_POSIX_IO)
+    ParallelWalk walk(root, options, (pool ? pool->threadCount() : 0) + 1);
+    walk.run(root, pool);
+    return walk.collect();
+#else
+    // Without getdents64 and openat there is nothing to gain from parallel reads
+    (void)pool;
+    auto range = DirectoryRange::open(root, options);
+    if (!range) {
+      return range.error();
+    }
+    std::vector<DirectoryEntry> entries;
+    for (const auto &entry : range.value()) {
+      entries.push_back(entry);
+    }
+    if (range.value().error()) {
+      return *range.value().error();
+    }
+    return entries;
+#endif
+  }
+
+} // namespace nixoncpp::utils::detail
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <Utils/Filesystem/GlobMatcher.hpp>
+#include <Utils/UtilsError.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace nixoncpp::utils {
+
+  class ThreadPool;
+
+  /**
+   * @brief Kind of a directory entry, as reported by the directory listing itself
+   */
+  enum class EntryType : std::uint8_t { Unknown, Regular, Directory, Symlink, Other };
+
+  /**
+   * @brief What a directory walk does with symbolic links
+   */
+  enum class SymlinkPolicy : std::uint8_t {
+    Report, // Listed as Symlink entries, never descended into
+    Skip,   // Left out of the results
+    Follow, // Listed, and descended into when they point to a directory (cycles are cut)
+  };
+
+  /**
+   * @brief Metadata of an entry; describes the entry itself, not a symlink's target
+   */
+  struct EntryStat {
+    std::uintmax_t size = 0;
+    std::int64_t modifiedNs = 0; // Nanoseconds since the Unix epoch
+    std::uint64_t inode = 0;
+    std::uint64_t device = 0;
+    std::uint32_t mode = 0; // st_mode: type and permission bits
+  };
+
+  /**
+   * @brief Entry found by a directory walk
+   */
+  struct DirectoryEntry {
+    std::filesystem::path path;
+    EntryType type = EntryType::Unknown;
+    std::size_t depth = 0; // 0 for entries directly inside the walked directory
+    std::optional<EntryStat> stat = std::nullopt; // Filled when WalkOptions::withStat is set
+  };
+
+  /**
+   * @brief Conditions an entry must meet to be reported by a walk
+   *
+   * Checked while the directories are read, cheapest first: type and name, then the glob,
+   * then the size and modification time bounds, which stat only the entries still in question.
+   * Filters decide what is reported, not what is descended into (use WalkOptions::prune for
+   * that), except that directories below which the glob cannot match are not read.
+   */
+  struct EntryFilter {
+    std::vector<std::string> extensions{}; // File name suffixes such as ".txt"; empty = any
+    std::vector<EntryType> types{};        // Empty = any
+    std::optional<std::uintmax_t> minSize{};
+    std::optional<std::uintmax_t> maxSize{};
+    std::optional<std::int64_t> modifiedAfterNs{}; // Nanoseconds since the Unix epoch, exclusive
+    std::optional<std::int64_t> modifiedBeforeNs{};
+    // Matched against the path relative to the walked directory, with '/' separators
+    std::shared_ptr<const GlobMatcher> glob{};
+    std::function<bool(const DirectoryEntry &)> predicate{}; // Final check, e.g. on the path
+
+    /**
+     * @brief Whether the size or time bounds need the stat data of an entry
+     *
+     * @return bool
+     */
+    [[nodiscard]]
+    bool needsStat() const noexcept;
+
+    /**
+     * @brief Whether an entry with this name and type can still match
+     *
+     * @param name File name of the entry
+     * @param type
+     * @return bool
+     */
+    [[nodiscard]]
+    bool acceptsName(std::string_view name, EntryType type) const;
+
+    /**
+     * @brief Whether an entry that passed acceptsName() matches the remaining conditions
+     *
+     * @param entry Carries stat data if needsStat()
+     * @return bool
+     */
+    [[nodiscard]]
+    bool acceptsEntry(const DirectoryEntry &entry) const;
+  };
+
+  /**
+   * @brief Behaviour of IDirectoryManager::walk() and IDirectoryManager::iterate()
+   */
+  struct WalkOptions {
+    // Deepest level reported; entries of directories below it are neither read nor listed
+    std::size_t maxDepth = std::numeric_limits<std::size_t>::max();
+    SymlinkPolicy symlinks = SymlinkPolicy::Report;
+    bool withStat = false; // Fill DirectoryEntry::stat (one extra fstatat per entry)
+    EntryFilter filter{};
+    // Called for each directory about to be descended into; returning true skips its subtree.
+    // walk() calls it from several threads at once.
+    std::function<bool(const DirectoryEntry &)> prune{};
+  };
+
+  namespace detail {
+
+    /**
+     * @brief Walk a directory tree, reading directories in parallel on the pool
+     *
+     * Every worker owns a deque of directories still to be read: it takes work from the back
+     * of its own deque and, when that runs dry, steals from the front of another worker's. The
+     * calling thread takes part as a worker, so a busy or threadless pool only reduces the
+     * parallelism. Directories are read with getdents64 and opened relative to their parent's
+     * descriptor; the entry type comes from d_type, so only filesystems that do not report it
+     * (and withStat) cost a stat call per entry. Other platforms use
+     * std::filesystem::recursive_directory_iterator on the calling thread.
+     *
+     * @param root Must be an existing directory
+     * @param options
+     * @param pool May be null; must not be the pool the caller runs on
+     * @return Result<std::vector<DirectoryEntry>, FileError> In unspecified order
+     */
+    [[nodiscard]]
+    Result<std::vector<DirectoryEntry>, FileError>
+        walkDirectory(const std::filesystem::path &root, const WalkOptions &options,
+                      ThreadPool *pool);
+
+  } // namespace detail
+
+} // namespace nixoncpp::utils
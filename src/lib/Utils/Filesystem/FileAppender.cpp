@@ -0,0 +1,151 @@
+#include "FileAppender.hpp"
+#include <Utils/Filesystem/PosixIo.hpp>
+#include <array>
+#include <fstream>
+#include <utility>
+
+namespace nixoncpp::utils {
+
+#if defined(NIXONCPP_HAS_POSIX_IO)
+  struct FileAppender::Sink {
+    detail::UniqueFd fd;
+
+    /**
+     * @brief Write both pieces, retrying partial writes
+     *
+     * @return false on error (errno set)
+     */
+    bool write(std::string_view first, std::string_view second) {
+      std::array<iovec, 2> pieces{{
+          {.iov_base = const_cast<char *>(first.data()), .iov_len = first.size()},
+          {.iov_base = const_cast<char *>(second.data()), .iov_len = second.size()},
+      }};
+      return detail::writeAllVectored(fd.get(), pieces);
+    }
+
+    bool sync() {
+#if defined(__APPLE__)
+      return ::fsync(fd.get()) == 0;
+#else
+      return ::fdatasync(fd.get()) == 0;
+#endif
+    }
+  };
+#else
+  struct FileAppender::Sink {
+    std::ofstream stream;
+
+    bool write(std::string_view first, std::string_view second) {
+      stream.write(first.data(), static_cast<std::streamsize>(first.size()));
+      stream.write(second.data(), static_cast<std::streamsize>(second.size()));
+      stream.flush();
+      return !stream.bad();
+    }
+
+    bool sync() { return !stream.flush().bad(); }
+  };
+#endif
+
+  FileAppender::FileAppender(std::unique_ptr<Sink> sink, std::filesystem::path filePath,
+                             std::size_t bufferSize)
+      : sink_(std::move(sink)), filePath_(std::move(filePath)), bufferSize_(bufferSize) {
+    buffer_.reserve(bufferSize_);
+  }
+
+  FileAppender::FileAppender(FileAppender &&other) noexcept = default;
+
+  FileAppender &FileAppender::operator=(FileAppender &&other) noexcept {
+    if (this != &other) {
+      if (sink_) {
+        (void)flush();
+      }
+      sink_ = std::move(other.sink_);
+      filePath_ = std::move(other.filePath_);
+      buffer_ = std::move(other.buffer_);
+      bufferSize_ = other.bufferSize_;
+    }
+    return *this;
+  }
+
+  FileAppender::~FileAppender() {
+    if (sink_) {
+      (void)flush();
+    }
+  }
+
+  Result<FileAppender, FileError> FileAppender::open(const std::filesystem::path &filePath,
+                                                     const AppenderOptions &options) {
+    if (filePath.empty()) {
+      return FileError{
+          .code = FileErrorCode::InvalidPath,
+          .message = "Empty file path",
+          .path = "",
+      };
+    }
+
+    auto sink = std::make_unique<Sink>();
+#if defined(NIXONCPP_HAS_POSIX_IO)
+    sink->fd = detail::openFile(filePath, O_WRONLY | O_CREAT | O_APPEND);
+    if (!sink->fd) {
+      return detail::makeErrnoError(errno, FileErrorCode::WriteError,
+                                    "Failed to open file for appending", filePath);
+    }
+    struct stat info{};
+    if (options.expectedSize != 0 && ::fstat(sink->fd.get(), &info) == 0 &&
+        options.expectedSize > static_cast<std::uintmax_t>(info.st_size)) {
+      detail::reserveSpace(sink->fd.get(), info.st_size,
+                           static_cast<off_t>(options.expectedSize) - info.st_size);
+    }
+#else
+    sink->stream.open(filePath, std::ios::binary | std::ios::app);
+    if (!sink->stream.is_open()) {
+      return FileError{
+          .code = FileErrorCode::WriteError,
+          .message = "Failed to open file for appending",
+          .path = filePath.string(),
+      };
+    }
+#endif
+
+    return FileAppender(std::move(sink), filePath, options.bufferSize);
+  }
+
+  Result<void, FileError> FileAppender::append(std::string_view data) {
+    if (buffer_.size() + data.size() <= bufferSize_) {
+      buffer_.append(data);
+      return {};
+    }
+    return writeOut(data);
+  }
+
+  Result<void, FileError> FileAppender::flush() {
+    if (buffer_.empty()) {
+      return {};
+    }
+    return writeOut({});
+  }
+
+  Result<void, FileError> FileAppender::sync() {
+    if (auto flushed = flush(); !flushed) {
+      return flushed;
+    }
+    if (!sink_->sync()) {
+      return detail::makeErrnoError(errno, FileErrorCode::WriteError, "Failed to sync file",
+                                    filePath_);
+    }
+    return {};
+  }
+
+  Result<void, FileError> FileAppender::writeOut(std::string_view extra) {
+    const bool written = sink_->write(buffer_, extra);
+    const int err = errno;
+    // After a failed write it is unknown how much reached the file; never write it twice
+    buffer_.clear();
+    if (!written) {
+      return detail::makeErrnoError(err, FileErrorCode::WriteError,
+                                    "I/O error while appending to file", filePath_);
+    }
+    return {};
+  }
+
+} // namespace nixoncpp::utils
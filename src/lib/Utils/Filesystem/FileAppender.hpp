@@ -0,0 +1,107 @@
+#pragma once
+
+#include <Utils/UtilsError.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace nixoncpp::utils {
+
+  /**
+   * @brief Options of a FileAppender
+   */
+  struct AppenderOptions {
+    std::size_t bufferSize = 64 * 1024; // Bytes coalesced before a write (0 = write through)
+    std::uintmax_t expectedSize = 0;    // Final file size to reserve on open (0 = none)
+  };
+
+  /**
+   * @brief Append-only handle keeping its file open between writes
+   *
+   * Small appends are collected in a buffer. When an append does not fit, the buffer and the
+   * new data go out together in a single writev() call, so large appends are never copied.
+   * flush() writes the buffer, sync() additionally makes it durable (fdatasync). The buffer is
+   * flushed on destruction; call flush() first to observe errors.
+   *
+   * Not thread-safe. Move-only.
+   */
+  class FileAppender {
+  public:
+    FileAppender(const FileAppender &) = delete;
+    FileAppender &operator=(const FileAppender &) = delete;
+    FileAppender(FileAppender &&other) noexcept;
+    FileAppender &operator=(FileAppender &&other) noexcept;
+    ~FileAppender();
+
+    /**
+     * @brief Open or create a file for appending
+     *
+     * @param filePath
+     * @param options
+     * @return Result<FileAppender, FileError>
+     */
+    [[nodiscard]]
+    static Result<FileAppender, FileError> open(const std::filesystem::path &filePath,
+                                                const AppenderOptions &options = AppenderOptions{});
+
+    /**
+     * @brief Append data, buffering it if it fits
+     *
+     * @param data
+     * @return Result<void, FileError>
+     */
+    [[nodiscard]]
+    Result<void, FileError> append(std::string_view data);
+
+    /**
+     * @brief Write buffered data to the file
+     *
+     * @return Result<void, FileError>
+     */
+    [[nodiscard]]
+    Result<void, FileError> flush();
+
+    /**
+     * @brief Flush, then wait until the data has reached the storage device
+     *
+     * @return Result<void, FileError>
+     */
+    [[nodiscard]]
+    Result<void, FileError> sync();
+
+    /**
+     * @brief Bytes appended but not yet written to the file
+     *
+     * @return std::size_t
+     */
+    [[nodiscard]]
+    std::size_t pendingBytes() const noexcept {
+      return buffer_.size();
+    }
+
+    [[nodiscard]]
+    const std::filesystem::path &path() const noexcept {
+      return filePath_;
+    }
+
+  private:
+    struct Sink;
+
+    FileAppender(std::unique_ptr<Sink> sink, std::filesystem::path filePath,
+                 std::size_t bufferSize);
+
+    /**
+     * @brief Write the buffer followed by extra, then empty the buffer
+     */
+    Result<void, FileError> writeOut(std::string_view extra);
+
+    std::unique_ptr<Sink> sink_;
+    std::filesystem::path filePath_;
+    std::string buffer_;
+    std::size_t bufferSize_;
+  };
+
+} // namespace nixoncpp::utils
@@ -0,0 +1,297 @@
+#include "FileCopy.hpp"
+#include <Utils/Filesystem/PosixIo.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <sys/sendfile.h>
+#endif
+
+namespace nixoncpp::utils::detail {
+
+  namespace {
+    std::atomic<std::uint64_t> tempCounter{0};
+
+    /**
+     * @brief Unique name next to path for a copy that replaces it once complete
+     */
+    std::filesystem::path temporarySiblingOf(const std::filesystem::path &path) {
+      auto tempPath = path;
+#if defined(NIXONCPP_HAS_POSIX_IO)
+      tempPath += fmt::format(".tmp.{}.{}", ::getpid(), tempCounter.fetch_add(1));
+#else
+      tempPath += fmt::format(".tmp.{}", tempCounter.fetch_add(1));
+#endif
+      return tempPath;
+    }
+  } // namespace
+
+#if defined(NIXONCPP_HAS_POSIX_IO)
+  namespace {
+    constexpr std::size_t kCopyBufferSize = 128 * 1024;
+
+    // Largest count sendfile(2) transfers in one call on Linux
+    constexpr off_t kMaxSendfileChunk = 0x7ffff000;
+
+    enum class RangeCopier : std::uint8_t { CopyFileRange, Sendfile, ReadWrite };
+
+    bool isUnsupported(int err) {
+      return err == ENOSYS || err == EXDEV || err == EINVAL || err == EOPNOTSUPP ||
+             err == ENOTSUP || err == EPERM;
+    }
+
+    /**
+     * @brief Copy [offset, offset + length) of in to the same offset of out
+     *
+     * The copier is downgraded for the rest of the file when the kernel rejects it.
+     *
+     * @return false on error (errno set); a source that shrank is not an error
+     */
+    bool copyRange(int in, int out, off_t offset, off_t length, RangeCopier &copier,
+                   std::vector<char> &buffer) {
+      while (length > 0) {
+#if defined(__linux__)
+        if (copier == RangeCopier::CopyFileRange) {
+          loff_t inOffset = offset;
+          loff_t outOffset = offset;
+          const auto copied = ::copy_file_range(in, &inOffset, out, &outOffset,
+                                                static_cast<std::size_t>(length), 0);
+          if (copied > 0) {
+            offset += copied;
+            length -= copied;
+            continue;
+          }
+          if (copied == 0) {
+            return true;
+          }
+          if (errno == EINTR) {
+            continue;
+          }
+          if (!isUnsupported(errno)) {
+            return false;
+          }
+          copier = RangeCopier::Sendfile;
+        }
+        if (copier == RangeCopier::Sendfile) {
+          if (::lseek(out, offset, SEEK_SET) < 0) {
+            return false;
+          }
+          off_t inOffset = offset;
+          const auto sent = ::sendfile(
+              out, in, &inOffset, static_cast<std::size_t>(std::min(length, kMaxSendfileChunk)));
+          if (sent > 0) {
+            offset += sent;
+            length -= sent;
+            continue;
+          }
+          if (sent == 0) {
+            return true;
+          }
+          if (errno == EINTR) {
+            continue;
+          }
+          if (!isUnsupported(errno)) {
+            return false;
+          }
+          copier = RangeCopier::ReadWrite;
+        }
+#endif
+        buffer.resize(kCopyBufferSize);
+        const auto got =
+            ::pread(in, buffer.data(),
+                    static_cast<std::size_t>(std::min<off_t>(length, kCopyBufferSize)), offset);
+        if (got < 0) {
+          if (errno == EINTR) {
+            continue;
+          }
+          return false;
+        }
+        if (got == 0) {
+          return true;
+        }
+        for (ssize_t done = 0; done < got;) {
+          const auto written = ::pwrite(out, buffer.data() + done,
+                                        static_cast<std::size_t>(got - done), offset + done);
+          if (written < 0) {
+            if (errno == EINTR) {
+              continue;
+            }
+            return false;
+          }
+          done += written;
+        }
+        offset += got;
+        length -= got;
+      }
+      return true;
+    }
+  } // namespace
+
+  Result<std::uintmax_t, FileError> copyFileContents(const std::filesystem::path &source,
+                                                     const std::filesystem::path &destination,
+                                                     const CopyOptions &options) {
+    auto in = openFile(source, O_RDONLY);
+    if (!in) {
+      return makeErrnoError(errno, FileErrorCode::ReadError, "Failed to open source file",
+                            source);
+    }
+    struct stat info{};
+    if (::fstat(in.get(), &info) != 0) {
+      return makeErrnoError(errno, FileErrorCode::ReadError, "Failed to stat source file",
+                            source);
+    }
+    if (S_ISDIR(info.st_mode)) {
+      return FileError{
+          .code = FileErrorCode::IsDirectory,
+          .message = "Path is a directory, not a file",
+          .path = source.string(),
+      };
+    }
+    if (!S_ISREG(info.st_mode)) {
+      return FileError{
+          .code = FileErrorCode::InvalidPath,
+          .message = "Source is not a regular file",
+          .path = source.string(),
+      };
+    }
+
+    struct stat existing{};
+    if (::stat(destination.c_str(), &existing) == 0) {
+      if (existing.st_dev == info.st_dev && existing.st_ino == info.st_ino) {
+        return FileError{
+            .code = FileErrorCode::InvalidPath,
+            .message = "Source and destination are the same file",
+            .path = destination.string(),
+        };
+      }
+      if (S_ISDIR(existing.st_mode)) {
+        return FileError{
+            .code = FileErrorCode::IsDirectory,
+            .message = "Path is a directory, not a file",
+            .path = destination.string(),
+        };
+      }
+    }
+
+    // An existing destination is only replaced, by renaming a sibling copy over it, once the
+    // copy is complete; a new destination is written in place
+    const mode_t mode = info.st_mode & 07777;
+    std::filesystem::path written = destination;
+    UniqueFd out;
+    while (!out) {
+      if (options.overwrite) {
+        written = temporarySiblingOf(destination);
+      }
+      out = openFile(written, O_WRONLY | O_CREAT | O_EXCL, mode);
+      if (!out && (!options.overwrite || errno != EEXIST)) {
+        return makeErrnoError(errno, FileErrorCode::WriteError,
+                              "Failed to create destination file", destination);
+      }
+    }
+    // From here on a failure removes the file written so far, never an existing destination
+    const auto failCopy = [&out, &written, &destination](std::string_view what) {
+      const int err = errno;
+      out.reset();
+      ::unlink(written.c_str());
+      return makeErrnoError(err, FileErrorCode::WriteError, what, destination);
+    };
+    const auto size = static_cast<std::uintmax_t>(info.st_size);
+    const auto publish = [&]() -> Result<std::uintmax_t, FileError> {
+      if (written != destination && ::rename(written.c_str(), destination.c_str()) != 0) {
+        return failCopy("Failed to replace destination file");
+      }
+      return size;
+    };
+    if (::fchmod(out.get(), mode) != 0) {
+      return failCopy("Failed to set permissions of destination file");
+    }
+
+#if defined(__linux__) && defined(FICLONE)
+    if (options.allowReflink && size > 0 && ::ioctl(out.get(), FICLONE, in.get()) == 0) {
+      return publish();
+    }
+#endif
+
+    // Copy the data segments only; holes skipped in the fresh destination stay holes
+#if defined(__linux__)
+    auto copier = RangeCopier::CopyFileRange;
+#else
+    auto copier = RangeCopier::ReadWrite;
+#endif
+    std::vector<char> buffer;
+    const off_t end = info.st_size;
+    off_t offset = 0;
+    while (offset < end) {
+      off_t dataStart = offset;
+      off_t dataEnd = end;
+#if defined(SEEK_DATA) && defined(SEEK_HOLE)
+      dataStart = ::lseek(in.get(), offset, SEEK_DATA);
+      if (dataStart < 0) {
+        if (errno == ENXIO) {
+          break; // Only a trailing hole is left
+        }
+        dataStart = offset; // Not supported: treat the rest as data
+      } else {
+        dataEnd = ::lseek(in.get(), dataStart, SEEK_HOLE);
+        dataEnd = dataEnd < 0 ? end : std::min(dataEnd, end);
+      }
+#endif
+      if (!copyRange(in.get(), out.get(), dataStart, dataEnd - dataStart, copier, buffer)) {
+        return failCopy("I/O error while copying file");
+      }
+      offset = dataEnd;
+    }
+    if (::ftruncate(out.get(), end) != 0) {
+      return failCopy("Failed to size destination file");
+    }
+    return publish();
+  }
+#else
+  Result<std::uintmax_t, FileError> copyFileContents(const std::filesystem::path &source,
+                                                     const std::filesystem::path &destination,
+                                                     const CopyOptions &options) {
+    std::error_code ec;
+    if (std::filesystem::is_directory(source, ec)) {
+      return FileError{
+          .code = FileErrorCode::IsDirectory,
+          .message = "Path is a directory, not a file",
+          .path = source.string(),
+      };
+    }
+    const auto size = std::filesystem::file_size(source, ec);
+    if (ec) {
+      return FileError{
+          .code = FileErrorCode::NotFound,
+          .message = fmt::format("Failed to open source file: {}", ec.message()),
+          .path = source.string(),
+      };
+    }
+    // As on POSIX, an existing destination is replaced only by a complete copy
+    const auto written = options.overwrite ? temporarySiblingOf(destination) : destination;
+    std::filesystem::copy_file(source, written, ec);
+    if (!ec && written != destination) {
+      std::filesystem::rename(written, destination, ec);
+    }
+    if (ec) {
+      const bool exists = !options.overwrite && ec == std::errc::file_exists;
+      FileError error{
+          .code = exists ? FileErrorCode::AlreadyExists : FileErrorCode::WriteError,
+          .message = fmt::format("Failed to copy file: {}", ec.message()),
+          .path = destination.string(),
+      };
+      if (!exists) {
+        std::filesystem::remove(written, ec);
+      }
+      return error;
+    }
+    return static_cast<std::uintmax_t>(size);
+  }
+#endif
+
+} // namespace nixoncpp::utils::detail
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <Utils/UtilsError.hpp>
+#include <cstdint>
+#include <filesystem>
+
+namespace nixoncpp::utils {
+
+  /**
+   * @brief Behaviour of IFileWriter::copyFile() and IDirectoryManager::copyTree()
+   */
+  struct CopyOptions {
+    bool overwrite = false;   // Replace existing destination files instead of failing
+    bool allowReflink = true; // Share extents (FICLONE) when the filesystem supports it
+  };
+
+  namespace detail {
+
+    /**
+     * @brief Copy one regular file without routing the bytes through userspace where possible
+     *
+     * Tries, in order: a reflink (FICLONE), copy_file_range(2), sendfile(2) and finally a
+     * pread/pwrite loop, downgrading whenever the kernel or filesystem rejects a mechanism.
+     * Only the data segments reported by SEEK_DATA/SEEK_HOLE are copied, so holes of sparse
+     * files stay holes. The permission bits of the source are applied to the destination.
+     * An existing destination is replaced by renaming a complete copy, written next to it,
+     * over it; a failed copy leaves it untouched and removes the partial copy. Other
+     * platforms use std::filesystem::copy_file().
+     *
+     * @param source
+     * @param destination Its parent directory must exist
+     * @param options
+     * @return Result<std::uintmax_t, FileError> Size of the copied file
+     */
+    [[nodiscard]]
+    Result<std::uintmax_t, FileError> copyFileContents(const std::filesystem::path &source,
+                                                       const std::filesystem::path &destination,
+                                                       const CopyOptions &options);
+
+  } // namespace detail
+
+} // namespace nixoncpp::utils
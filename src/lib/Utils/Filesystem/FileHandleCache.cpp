@@ -0,0 +1,86 @@
+#include "FileHandleCache.hpp"
+#include <Utils/Filesystem/PosixIo.hpp>
+#include <algorithm>
+
+namespace nixoncpp::utils {
+
+  FileHandle::~FileHandle() {
+#if defined(NIXONCPP_HAS_POSIX_IO)
+    if (fd_ >= 0) {
+      ::close(fd_);
+    }
+#endif
+  }
+
+  FileHandleCache::FileHandleCache(std::size_t capacity)
+      : capacity_(std::max<std::size_t>(capacity, 1)) {}
+
+  Result<std::shared_ptr<const FileHandle>, FileError>
+      FileHandleCache::acquire(const std::filesystem::path &filePath) {
+    const auto &key = filePath.native();
+    {
+      std::lock_guard lock(mutex_);
+      if (auto found = index_.find(key); found != index_.end()) {
+        entries_.splice(entries_.begin(), entries_, found->second);
+        ++stats_.hits;
+        return found->second->second;
+      }
+    }
+
+#if defined(NIXONCPP_HAS_POSIX_IO)
+    // Open outside the lock; a concurrent miss on the same path keeps the first insertion
+    auto fd = detail::openFile(filePath, O_RDONLY);
+    if (!fd) {
+      return detail::makeErrnoError(errno, FileErrorCode::ReadError,
+                                    "Failed to open file for reading", filePath);
+    }
+    auto handle = std::make_shared<const FileHandle>(fd.release());
+
+    std::lock_guard lock(mutex_);
+    ++stats_.misses;
+    if (auto found = index_.find(key); found != index_.end()) {
+      entries_.splice(entries_.begin(), entries_, found->second);
+      return found->second->second;
+    }
+    entries_.emplace_front(key, handle);
+    index_.emplace(key, entries_.begin());
+    if (entries_.size() > capacity_) {
+      index_.erase(entries_.back().first);
+      entries_.pop_back();
+      ++stats_.evictions;
+    }
+    return std::shared_ptr<const FileHandle>(std::move(handle));
+#else
+    return FileError{
+        .code = FileErrorCode::Unknown,
+        .message = "File handle cache is not supported on this platform",
+        .path = filePath.string(),
+    };
+#endif
+  }
+
+  void FileHandleCache::invalidate(const std::filesystem::path &filePath) {
+    std::lock_guard lock(mutex_);
+    if (auto found = index_.find(filePath.native()); found != index_.end()) {
+      entries_.erase(found->second);
+      index_.erase(found);
+    }
+  }
+
+  void FileHandleCache::clear() {
+    std::lock_guard lock(mutex_);
+    index_.clear();
+    entries_.clear();
+  }
+
+  std::size_t FileHandleCache::size() const {
+    std::lock_guard lock(mutex_);
+    return entries_.size();
+  }
+
+  FileHandleCacheStats FileHandleCache::stats() const {
+    std::lock_guard lock(mutex_);
+    return stats_;
+  }
+
+} // namespace nixoncpp::utils
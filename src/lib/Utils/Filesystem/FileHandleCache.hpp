@@ -0,0 +1,122 @@
+#pragma once
+
+#include <Utils/UtilsError.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace nixoncpp::utils {
+
+  /**
+   * @brief Read-only file descriptor shared between a FileHandleCache and its users
+   *
+   * The descriptor is closed when the last reference goes away, so evicting a handle from the
+   * cache never closes a descriptor that another thread is still reading from.
+   */
+  class FileHandle final {
+  public:
+    explicit FileHandle(int fd) noexcept : fd_(fd) {}
+    FileHandle(const FileHandle &) = delete;
+    FileHandle &operator=(const FileHandle &) = delete;
+    FileHandle(FileHandle &&) = delete;
+    FileHandle &operator=(FileHandle &&) = delete;
+    ~FileHandle();
+
+    [[nodiscard]]
+    int fd() const noexcept {
+      return fd_;
+    }
+
+  private:
+    int fd_;
+  };
+
+  /**
+   * @brief Hit/miss counters of a FileHandleCache
+   */
+  struct FileHandleCacheStats {
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+    std::uint64_t evictions = 0;
+  };
+
+  /**
+   * @brief Thread-safe LRU cache of read-only descriptors keyed by path
+   *
+   * Lets repeated ranged reads of the same files skip open()/close(). A cached descriptor
+   * keeps referring to the file it was opened on: call invalidate() after a file is replaced
+   * (e.g. renamed over) to pick up the new one.
+   *
+   * Only available on POSIX platforms; acquire() fails elsewhere.
+   */
+  class FileHandleCache final {
+  public:
+    static constexpr std::size_t kDefaultCapacity = 64;
+
+    /**
+     * @brief Create an empty cache
+     *
+     * @param capacity Maximum number of descriptors kept open (at least 1)
+     */
+    explicit FileHandleCache(std::size_t capacity = kDefaultCapacity);
+    FileHandleCache(const FileHandleCache &) = delete;
+    FileHandleCache &operator=(const FileHandleCache &) = delete;
+    FileHandleCache(FileHandleCache &&) = delete;
+    FileHandleCache &operator=(FileHandleCache &&) = delete;
+    ~FileHandleCache() = default;
+
+    /**
+     * @brief Cached descriptor of a file, opening it on a miss
+     *
+     * @param filePath
+     * @return Result<std::shared_ptr<const FileHandle>, FileError>
+     */
+    [[nodiscard]]
+    Result<std::shared_ptr<const FileHandle>, FileError>
+        acquire(const std::filesystem::path &filePath);
+
+    /**
+     * @brief Drop the cached descriptor of a file, if any
+     *
+     * @param filePath
+     */
+    void invalidate(const std::filesystem::path &filePath);
+
+    /**
+     * @brief Drop all cached descriptors
+     *
+     */
+    void clear();
+
+    /**
+     * @brief Number of cached descriptors
+     *
+     * @return std::size_t
+     */
+    [[nodiscard]]
+    std::size_t size() const;
+
+    /**
+     * @brief Snapshot of the counters
+     *
+     * @return FileHandleCacheStats
+     */
+    [[nodiscard]]
+    FileHandleCacheStats stats() const;
+
+  private:
+    using Key = std::filesystem::path::string_type;
+    using Entry = std::pair<Key, std::shared_ptr<const FileHandle>>;
+
+    std::size_t capacity_;
+    mutable std::mutex mutex_;
+    std::list<Entry> entries_; // Most recently used first
+    std::unordered_map<Key, std::list<Entry>::iterator> index_;
+    FileHandleCacheStats stats_;
+  };
+
+} // namespace nixoncpp::utils
@@ -0,0 +1,257 @@
+#include "FileHasher.hpp"
+#include <Utils/Filesystem/Crc32c.hpp>
+#include <Utils/Filesystem/PosixIo.hpp>
+#include <algorithm>
+#include <fstream>
+#include <new>
+#include <optional>
+#include <utility>
+
+#if defined(NIXONCPP_HAS_XXHASH)
+#include <xxhash.h>
+#endif
+
+namespace nixoncpp::utils {
+
+  namespace {
+    constexpr std::size_t kChunkSize = 1024 * 1024;
+    constexpr std::size_t kChunkAlignment = 4096;
+    constexpr std::size_t kSlicesPerWorker = 4;
+
+    struct AlignedDelete {
+      void operator()(std::byte *buffer) const noexcept {
+        ::operator delete[](buffer, std::align_val_t{kChunkAlignment});
+      }
+    };
+
+    /**
+     * @brief Read buffer of the calling thread, allocated on first use
+     */
+    std::span<std::byte> chunkBuffer() {
+      using Buffer = std::unique_ptr<std::byte[], AlignedDelete>;
+      thread_local const Buffer buffer(static_cast<std::byte *>(
+          ::operator new[](kChunkSize, std::align_val_t{kChunkAlignment})));
+      return {buffer.get(), kChunkSize};
+    }
+
+    /**
+     * @brief Incremental state of one of the supported algorithms
+     */
+    class Digest {
+    public:
+      explicit Digest(HashAlgorithm algorithm) : algorithm_(algorithm) {
+#if defined(NIXONCPP_HAS_XXHASH)
+        if (algorithm_ != HashAlgorithm::Crc32c) {
+          state_.reset(XXH3_createState());
+          if (!state_) {
+            throw std::bad_alloc();
+          }
+          if (algorithm_ == HashAlgorithm::Xxh3_64) {
+            XXH3_64bits_reset(state_.get());
+          } else {
+            XXH3_128bits_reset(state_.get());
+          }
+        }
+#endif
+      }
+
+      void update(std::span<const std::byte> data) {
+        switch (algorithm_) {
+        case HashAlgorithm::Crc32c: crc_ = crc32c(crc_, data); break;
+#if defined(NIXONCPP_HAS_XXHASH)
+        case HashAlgorithm::Xxh3_64:
+          XXH3_64bits_update(state_.get(), data.data(), data.size());
+          break;
+        case HashAlgorithm::Xxh3_128:
+          XXH3_128bits_update(state_.get(), data.data(), data.size());
+          break;
+#else
+        case HashAlgorithm::Xxh3_64:
+        case HashAlgorithm::Xxh3_128: break;
+#endif
+        }
+      }
+
+      [[nodiscard]]
+      FileHash finish() const {
+        FileHash hash{.algorithm = algorithm_};
+        switch (algorithm_) {
+        case HashAlgorithm::Crc32c: hash.low = crc_; break;
+#if defined(NIXONCPP_HAS_XXHASH)
+        case HashAlgorithm::Xxh3_64: hash.low = XXH3_64bits_digest(state_.get()); break;
+        case HashAlgorithm::Xxh3_128: {
+          const auto digest = XXH3_128bits_digest(state_.get());
+          hash.low = digest.low64;
+          hash.high = digest.high64;
+          break;
+        }
+#else
+        case HashAlgorithm::Xxh3_64:
+        case HashAlgorithm::Xxh3_128: break;
+#endif
+        }
+        return hash;
+      }
+
+    private:
+      HashAlgorithm algorithm_;
+      std::uint32_t crc_ = 0;
+#if defined(NIXONCPP_HAS_XXHASH)
+      struct StateDelete {
+        void operator()(XXH3_state_t *state) const noexcept { XXH3_freeState(state); }
+      };
+      std::unique_ptr<XXH3_state_t, StateDelete> state_;
+#endif
+    };
+  } // namespace
+
+  std::string FileHash::toHex() const {
+    switch (algorithm) {
+    case HashAlgorithm::Crc32c: return fmt::format("{:08x}", low);
+    case HashAlgorithm::Xxh3_64: return fmt::format("{:016x}", low);
+    case HashAlgorithm::Xxh3_128: return fmt::format("{:016x}{:016x}", high, low);
+    }
+    return {};
+  }
+
+  bool isHashAlgorithmAvailable(HashAlgorithm algorithm) noexcept {
+    switch (algorithm) {
+    case HashAlgorithm::Crc32c: return true;
+    case HashAlgorithm::Xxh3_64:
+    case HashAlgorithm::Xxh3_128:
+#if defined(NIXONCPP_HAS_XXHASH)
+      return true;
+#else
+      return false;
+#endif
+    }
+    return false;
+  }
+
+  FileHasher::FileHasher(std::shared_ptr<ThreadPool> pool) : pool_(std::move(pool)) {}
+
+  Result<FileHash, FileError> FileHasher::hashFile(const std::filesystem::path &filePath,
+                                                   HashAlgorithm algorithm) const {
+    if (filePath.empty()) {
+      return FileError{
+          .code = FileErrorCode::InvalidPath,
+          .message = "Empty file path",
+          .path = "",
+      };
+    }
+    if (!isHashAlgorithmAvailable(algorithm)) {
+      return FileError{
+          .code = FileErrorCode::Unknown,
+          .message = "Hash algorithm not available in this build (requires libxxhash)",
+          .path = filePath.string(),
+      };
+    }
+
+    Digest digest(algorithm);
+    const auto buffer = chunkBuffer();
+#if defined(NIXONCPP_HAS_POSIX_IO)
+    auto fd = detail::openFile(filePath, O_RDONLY);
+    if (!fd) {
+      return detail::makeErrnoError(errno, FileErrorCode::ReadError,
+                                    "Failed to open file for reading", filePath);
+    }
+    struct stat info{};
+    if (::fstat(fd.get(), &info) != 0) {
+      return detail::makeErrnoError(errno, FileErrorCode::ReadError, "Failed to stat file",
+                                    filePath);
+    }
+    if (S_ISDIR(info.st_mode)) {
+      return FileError{
+          .code = FileErrorCode::IsDirectory,
+          .message = "Path is a directory, not a file",
+          .path = filePath.string(),
+      };
+    }
+    detail::adviseFile(fd.get(), 0, 0, AccessPattern::Sequential);
+
+    for (;;) {
+      const auto got = ::read(fd.get(), buffer.data(), buffer.size());
+      if (got < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return detail::makeErrnoError(errno, FileErrorCode::ReadError,
+                                      "I/O error while reading file", filePath);
+      }
+      if (got == 0) {
+        break;
+      }
+      digest.update(buffer.first(static_cast<std::size_t>(got)));
+    }
+#else
+    std::error_code ec;
+    if (std::filesystem::is_directory(filePath, ec)) {
+      return FileError{
+          .code = FileErrorCode::IsDirectory,
+          .message = "Path is a directory, not a file",
+          .path = filePath.string(),
+      };
+    }
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+      return FileError{
+          .code = std::filesystem::exists(filePath, ec) ? FileErrorCode::ReadError
+                                                        : FileErrorCode::NotFound,
+          .message = "Failed to open file for reading",
+          .path = filePath.string(),
+      };
+    }
+    while (file) {
+      file.read(reinterpret_cast<char *>(buffer.data()),
+                static_cast<std::streamsize>(buffer.size()));
+      digest.update(buffer.first(static_cast<std::size_t>(file.gcount())));
+    }
+    if (file.bad()) {
+      return FileError{
+          .code = FileErrorCode::ReadError,
+          .message = "I/O error while reading file",
+          .path = filePath.string(),
+      };
+    }
+#endif
+    return digest.finish();
+  }
+
+  std::vector<Result<FileHash, FileError>>
+      FileHasher::hashFiles(std::span<const std::filesystem::path> filePaths,
+                            HashAlgorithm algorithm) const {
+    std::vector<Result<FileHash, FileError>> results;
+    results.reserve(filePaths.size());
+    if (!pool_ || pool_->threadCount() == 0 || filePaths.size() < 2) {
+      for (const auto &filePath : filePaths) {
+        results.push_back(hashFile(filePath, algorithm));
+      }
+      return results;
+    }
+
+    // A few contiguous slices per worker keep the task overhead low for small files while
+    // still balancing uneven file sizes
+    const auto count = filePaths.size();
+    const auto tasks = std::min(count, pool_->threadCount() * kSlicesPerWorker);
+    std::vector<std::optional<Result<FileHash, FileError>>> slots(count);
+    std::vector<std::future<void>> pending;
+    pending.reserve(tasks);
+    for (std::size_t task = 0; task < tasks; ++task) {
+      const auto begin = count * task / tasks;
+      const auto end = count * (task + 1) / tasks;
+      pending.push_back(pool_->submit([this, &filePaths, &slots, algorithm, begin, end] {
+        for (auto index = begin; index < end; ++index) {
+          slots[index].emplace(hashFile(filePaths[index], algorithm));
+        }
+      }));
+    }
+    for (auto &slice : pending) {
+      slice.get();
+    }
+    for (auto &slot : slots) {
+      results.push_back(std::move(*slot));
+    }
+    return results;
+  }
+
+} // namespace nixoncpp::utils
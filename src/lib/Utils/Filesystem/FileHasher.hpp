@@ -0,0 +1,56 @@
+#pragma once
+
+#include <Utils/Concurrency/ThreadPool.hpp>
+#include <Utils/Filesystem/IFileHasher.hpp>
+#include <memory>
+
+namespace nixoncpp::utils {
+
+  /**
+   * @brief Whether this build can compute an algorithm
+   *
+   * CRC-32C is always available; the XXH3 variants depend on libxxhash.
+   *
+   * @param algorithm
+   * @return bool
+   */
+  [[nodiscard]]
+  bool isHashAlgorithmAvailable(HashAlgorithm algorithm) noexcept;
+
+  /**
+   * @brief Standard implementation of IFileHasher interface
+   *
+   * Reads each file sequentially in 1 MiB chunks into a page-aligned buffer reused by the
+   * calling thread, with a sequential read-ahead hint.
+   */
+  class FileHasher final : public IFileHasher {
+  public:
+    FileHasher() = default;
+
+    /**
+     * @brief File hasher whose hashFiles() hashes files in parallel on the pool
+     *
+     * @param pool
+     */
+    explicit FileHasher(std::shared_ptr<ThreadPool> pool);
+
+    FileHasher(const FileHasher &) = delete;
+    FileHasher &operator=(const FileHasher &) = delete;
+    FileHasher(FileHasher &&) = delete;
+    FileHasher &operator=(FileHasher &&) = delete;
+    ~FileHasher() override = default;
+
+    [[nodiscard]]
+    Result<FileHash, FileError> hashFile(const std::filesystem::path &filePath,
+                                         HashAlgorithm algorithm) const override;
+
+    [[nodiscard]]
+    std::vector<Result<FileHash, FileError>>
+        hashFiles(std::span<const std::filesystem::path> filePaths,
+                  HashAlgorithm algorithm) const override;
+
+  private:
+    std::shared_ptr<ThreadPool> pool_;
+  };
+
+} // namespace nixoncpp::utils
@@ -1,12 +1,140 @@
 #include "FileReader.hpp"
+#include <Utils/Filesystem/PosixIo.hpp>
+#include <algorithm>
 #include <fmt/core.h>
 #include <fstream>
+#include <numeric>
+#include <optional>
 #include <sstream>
 #include <system_error>
+#include <utility>
 
 namespace nixoncpp::utils {
 
+  namespace {
+    /**
+     * @brief Indices of paths ordered by (device, inode)
+     *
+     * Filesystems allocate data close to the inode, so visiting files in inode order turns a
+     * batch of cold reads into a mostly forward sweep. Paths that cannot be stat'ed keep their
+     * relative order at the front; their read reports the error.
+     *
+     * @param filePaths
+     * @return std::vector<std::size_t>
+     */
+    std::vector<std::size_t> localityOrder(std::span<const std::filesystem::path> filePaths) {
+      std::vector<std::size_t> order(filePaths.size());
+      std::iota(order.begin(), order.end(), std::size_t{0});
+#if defined(NIXONCPP_HAS_POSIX_IO)
+      std::vector<std::pair<std::uint64_t, std::uint64_t>> keys(filePaths.size());
+      for (std::size_t i = 0; i < filePaths.size(); ++i) {
+        struct stat info{};
+        if (::stat(filePaths[i].c_str(), &info) == 0) {
+          keys[i] = {static_cast<std::uint64_t>(info.st_dev),
+                     static_cast<std::uint64_t>(info.st_ino)};
+        }
+      }
+      std::stable_sort(order.begin(), order.end(),
+                       [&keys](std::size_t lhs, std::size_t rhs) { return keys[lhs] < keys[rhs]; });
+#endif
+      return order;
+    }
+  } // namespace
+
+#if defined(NIXONCPP_HAS_POSIX_IO)
+  namespace {
+    constexpr std::size_t kMinReadChunk = 4096;
+
+    /**
+     * @brief Read a whole file with one open, one fstat and a sized read loop
+     *
+     * The buffer is allocated once from st_size. Files whose size is unknown or changes while
+     * reading (e.g. procfs) are handled by growing the buffer until read() reports EOF.
+     *
+     * @tparam Buffer std::string or std::vector<uint8_t>
+     * @param filePath
+     * @param pattern Page cache hint, see ReadOptions
+     * @return Result<Buffer, FileError>
+     */
+    template <typename Buffer>
+    Result<Buffer, FileError> readWholeFile(const std::filesystem::path &filePath,
+                                            AccessPattern pattern) {
+      if (filePath.empty()) {
+        return FileError{
+            .code = FileErrorCode::InvalidPath,
+            .message = "Empty file path",
+            .path = "",
+        };
+      }
+
+      auto fd = detail::openFile(filePath, O_RDONLY);
+      if (!fd) {
+        return detail::makeErrnoError(errno, FileErrorCode::ReadError,
+                                      "Failed to open file for reading", filePath);
+      }
+
+      struct stat info{};
+      if (::fstat(fd.get(), &info) != 0) {
+        return detail::makeErrnoError(errno, FileErrorCode::ReadError, "Failed to stat file",
+                                      filePath);
+      }
+      if (S_ISDIR(info.st_mode)) {
+        return FileError{
+            .code = FileErrorCode::IsDirectory,
+            .message = "Path is a directory, not a file",
+            .path = filePath.string(),
+        };
+      }
+
+      if (pattern != AccessPattern::Normal && pattern != AccessPattern::DontNeed) {
+        detail::adviseFile(fd.get(), 0, 0, pattern);
+      }
+
+      Buffer buffer;
+      // One extra byte lets a correctly sized read observe EOF without growing the buffer
+      buffer.resize(static_cast<std::size_t>(info.st_size) + 1);
+      std::size_t total = 0;
+      for (;;) {
+        if (total == buffer.size()) {
+          buffer.resize(std::max(buffer.size() * 2, kMinReadChunk));
+        }
+        const auto got = ::read(fd.get(), buffer.data() + total, buffer.size() - total);
+        if (got < 0) {
+          if (errno == EINTR) {
+            continue;
+          }
+          return detail::makeErrnoError(errno, FileErrorCode::ReadError,
+                                        "I/O error while reading file", filePath);
+        }
+        if (got == 0) {
+          break;
+        }
+        total += static_cast<std::size_t>(got);
+      }
+      buffer.resize(total);
+      if (pattern == AccessPattern::DontNeed) {
+        detail::adviseFile(fd.get(), 0, 0, pattern);
+      }
+      return buffer;
+    }
+  } // namespace
+#endif
+
   Result<std::string, FileError> FileReader::read(const std::filesystem::path &filePath) const {
+    return read(filePath, ReadOptions{});
+  }
+
+  Result<std::vector<uint8_t>, FileError>
+      FileReader::readBytes(const std::filesystem::path &filePath) const {
+    return readBytes(filePath, ReadOptions{});
+  }
+
+  Result<std::string, FileError> FileReader::read(const std::filesystem::path &filePath,
+                                                  const ReadOptions &options) const {
+#if defined(NIXONCPP_HAS_POSIX_IO)
+    return readWholeFile<std::string>(filePath, options.pattern);
+#else
+    (void)options;
     if (auto error = validatePath(filePath)) {
       return *error;
     }
@@ -32,10 +160,16 @@ namespace nixoncpp::utils {
     }
 
     return buffer.str();
+#endif
   }
 
   Result<std::vector<uint8_t>, FileError>
-      FileReader::readBytes(const std::filesystem::path &filePath) const {
+      FileReader::readBytes(const std::filesystem::path &filePath,
+                            const ReadOptions &options) const {
+#if defined(NIXONCPP_HAS_POSIX_IO)
+    return readWholeFile<std::vector<uint8_t>>(filePath, options.pattern);
+#else
+    (void)options;
     if (auto error = validatePath(filePath)) {
       return *error;
     }
@@ -69,6 +203,7 @@ namespace nixoncpp::utils {
     }
 
     return buffer;
+#endif
   }
 
   Result<std::vector<std::string>, FileError>
@@ -104,6 +239,146 @@ namespace nixoncpp::utils {
     return lines;
   }
 
+  Result<std::size_t, FileError> FileReader::readInto(const std::filesystem::path &filePath,
+                                                      std::span<std::byte> destination,
+                                                      std::uint64_t offset) const {
+    if (filePath.empty()) {
+      return FileError{
+          .code = FileErrorCode::InvalidPath,
+          .message = "Empty file path",
+          .path = "",
+      };
+    }
+
+#if defined(NIXONCPP_HAS_POSIX_IO)
+    std::shared_ptr<const FileHandle> cached;
+    detail::UniqueFd owned;
+    int fd = -1;
+    if (handleCache_) {
+      auto handle = handleCache_->acquire(filePath);
+      if (!handle) {
+        return handle.error();
+      }
+      cached = std::move(handle.value());
+      fd = cached->fd();
+    } else {
+      owned = detail::openFile(filePath, O_RDONLY);
+      if (!owned) {
+        return detail::makeErrnoError(errno, FileErrorCode::ReadError,
+                                      "Failed to open file for reading", filePath);
+      }
+      fd = owned.get();
+    }
+
+    std::size_t total = 0;
+    while (total < destination.size()) {
+      const auto got = ::pread(fd, destination.data() + total, destination.size() - total,
+                               static_cast<off_t>(offset + total));
+      if (got < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        const int err = errno;
+        if (handleCache_) {
+          handleCache_->invalidate(filePath);
+        }
+        return detail::makeErrnoError(err, FileErrorCode::ReadError,
+                                      "I/O error while reading file", filePath);
+      }
+      if (got == 0) {
+        break;
+      }
+      total += static_cast<std::size_t>(got);
+    }
+    return total;
+#else
+    if (auto error = validatePath(filePath)) {
+      return *error;
+    }
+
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+      return FileError{
+          .code = FileErrorCode::ReadError,
+          .message = "Failed to open file for reading",
+          .path = filePath.string(),
+      };
+    }
+    file.seekg(static_cast<std::streamoff>(offset));
+    file.read(reinterpret_cast<char *>(destination.data()),
+              static_cast<std::streamsize>(destination.size()));
+    if (file.bad()) {
+      return FileError{
+          .code = FileErrorCode::ReadError,
+          .message = "I/O error while reading file",
+          .path = filePath.string(),
+      };
+    }
+    return static_cast<std::size_t>(file.gcount());
+#endif
+  }
+
+  Result<std::vector<uint8_t>, FileError>
+      FileReader::readRange(const std::filesystem::path &filePath, std::uint64_t offset,
+                            std::size_t length) const {
+    std::vector<uint8_t> buffer(length);
+    auto got = readInto(filePath, std::as_writable_bytes(std::span(buffer)), offset);
+    if (!got) {
+      return got.error();
+    }
+    buffer.resize(got.value());
+    return buffer;
+  }
+
+  std::vector<Result<std::string, FileError>>
+      FileReader::readMany(std::span<const std::filesystem::path> filePaths) const {
+    const auto order = localityOrder(filePaths);
+    std::vector<Result<std::string, FileError>> results;
+    results.reserve(filePaths.size());
+
+    if (const auto &asyncIo = this->asyncIo()) {
+      // Everything is queued before the first wait so the backend can overlap the reads
+      std::vector<AsyncFileResult<std::string>> pending(filePaths.size());
+      for (const auto index : order) {
+        pending[index] = asyncIo->read(filePaths[index]);
+      }
+      for (auto &future : pending) {
+        results.push_back(future.get());
+      }
+      return results;
+    }
+
+    std::vector<std::optional<Result<std::string, FileError>>> slots(filePaths.size());
+    for (const auto index : order) {
+      slots[index].emplace(read(filePaths[index]));
+    }
+    for (auto &slot : slots) {
+      results.push_back(std::move(*slot));
+    }
+    return results;
+  }
+
+  const std::shared_ptr<IAsyncFileIO> &FileReader::asyncIo() const {
+    if (makeAsyncIo_) {
+      std::call_once(asyncIoOnce_, [this] { asyncIo_ = makeAsyncIo_(); });
+    }
+    return asyncIo_;
+  }
+
+  Result<LineReader, FileError> FileReader::lines(const std::filesystem::path &filePath,
+                                                  std::size_t chunkSize) const {
+    return LineReader::open(filePath, chunkSize);
+  }
+
+  Result<MappedFile, FileError> FileReader::map(const std::filesystem::path &filePath,
+                                                AccessPattern pattern) const {
+    if (auto error = validatePath(filePath)) {
+      return *error;
+    }
+
+    return MappedFile::open(filePath, pattern);
+  }
+
   bool FileReader::exists(const std::filesystem::path &filePath) const {
     std::error_code ec;
     return std::filesystem::is_regular_file(filePath, ec) && !ec;
@@ -111,6 +386,29 @@ namespace nixoncpp::utils {
 
   Result<std::uintmax_t, FileError>
       FileReader::getSize(const std::filesystem::path &filePath) const {
+#if defined(NIXONCPP_HAS_POSIX_IO)
+    if (filePath.empty()) {
+      return FileError{
+          .code = FileErrorCode::InvalidPath,
+          .message = "Empty file path",
+          .path = "",
+      };
+    }
+
+    struct stat info{};
+    if (::stat(filePath.c_str(), &info) != 0) {
+      return detail::makeErrnoError(errno, FileErrorCode::ReadError, "Failed to get file size",
+                                    filePath);
+    }
+    if (S_ISDIR(info.st_mode)) {
+      return FileError{
+          .code = FileErrorCode::IsDirectory,
+          .message = "Path is a directory, not a file",
+          .path = filePath.string(),
+      };
+    }
+    return static_cast<std::uintmax_t>(info.st_size);
+#else
     if (auto error = validatePath(filePath)) {
       return *error;
     }
@@ -127,6 +425,7 @@ namespace nixoncpp::utils {
     }
 
     return size;
+#endif
   }
 
   std::optional<FileError> FileReader::validatePath(const std::filesystem::path &filePath) {
@@ -1,12 +1,57 @@
 #pragma once
 
+#include <Utils/Filesystem/FileHandleCache.hpp>
+#include <Utils/Filesystem/IAsyncFileIO.hpp>
 #include <Utils/Filesystem/IFileReader.hpp>
+#include <functional>
+#include <memory>
+#include <mutex>
 
 namespace nixoncpp::utils {
 
   class FileReader final : public IFileReader {
   public:
+    /**
+     * @brief Creates the asynchronous backend of a reader when readMany() first needs it
+     */
+    using AsyncFileIOFactory = std::function<std::shared_ptr<IAsyncFileIO>()>;
+
+    /**
+     * @brief Reader without an asynchronous backend; readMany() reads the files one by one
+     *
+     * UtilsFactory::createFileReader() returns a reader whose readMany() is concurrent.
+     */
     FileReader() = default;
+
+    /**
+     * @brief Reader whose readMany() creates its backend on first use and keeps it
+     *
+     * No backend (and none of its threads) exists until readMany() is called.
+     *
+     * @param makeAsyncIo
+     */
+    explicit FileReader(AsyncFileIOFactory makeAsyncIo) : makeAsyncIo_(std::move(makeAsyncIo)) {}
+
+    /**
+     * @brief Reader whose readMany() issues the reads through an asynchronous backend
+     *
+     * @param asyncIo
+     * @param handleCache Optional descriptor cache used by readInto()/readRange()
+     */
+    explicit FileReader(std::shared_ptr<IAsyncFileIO> asyncIo,
+                        std::shared_ptr<FileHandleCache> handleCache = nullptr)
+        : asyncIo_(std::move(asyncIo)), handleCache_(std::move(handleCache)) {}
+
+    /**
+     * @brief Reader whose readInto()/readRange() reuse descriptors instead of reopening files
+     *
+     * readMany() reads the files one by one.
+     *
+     * @param handleCache
+     */
+    explicit FileReader(std::shared_ptr<FileHandleCache> handleCache)
+        : handleCache_(std::move(handleCache)) {}
+
     FileReader(const FileReader &) = delete;
     FileReader &operator=(const FileReader &) = delete;
     FileReader(FileReader &&) = delete;
@@ -20,10 +65,42 @@ namespace nixoncpp::utils {
     Result<std::vector<uint8_t>, FileError>
         readBytes(const std::filesystem::path &filePath) const override;
 
+    [[nodiscard]]
+    Result<std::string, FileError> read(const std::filesystem::path &filePath,
+                                        const ReadOptions &options) const override;
+
+    [[nodiscard]]
+    Result<std::vector<uint8_t>, FileError>
+        readBytes(const std::filesystem::path &filePath, const ReadOptions &options) const override;
+
     [[nodiscard]]
     Result<std::vector<std::string>, FileError>
         readLines(const std::filesystem::path &filePath) const override;
 
+    [[nodiscard]]
+    Result<std::size_t, FileError> readInto(const std::filesystem::path &filePath,
+                                            std::span<std::byte> destination,
+                                            std::uint64_t offset = 0) const override;
+
+    [[nodiscard]]
+    Result<std::vector<uint8_t>, FileError> readRange(const std::filesystem::path &filePath,
+                                                      std::uint64_t offset,
+                                                      std::size_t length) const override;
+
+    [[nodiscard]]
+    std::vector<Result<std::string, FileError>>
+        readMany(std::span<const std::filesystem::path> filePaths) const override;
+
+    [[nodiscard]]
+    Result<LineReader, FileError>
+        lines(const std::filesystem::path &filePath,
+              std::size_t chunkSize = LineReader::kDefaultChunkSize) const override;
+
+    [[nodiscard]]
+    Result<MappedFile, FileError>
+        map(const std::filesystem::path &filePath,
+            AccessPattern pattern = AccessPattern::Sequential) const override;
+
     [[nodiscard]]
     bool exists(const std::filesystem::path &filePath) const override;
 
@@ -33,6 +110,15 @@ namespace nixoncpp::utils {
   private:
     [[nodiscard]]
     static std::optional<FileError> validatePath(const std::filesystem::path &filePath);
+
+    // Backend for readMany(), created by makeAsyncIo_ on first use when not given
+    [[nodiscard]]
+    const std::shared_ptr<IAsyncFileIO> &asyncIo() const;
+
+    mutable std::shared_ptr<IAsyncFileIO> asyncIo_;
+    std::shared_ptr<FileHandleCache> handleCache_;
+    AsyncFileIOFactory makeAsyncIo_;
+    mutable std::once_flag asyncIoOnce_;
   };
 
 } // namespace nixoncpp::utils
\ No newline at end of file
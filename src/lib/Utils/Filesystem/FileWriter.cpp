@@ -1,12 +1,204 @@
 #include "FileWriter.hpp"
+#include <Utils/Filesystem/PosixIo.hpp>
+#include <array>
+#include <cstring>
 #include <fmt/core.h>
 #include <fstream>
+#include <string>
 #include <system_error>
+#include <utility>
 
 namespace nixoncpp::utils {
 
+  namespace {
+    // Writes at least this large reserve their space up front even without an expectedSize
+    constexpr std::uintmax_t kPreallocateThreshold = 1024 * 1024;
+
+    /**
+     * @brief Write a buffer in one go, applying the placement and page cache hints
+     *
+     * @param filePath
+     * @param content
+     * @param options
+     * @param mode std::ios::out or std::ios::binary for the stream fallback
+     * @return Result<void, FileError>
+     */
+    Result<void, FileError> writeContent(const std::filesystem::path &filePath,
+                                         std::string_view content, const WriteOptions &options,
+                                         [[maybe_unused]] std::ios::openmode mode) {
+#if defined(NIXONCPP_HAS_POSIX_IO)
+      auto fd = detail::openFile(filePath,
+                                 O_WRONLY | O_CREAT | (options.append ? O_APPEND : O_TRUNC));
+      if (!fd) {
+        return detail::makeErrnoError(errno, FileErrorCode::WriteError,
+                                      "Failed to open file for writing", filePath);
+      }
+
+      off_t start = 0;
+      struct stat info{};
+      if (options.append && ::fstat(fd.get(), &info) == 0) {
+        start = info.st_size;
+      }
+      std::uintmax_t reserveEnd = options.expectedSize;
+      if (reserveEnd == 0 && content.size() >= kPreallocateThreshold) {
+        reserveEnd = static_cast<std::uintmax_t>(start) + content.size();
+      }
+      if (reserveEnd > static_cast<std::uintmax_t>(start)) {
+        detail::reserveSpace(fd.get(), start, static_cast<off_t>(reserveEnd) - start);
+      }
+
+      iovec piece{.iov_base = const_cast<char *>(content.data()), .iov_len = content.size()};
+      if (!detail::writeAllVectored(fd.get(), std::span(&piece, 1))) {
+        return detail::makeErrnoError(errno, FileErrorCode::WriteError,
+                                      "I/O error while writing file", filePath);
+      }
+      if (options.pattern == AccessPattern::DontNeed) {
+        detail::dropWrittenPages(fd.get(), start, static_cast<off_t>(content.size()));
+      }
+      return {};
+#else
+      std::ofstream file(filePath, options.append ? (mode | std::ios::app) : mode);
+
+      if (!file.is_open()) {
+        return FileError{
+            .code = FileErrorCode::WriteError,
+            .message = "Failed to open file for writing",
+            .path = filePath.string(),
+        };
+      }
+
+      file.write(content.data(), static_cast<std::streamsize>(content.size()));
+
+      if (file.bad()) {
+        return FileError{
+            .code = FileErrorCode::WriteError,
+            .message = "I/O error while writing file",
+            .path = filePath.string(),
+        };
+      }
+
+      return {};
+#endif
+    }
+
+    /**
+     * @brief Write each line followed by a newline without copying the lines
+     *
+     * On POSIX long lines are gathered straight from the callers' buffers, interleaved with
+     * one shared newline, and written with writev(2) in batches of up to kMaxIovecs pieces.
+     */
+    template <typename Lines>
+    Result<void, FileError> writeLineBatches(const std::filesystem::path &filePath,
+                                             const Lines &lines, bool append) {
+#if defined(NIXONCPP_HAS_POSIX_IO)
+      auto fd = detail::openFile(filePath, O_WRONLY | O_CREAT | (append ? O_APPEND : O_TRUNC));
+      if (!fd) {
+        return detail::makeErrnoError(errno, FileErrorCode::WriteError,
+                                      "Failed to open file for writing", filePath);
+      }
+
+      // Per-segment cost in the kernel outweighs a copy for short lines: those are coalesced
+      // (with their newlines) into one staging run, longer lines are gathered in place.
+      static constexpr std::size_t kGatherThreshold = 256;
+      static constexpr std::size_t kStagingSize = 64 * 1024;
+      static constexpr char kNewline = '\n';
+      std::array<iovec, detail::kMaxIovecs> batch{};
+      std::size_t used = 0;
+      std::string staging(kStagingSize, '\0');
+      std::size_t staged = 0;
+      bool stagingIsLast = false; // The last piece is the open staging run
+      bool ok = true;
+
+      const auto flush = [&] {
+        ok = detail::writeAllVectored(fd.get(), std::span(batch.data(), used));
+        used = 0;
+        staged = 0;
+        stagingIsLast = false;
+        return ok;
+      };
+      const auto push = [&](const char *data, std::size_t size) {
+        batch[used++] = {.iov_base = const_cast<char *>(data), .iov_len = size};
+      };
+
+      for (const std::string_view line : lines) {
+        if (line.size() < kGatherThreshold) {
+          if ((staging.size() - staged < line.size() + 1 || used == batch.size()) && !flush()) {
+            break;
+          }
+          char *dst = staging.data() + staged;
+          std::memcpy(dst, line.data(), line.size());
+          dst[line.size()] = kNewline;
+          staged += line.size() + 1;
+          if (stagingIsLast) {
+            batch[used - 1].iov_len += line.size() + 1;
+          } else {
+            push(dst, line.size() + 1);
+            stagingIsLast = true;
+          }
+          continue;
+        }
+        if (used + 2 > batch.size() && !flush()) {
+          break;
+        }
+        push(line.data(), line.size());
+        push(&kNewline, 1);
+        stagingIsLast = false;
+      }
+      if (ok && used != 0) {
+        flush();
+      }
+      if (!ok) {
+        return detail::makeErrnoError(errno, FileErrorCode::WriteError,
+                                      "I/O error while writing file", filePath);
+      }
+      return {};
+#else
+      auto mode = append ? (std::ios::out | std::ios::app) : std::ios::out;
+      std::ofstream file(filePath, mode);
+
+      if (!file.is_open()) {
+        return FileError{
+            .code = FileErrorCode::WriteError,
+            .message = "Failed to open file for writing",
+            .path = filePath.string(),
+        };
+      }
+
+      for (const std::string_view line : lines) {
+        file.write(line.data(), static_cast<std::streamsize>(line.size()));
+        file.put('\n');
+      }
+
+      if (file.bad()) {
+        return FileError{
+            .code = FileErrorCode::WriteError,
+            .message = "I/O error while writing file",
+            .path = filePath.string(),
+        };
+      }
+
+      return {};
+#endif
+    }
+  } // namespace
+
+  FileWriter::FileWriter(std::shared_ptr<GroupCommitter> groupCommit)
+      : groupCommit_(std::move(groupCommit)) {}
+
   Result<void, FileError> FileWriter::write(const std::filesystem::path &filePath,
                                             const std::string &content, bool append) const {
+    return write(filePath, std::string_view(content), WriteOptions{.append = append});
+  }
+
+  Result<void, FileError> FileWriter::writeBytes(const std::filesystem::path &filePath,
+                                                 const std::vector<uint8_t> &data,
+                                                 bool append) const {
+    return writeBytes(filePath, std::span<const uint8_t>(data), WriteOptions{.append = append});
+  }
+
+  Result<void, FileError> FileWriter::write(const std::filesystem::path &filePath,
+                                            std::string_view content,
+                                            const WriteOptions &options) const {
     if (auto error = validatePath(filePath, false)) {
       return *error;
     }
@@ -15,32 +207,27 @@ namespace nixoncpp::utils {
       return *error;
     }
 
-    auto mode = append ? (std::ios::out | std::ios::app) : std::ios::out;
-    std::ofstream file(filePath, mode);
+    return writeContent(filePath, content, options, std::ios::out);
+  }
 
-    if (!file.is_open()) {
-      return FileError{
-          .code = FileErrorCode::WriteError,
-          .message = "Failed to open file for writing",
-          .path = filePath.string(),
-      };
+  Result<void, FileError> FileWriter::writeBytes(const std::filesystem::path &filePath,
+                                                 std::span<const uint8_t> data,
+                                                 const WriteOptions &options) const {
+    if (auto error = validatePath(filePath, false)) {
+      return *error;
     }
 
-    file << content;
-
-    if (file.bad()) {
-      return FileError{
-          .code = FileErrorCode::WriteError,
-          .message = "I/O error while writing file",
-          .path = filePath.string(),
-      };
+    if (auto error = ensureParentExists(filePath)) {
+      return *error;
     }
 
-    return {}; // Success - Result<void, E> default constructs to success
+    return writeContent(filePath,
+                        std::string_view(reinterpret_cast<const char *>(data.data()), data.size()),
+                        options, std::ios::binary);
   }
 
-  Result<void, FileError> FileWriter::writeBytes(const std::filesystem::path &filePath,
-                                                 const std::vector<uint8_t> &data,
+  Result<void, FileError> FileWriter::writeLines(const std::filesystem::path &filePath,
+                                                 const std::vector<std::string> &lines,
                                                  bool append) const {
     if (auto error = validatePath(filePath, false)) {
       return *error;
@@ -50,33 +237,39 @@ namespace nixoncpp::utils {
       return *error;
     }
 
-    auto mode = append ? (std::ios::binary | std::ios::app) : std::ios::binary;
-    std::ofstream file(filePath, mode);
+    return writeLineBatches(filePath, lines, append);
+  }
 
-    if (!file.is_open()) {
-      return FileError{
-          .code = FileErrorCode::WriteError,
-          .message = "Failed to open file for writing",
-          .path = filePath.string(),
-      };
+  Result<void, FileError> FileWriter::writeLines(const std::filesystem::path &filePath,
+                                                 std::span<const std::string_view> lines,
+                                                 bool append) const {
+    if (auto error = validatePath(filePath, false)) {
+      return *error;
     }
 
-    file.write(reinterpret_cast<const char *>(data.data()), data.size());
+    if (auto error = ensureParentExists(filePath)) {
+      return *error;
+    }
 
-    if (file.bad()) {
-      return FileError{
-          .code = FileErrorCode::WriteError,
-          .message = "I/O error while writing file",
-          .path = filePath.string(),
-      };
+    return writeLineBatches(filePath, lines, append);
+  }
+
+  Result<FileAppender, FileError>
+      FileWriter::openAppender(const std::filesystem::path &filePath,
+                               const AppenderOptions &options) const {
+    if (auto error = validatePath(filePath, false)) {
+      return *error;
     }
 
-    return {};
+    if (auto error = ensureParentExists(filePath)) {
+      return *error;
+    }
+
+    return FileAppender::open(filePath, options);
   }
 
-  Result<void, FileError> FileWriter::writeLines(const std::filesystem::path &filePath,
-                                                 const std::vector<std::string> &lines,
-                                                 bool append) const {
+  Result<void, FileError> FileWriter::writeAtomic(const std::filesystem::path &filePath,
+                                                  std::string_view content) const {
     if (auto error = validatePath(filePath, false)) {
       return *error;
     }
@@ -85,30 +278,30 @@ namespace nixoncpp::utils {
       return *error;
     }
 
-    auto mode = append ? (std::ios::out | std::ios::app) : std::ios::out;
-    std::ofstream file(filePath, mode);
+    return groupCommit_->replace(filePath, content);
+  }
 
-    if (!file.is_open()) {
+  Result<std::uintmax_t, FileError>
+      FileWriter::copyFile(const std::filesystem::path &source,
+                           const std::filesystem::path &destination,
+                           const CopyOptions &options) const {
+    if (source.empty()) {
       return FileError{
-          .code = FileErrorCode::WriteError,
-          .message = "Failed to open file for writing",
-          .path = filePath.string(),
+          .code = FileErrorCode::InvalidPath,
+          .message = "Empty file path",
+          .path = "",
       };
     }
 
-    for (const auto &line : lines) {
-      file << line << '\n';
+    if (auto error = validatePath(destination, false)) {
+      return *error;
     }
 
-    if (file.bad()) {
-      return FileError{
-          .code = FileErrorCode::WriteError,
-          .message = "I/O error while writing file",
-          .path = filePath.string(),
-      };
+    if (auto error = ensureParentExists(destination)) {
+      return *error;
     }
 
-    return {};
+    return detail::copyFileContents(source, destination, options);
   }
 
   Result<void, FileError> FileWriter::touch(const std::filesystem::path &filePath) const {
@@ -1,12 +1,25 @@
 #pragma once
 
+#include <Utils/Filesystem/GroupCommitter.hpp>
 #include <Utils/Filesystem/IFileWriter.hpp>
+#include <memory>
 
 namespace nixoncpp::utils {
 
   class FileWriter final : public IFileWriter {
   public:
+    /**
+     * @brief Writer with a committer of its own; other writers never join its batches
+     */
     FileWriter() = default;
+
+    /**
+     * @brief Writer whose writeAtomic() calls join the batches of a shared committer
+     *
+     * @param groupCommit
+     */
+    explicit FileWriter(std::shared_ptr<GroupCommitter> groupCommit);
+
     FileWriter(const FileWriter &) = delete;
     FileWriter &operator=(const FileWriter &) = delete;
     FileWriter(FileWriter &&) = delete;
@@ -22,11 +35,39 @@ namespace nixoncpp::utils {
                                        const std::vector<uint8_t> &data,
                                        bool append = false) const override;
 
+    [[nodiscard]]
+    Result<void, FileError> write(const std::filesystem::path &filePath, std::string_view content,
+                                  const WriteOptions &options) const override;
+
+    [[nodiscard]]
+    Result<void, FileError> writeBytes(const std::filesystem::path &filePath,
+                                       std::span<const uint8_t> data,
+                                       const WriteOptions &options) const override;
+
     [[nodiscard]]
     Result<void, FileError> writeLines(const std::filesystem::path &filePath,
                                        const std::vector<std::string> &lines,
                                        bool append = false) const override;
 
+    [[nodiscard]]
+    Result<void, FileError> writeLines(const std::filesystem::path &filePath,
+                                       std::span<const std::string_view> lines,
+                                       bool append = false) const override;
+
+    [[nodiscard]]
+    Result<FileAppender, FileError>
+        openAppender(const std::filesystem::path &filePath,
+                     const AppenderOptions &options = AppenderOptions{}) const override;
+
+    [[nodiscard]]
+    Result<void, FileError> writeAtomic(const std::filesystem::path &filePath,
+                                        std::string_view content) const override;
+
+    [[nodiscard]]
+    Result<std::uintmax_t, FileError>
+        copyFile(const std::filesystem::path &source, const std::filesystem::path &destination,
+                 const CopyOptions &options = CopyOptions{}) const override;
+
     [[nodiscard]]
     Result<void, FileError> touch(const std::filesystem::path &filePath) const override;
 
@@ -37,6 +78,8 @@ namespace nixoncpp::utils {
 
     [[nodiscard]]
     static std::optional<FileError> ensureParentExists(const std::filesystem::path &filePath);
+
+    std::shared_ptr<GroupCommitter> groupCommit_ = std::make_shared<GroupCommitter>();
   };
 
 } // namespace nixoncpp::utils
\ No newline at end of file
@@ -0,0 +1,452 @@
+#include "GlobMatcher.hpp"
+#include <algorithm>
+#include <bit>
+#include <bitset>
+#include <fmt/core.h>
+#include <map>
+#include <string>
+
+namespace nixoncpp::utils {
+
+  namespace {
+    using ByteSet = std::bitset<256>;
+
+    constexpr auto kNoTarget = static_cast<std::uint32_t>(-1);
+
+    enum class TokenKind : std::uint8_t {
+      Byte,           // One byte of a set
+      Star,           // Any run of bytes within a component
+      AnyDirectories, // "**/": zero or more whole components
+      AnyBelow,       // Trailing "**": one or more bytes, '/' included
+    };
+
+    struct Token {
+      TokenKind kind = TokenKind::Byte;
+      ByteSet bytes{};
+    };
+
+    struct StateSpec {
+      ByteSet loop{};    // Bytes that keep the state
+      ByteSet advance{}; // Bytes that move to target
+      std::uint32_t target = kNoTarget;
+      std::uint32_t epsilonTarget = kNoTarget; // Reached without consuming input
+    };
+
+    ByteSet singleByte(unsigned char byte) {
+      ByteSet set;
+      set.set(byte);
+      return set;
+    }
+
+    ByteSet anyByte() {
+      ByteSet set;
+      set.set();
+      return set;
+    }
+
+    ByteSet anyButSlash() {
+      auto set = anyByte();
+      set.reset('/');
+      return set;
+    }
+
+    // Index of the ']' closing the bracket expression opened at open, or npos
+    std::size_t findClassEnd(std::string_view pattern, std::size_t open) {
+      auto i = open + 1;
+      if (i < pattern.size() && (pattern[i] == '!' || pattern[i] == '^')) {
+        ++i;
+      }
+      if (i < pattern.size() && pattern[i] == ']') {
+        ++i; // A leading ']' is a member
+      }
+      for (; i < pattern.size(); ++i) {
+        if (pattern[i] == '\\') {
+          ++i;
+        } else if (pattern[i] == ']') {
+          return i;
+        }
+      }
+      return std::string_view::npos;
+    }
+
+    // Members of a bracket expression, given the text between '[' and ']'
+    ByteSet parseClass(std::string_view body) {
+      ByteSet set;
+      std::size_t i = 0;
+      const bool negate = !body.empty() && (body[0] == '!' || body[0] == '^');
+      if (negate) {
+        ++i;
+      }
+      const auto take = [&body, &i] {
+        if (body[i] == '\\' && i + 1 < body.size()) {
+          ++i;
+        }
+        return static_cast<unsigned char>(body[i++]);
+      };
+      while (i < body.size()) {
+        const unsigned low = take();
+        unsigned high = low;
+        if (i + 1 < body.size() && body[i] == '-') {
+          ++i;
+          high = take();
+        }
+        for (auto byte = low; byte <= high; ++byte) {
+          set.set(byte);
+        }
+      }
+      if (negate) {
+        set.flip();
+      }
+      set.reset('/'); // Never matched by a single-byte wildcard
+      return set;
+    }
+
+    std::vector<Token> tokenize(std::string_view pattern) {
+      std::vector<Token> tokens;
+      bool componentStart = true;
+      std::size_t i = 0;
+      while (i < pattern.size()) {
+        const char c = pattern[i];
+        if (c == '*') {
+          auto end = i;
+          while (end < pattern.size() && pattern[end] == '*') {
+            ++end;
+          }
+          if (componentStart && end - i >= 2 && (end == pattern.size() || pattern[end] == '/')) {
+            if (end == pattern.size()) {
+              tokens.push_back(Token{.kind = TokenKind::AnyBelow});
+              i = end;
+            } else {
+              tokens.push_back(Token{.kind = TokenKind::AnyDirectories});
+              i = end + 1; // The '/' is part of the token
+            }
+            continue;
+          }
+          if (tokens.empty() || tokens.back().kind != TokenKind::Star) {
+            tokens.push_back(Token{.kind = TokenKind::Star});
+          }
+          i = end;
+          componentStart = false;
+          continue;
+        }
+
+        ByteSet bytes;
+        std::size_t close = std::string_view::npos;
+        if (c == '?') {
+          bytes = anyButSlash();
+        } else if (c == '[' && (close = findClassEnd(pattern, i)) != std::string_view::npos) {
+          bytes = parseClass(pattern.substr(i + 1, close - i - 1));
+          i = close;
+        } else if (c == '\\' && i + 1 < pattern.size()) {
+          bytes = singleByte(static_cast<unsigned char>(pattern[++i]));
+        } else {
+          bytes = singleByte(static_cast<unsigned char>(c));
+        }
+        ++i;
+        componentStart = c == '/';
+        tokens.push_back(Token{.kind = TokenKind::Byte, .bytes = bytes});
+      }
+      return tokens;
+    }
+
+    // Expand the first {a,b,...} group and recurse on each alternative; a brace without a
+    // matching '}' or a top-level ',' is literal. False once limit patterns are exceeded.
+    bool expandBraces(std::string_view pattern, std::vector<std::string> &out, std::size_t limit) {
+      if (out.size() >= limit) {
+        return false;
+      }
+      for (std::size_t open = 0; open < pattern.size(); ++open) {
+        if (pattern[open] == '\\') {
+          ++open;
+          continue;
+        }
+        if (pattern[open] == '[') {
+          if (const auto close = findClassEnd(pattern, open); close != std::string_view::npos) {
+            open = close;
+          }
+          continue;
+        }
+        if (pattern[open] != '{') {
+          continue;
+        }
+
+        std::vector<std::size_t> separators{open};
+        std::size_t depth = 0;
+        std::size_t close = std::string_view::npos;
+        for (auto i = open + 1; i < pattern.size() && close == std::string_view::npos; ++i) {
+          switch (pattern[i]) {
+          case '\\': ++i; break;
+          case '{': ++depth; break;
+          case ',':
+            if (depth == 0) {
+              separators.push_back(i);
+            }
+            break;
+          case '}':
+            if (depth == 0) {
+              close = i;
+            } else {
+              --depth;
+            }
+            break;
+          default: break;
+          }
+        }
+        if (close == std::string_view::npos || separators.size() == 1) {
+          continue;
+        }
+
+        separators.push_back(close);
+        const auto prefix = pattern.substr(0, open);
+        const auto suffix = pattern.substr(close + 1);
+        for (std::size_t alt = 0; alt + 1 < separators.size(); ++alt) {
+          const auto begin = separators[alt] + 1;
+          std::string expanded(prefix);
+          expanded.append(pattern.substr(begin, separators[alt + 1] - begin));
+          expanded.append(suffix);
+          if (!expandBraces(expanded, out, limit)) {
+            return false;
+          }
+        }
+        return true;
+      }
+      out.emplace_back(pattern);
+      return true;
+    }
+
+    // Append the states of one brace-free pattern; returns the index of its accepting state
+    std::uint32_t appendStates(const std::vector<Token> &tokens, std::vector<StateSpec> &states) {
+      for (const auto &token : tokens) {
+        const auto self = static_cast<std::uint32_t>(states.size());
+        switch (token.kind) {
+        case TokenKind::Byte:
+          states.push_back(StateSpec{.advance = token.bytes, .target = self + 1});
+          break;
+        case TokenKind::Star:
+          states.push_back(StateSpec{.loop = anyButSlash(), .epsilonTarget = self + 1});
+          break;
+        case TokenKind::AnyDirectories:
+          // self: at a component boundary, done or entering a component; self + 1: inside it
+          states.push_back(StateSpec{
+              .advance = anyButSlash(), .target = self + 1, .epsilonTarget = self + 2});
+          states.push_back(
+              StateSpec{.loop = anyButSlash(), .advance = singleByte('/'), .target = self});
+          break;
+        case TokenKind::AnyBelow:
+          states.push_back(StateSpec{.advance = anyByte(), .target = self + 1});
+          break;
+        }
+      }
+      const auto accepting = static_cast<std::uint32_t>(states.size());
+      states.emplace_back();
+      if (!tokens.empty() && tokens.back().kind == TokenKind::AnyBelow) {
+        states.back().loop = anyByte();
+      }
+      return accepting;
+    }
+
+    FileError patternError(std::string message, std::string_view pattern) {
+      return FileError{
+          .code = FileErrorCode::InvalidPath,
+          .message = std::move(message),
+          .path = std::string(pattern),
+      };
+    }
+  } // namespace
+
+  Result<GlobMatcher, FileError> GlobMatcher::compile(std::string_view pattern) {
+    return compile(std::span<const std::string_view>(&pattern, 1));
+  }
+
+  Result<GlobMatcher, FileError> GlobMatcher::compile(std::span<const std::string_view> patterns) {
+    std::vector<StateSpec> states;
+    std::vector<std::uint32_t> starts;
+    std::vector<std::uint32_t> accepting;
+    std::vector<std::string> expanded;
+    for (const auto pattern : patterns) {
+      expanded.clear();
+      if (!expandBraces(pattern, expanded, kMaxAlternatives)) {
+        return patternError(
+            fmt::format("Glob pattern expands to more than {} alternatives", kMaxAlternatives),
+            pattern);
+      }
+      for (const auto &alternative : expanded) {
+        starts.push_back(static_cast<std::uint32_t>(states.size()));
+        accepting.push_back(appendStates(tokenize(alternative), states));
+        if (states.size() > kMaxStates) {
+          return patternError(
+              fmt::format("Glob patterns need more than {} matcher states", kMaxStates), pattern);
+        }
+      }
+    }
+
+    GlobMatcher matcher;
+    const auto words = std::max<std::size_t>(1, (states.size() + 63) / 64);
+    matcher.words_ = words;
+    const auto setBit = [](std::vector<std::uint64_t> &bits, std::size_t base, std::size_t state) {
+      bits[base + state / 64] |= std::uint64_t{1} << (state % 64);
+    };
+
+    // Bytes with the same transitions in every state share a class and its masks
+    std::map<std::vector<std::uint64_t>, std::uint8_t> classes;
+    std::vector<std::uint64_t> signature(2 * words);
+    for (unsigned byte = 0; byte < 256; ++byte) {
+      std::fill(signature.begin(), signature.end(), 0);
+      for (std::size_t state = 0; state < states.size(); ++state) {
+        if (states[state].loop.test(byte)) {
+          setBit(signature, 0, state);
+        }
+        if (states[state].advance.test(byte)) {
+          setBit(signature, words, state);
+        }
+      }
+      const auto [it, inserted] =
+          classes.try_emplace(signature, static_cast<std::uint8_t>(classes.size()));
+      if (inserted) {
+        matcher.loopMasks_.insert(matcher.loopMasks_.end(), signature.begin(),
+                                  signature.begin() + static_cast<std::ptrdiff_t>(words));
+        matcher.advanceMasks_.insert(matcher.advanceMasks_.end(),
+                                     signature.begin() + static_cast<std::ptrdiff_t>(words),
+                                     signature.end());
+      }
+      matcher.classOf_[byte] = it->second;
+    }
+
+    // Epsilon transitions only point forward, so closures complete from the last state back
+    matcher.targets_.resize(states.size());
+    matcher.closures_.assign(states.size() * words, 0);
+    for (auto state = states.size(); state-- > 0;) {
+      matcher.targets_[state] = states[state].target;
+      setBit(matcher.closures_, state * words, state);
+      if (const auto next = states[state].epsilonTarget; next != kNoTarget) {
+        for (std::size_t word = 0; word < words; ++word) {
+          matcher.closures_[state * words + word] |= matcher.closures_[next * words + word];
+        }
+      }
+    }
+
+    matcher.start_.assign(words, 0);
+    for (const auto start : starts) {
+      for (std::size_t word = 0; word < words; ++word) {
+        matcher.start_[word] |= matcher.closures_[start * words + word];
+      }
+    }
+    matcher.accepting_.assign(words, 0);
+    for (const auto state : accepting) {
+      setBit(matcher.accepting_, 0, state);
+    }
+    matcher.classCount_ = classes.size();
+    matcher.buildDfa();
+    return matcher;
+  }
+
+  void GlobMatcher::buildDfa() {
+    const auto isAccepting = [this](const StateSet &states) {
+      for (std::size_t word = 0; word < words_; ++word) {
+        if ((states[word] & accepting_[word]) != 0) {
+          return std::uint8_t{1};
+        }
+      }
+      return std::uint8_t{0};
+    };
+
+    std::map<StateSet, std::uint32_t> ids;
+    std::vector<StateSet> sets(2);
+    std::copy(start_.begin(), start_.end(), sets[kStartState].begin());
+    ids.emplace(sets[kDeadState], kDeadState);
+    ids.emplace(sets[kStartState], kStartState);
+    for (std::size_t state = 0; state < sets.size(); ++state) {
+      if ((state + 1) * classCount_ > kMaxDfaTransitions) {
+        dfa_.clear();
+        dfaAccepting_.clear();
+        return;
+      }
+      dfaAccepting_.push_back(isAccepting(sets[state]));
+      for (std::size_t byteClass = 0; byteClass < classCount_; ++byteClass) {
+        auto next = sets[state];
+        step(next, byteClass);
+        const auto [it, inserted] = ids.try_emplace(next, static_cast<std::uint32_t>(sets.size()));
+        if (inserted) {
+          sets.push_back(next);
+        }
+        dfa_.push_back(it->second);
+      }
+    }
+  }
+
+  bool GlobMatcher::step(StateSet &states, std::size_t byteClass) const noexcept {
+    const auto *loop = &loopMasks_[byteClass * words_];
+    const auto *advance = &advanceMasks_[byteClass * words_];
+    StateSet next{};
+    const auto addClosure = [this, &next](std::size_t state) {
+      const auto *closure = &closures_[state * words_];
+      for (std::size_t word = 0; word < words_; ++word) {
+        next[word] |= closure[word];
+      }
+    };
+
+    for (std::size_t word = 0; word < words_; ++word) {
+      for (auto bits = states[word] & loop[word]; bits != 0; bits &= bits - 1) {
+        addClosure(word * 64 + static_cast<std::size_t>(std::countr_zero(bits)));
+      }
+      for (auto bits = states[word] & advance[word]; bits != 0; bits &= bits - 1) {
+        addClosure(targets_[word * 64 + static_cast<std::size_t>(std::countr_zero(bits))]);
+      }
+    }
+
+    bool live = false;
+    for (std::size_t word = 0; word < words_; ++word) {
+      states[word] = next[word];
+      live = live || next[word] != 0;
+    }
+    return live;
+  }
+
+  bool GlobMatcher::run(std::string_view text, StateSet &states) const noexcept {
+    std::copy(start_.begin(), start_.end(), states.begin());
+    for (const char c : text) {
+      if (!step(states, classOf_[static_cast<unsigned char>(c)])) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  std::uint32_t GlobMatcher::runDfa(std::string_view text) const noexcept {
+    auto state = kStartState;
+    for (const char c : text) {
+      state = dfa_[state * classCount_ + classOf_[static_cast<unsigned char>(c)]];
+      if (state == kDeadState) {
+        break;
+      }
+    }
+    return state;
+  }
+
+  bool GlobMatcher::matches(std::string_view path) const noexcept {
+    if (!dfa_.empty()) {
+      return dfaAccepting_[runDfa(path)] != 0;
+    }
+    StateSet states{};
+    if (!run(path, states)) {
+      return false;
+    }
+    for (std::size_t word = 0; word < words_; ++word) {
+      if ((states[word] & accepting_[word]) != 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool GlobMatcher::canMatchBelow(std::string_view directory) const noexcept {
+    const auto slash = classOf_[static_cast<unsigned char>('/')];
+    if (!dfa_.empty()) {
+      const auto state = runDfa(directory);
+      return state != kDeadState && dfa_[state * classCount_ + slash] != kDeadState;
+    }
+    StateSet states{};
+    return run(directory, states) && step(states, slash);
+  }
+
+} // namespace nixoncpp::utils
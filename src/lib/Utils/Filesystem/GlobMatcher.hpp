@@ -0,0 +1,124 @@
+#pragma once
+
+#include <Utils/UtilsError.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace nixoncpp::utils {
+
+  /**
+   * @brief Compiled set of glob patterns matched against '/'-separated relative paths
+   *
+   * Syntax: `?` matches one character and `*` any run of characters within a path component,
+   * `[abc]`, `[a-z]` and `[!a-z]` (or `[^a-z]`) match one character of a set, `{a,b}` matches
+   * either alternative (nesting allowed) and `\` escapes the next character. A whole component
+   * `**` matches any number of components: `**` followed by `/` matches zero or more leading
+   * directories, and `**` as the last component matches everything below the directory before
+   * it. Dots are not special. Matching is anchored at both ends and case-sensitive.
+   *
+   * All patterns are compiled into one automaton, so a path is read once however many patterns
+   * there are. The automaton is turned into a DFA table up front when that stays small, making
+   * matching one lookup per byte; otherwise its NFA is simulated with a bitset of states.
+   * Matching does not allocate. The matcher is immutable and may be shared between threads.
+   */
+  class GlobMatcher final {
+  public:
+    static constexpr std::size_t kMaxStates = 1024;
+    static constexpr std::size_t kMaxAlternatives = 1024; // Patterns after brace expansion
+    static constexpr std::size_t kMaxDfaTransitions = std::size_t{1} << 16;
+
+    /**
+     * @brief Compile one pattern
+     *
+     * @param pattern
+     * @return Result<GlobMatcher, FileError> InvalidPath if the pattern is too large
+     */
+    [[nodiscard]]
+    static Result<GlobMatcher, FileError> compile(std::string_view pattern);
+
+    /**
+     * @brief Compile patterns into a matcher that accepts a path matching any of them
+     *
+     * @param patterns
+     * @return Result<GlobMatcher, FileError> InvalidPath if the patterns are too large
+     */
+    [[nodiscard]]
+    static Result<GlobMatcher, FileError> compile(std::span<const std::string_view> patterns);
+
+    /**
+     * @brief Whether a path matches one of the patterns
+     *
+     * @param path Relative path with '/' separators
+     * @return bool
+     */
+    [[nodiscard]]
+    bool matches(std::string_view path) const noexcept;
+
+    /**
+     * @brief Whether a path below a directory can match, used to skip whole subtrees
+     *
+     * @param directory Relative path of the directory with '/' separators
+     * @return bool false if no path starting with "directory/" matches
+     */
+    [[nodiscard]]
+    bool canMatchBelow(std::string_view directory) const noexcept;
+
+    /**
+     * @brief Number of NFA states
+     *
+     * @return std::size_t
+     */
+    [[nodiscard]]
+    std::size_t stateCount() const noexcept {
+      return targets_.size();
+    }
+
+    /**
+     * @brief Whether matching uses a DFA table rather than simulating the NFA
+     *
+     * @return bool
+     */
+    [[nodiscard]]
+    bool isDeterministic() const noexcept {
+      return !dfa_.empty();
+    }
+
+  private:
+    static constexpr std::size_t kMaxWords = kMaxStates / 64;
+    using StateSet = std::array<std::uint64_t, kMaxWords>;
+
+    GlobMatcher() = default;
+
+    static constexpr std::uint32_t kDeadState = 0; // DFA state without NFA states
+    static constexpr std::uint32_t kStartState = 1;
+
+    // Active states after consuming text from the start states; false once none are left
+    bool run(std::string_view text, StateSet &states) const noexcept;
+
+    // Consume one byte of a class; false when no state is left
+    bool step(StateSet &states, std::size_t byteClass) const noexcept;
+
+    // DFA state after consuming text from the start state
+    std::uint32_t runDfa(std::string_view text) const noexcept;
+
+    // Subset construction; leaves dfa_ empty when the table would exceed kMaxDfaTransitions
+    void buildDfa();
+
+    std::size_t words_ = 0;
+    std::array<std::uint8_t, 256> classOf_{}; // Byte -> index of its equivalence class
+    std::vector<std::uint64_t> loopMasks_;    // [class][word]: states staying put on the byte
+    std::vector<std::uint64_t> advanceMasks_; // [class][word]: states moving to their target
+    std::vector<std::uint32_t> targets_;      // [state]
+    std::vector<std::uint64_t> closures_;     // [state][word]: reachable without input
+    std::vector<std::uint64_t> start_;        // [word]
+    std::vector<std::uint64_t> accepting_;    // [word]
+    std::size_t classCount_ = 0;
+    std::vector<std::uint32_t> dfa_;          // [state][class] -> state
+    std::vector<std::uint8_t> dfaAccepting_;  // [state]
+  };
+
+} // namespace nixoncpp::utils
@@ -0,0 +1,284 @@
+#include "GroupCommitter.hpp"
+#include <Utils/Filesystem/PosixIo.hpp>
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace nixoncpp::utils {
+
+  namespace {
+    std::atomic<std::uint64_t> tempCounter{0};
+
+    /**
+     * @brief Unique sibling name for staging the content of target
+     */
+    std::filesystem::path tempPathFor(const std::filesystem::path &target) {
+      auto tempPath = target;
+#if defined(NIXONCPP_HAS_POSIX_IO)
+      tempPath += fmt::format(".tmp.{}.{}", ::getpid(), tempCounter.fetch_add(1));
+#else
+      tempPath += fmt::format(".tmp.{}", tempCounter.fetch_add(1));
+#endif
+      return tempPath;
+    }
+
+#if defined(NIXONCPP_HAS_POSIX_IO)
+    std::filesystem::path directoryOf(const std::filesystem::path &target) {
+      return target.has_parent_path() ? target.parent_path() : std::filesystem::path(".");
+    }
+
+    bool writeAll(int fd, std::string_view content) {
+      while (!content.empty()) {
+        const auto written = ::write(fd, content.data(), content.size());
+        if (written < 0) {
+          if (errno == EINTR) {
+            continue;
+          }
+          return false;
+        }
+        content.remove_prefix(static_cast<std::size_t>(written));
+      }
+      return true;
+    }
+
+#if defined(O_TMPFILE)
+    // Publishing an unnamed file goes through its /proc/self/fd link
+    bool canLinkUnnamedFiles() {
+      static const bool available = ::access("/proc/self/fd", X_OK) == 0;
+      return available;
+    }
+#endif
+#endif
+  } // namespace
+
+#if defined(NIXONCPP_HAS_POSIX_IO)
+  struct GroupCommitter::Request {
+    std::filesystem::path target;
+    detail::UniqueFd fd;
+    std::filesystem::path tempPath; // Empty while the staged file is unnamed (O_TMPFILE)
+    std::optional<FileError> error;
+    bool done = false;
+
+    /**
+     * @brief Write the content to a new temporary file in the target's directory
+     */
+    std::optional<FileError> stage(std::string_view content) {
+      // Keep the permissions of the file being replaced
+      mode_t mode = 0644;
+      bool keepMode = false;
+      struct stat existing{};
+      if (::stat(target.c_str(), &existing) == 0) {
+        if (S_ISDIR(existing.st_mode)) {
+          return FileError{
+              .code = FileErrorCode::IsDirectory,
+              .message = "Path is a directory, not a file",
+              .path = target.string(),
+          };
+        }
+        mode = existing.st_mode & 07777;
+        keepMode = true;
+      }
+
+#if defined(O_TMPFILE)
+      if (canLinkUnnamedFiles()) {
+        // Not supported by every filesystem; fall back to a named temporary file
+        fd = detail::openFile(directoryOf(target), O_TMPFILE | O_WRONLY, mode);
+      }
+#endif
+      while (!fd) {
+        tempPath = tempPathFor(target);
+        fd = detail::openFile(tempPath, O_WRONLY | O_CREAT | O_EXCL, mode);
+        if (!fd && errno != EEXIST) {
+          const int err = errno;
+          tempPath.clear();
+          return detail::makeErrnoError(err, FileErrorCode::WriteError,
+                                        "Failed to create temporary file", target);
+        }
+      }
+
+      if ((keepMode && ::fchmod(fd.get(), mode) != 0) || !writeAll(fd.get(), content)) {
+        const int err = errno;
+        discard();
+        return detail::makeErrnoError(err, FileErrorCode::WriteError,
+                                      "I/O error while writing temporary file", target);
+      }
+      // Flushed by the caller's own thread, so concurrent callers flush in parallel
+      if (!flushData()) {
+        const int err = errno;
+        discard();
+        return detail::makeErrnoError(err, FileErrorCode::WriteError, "Failed to flush file",
+                                      target);
+      }
+      return std::nullopt;
+    }
+
+    bool flushData() const {
+#if defined(__APPLE__)
+      return ::fsync(fd.get()) == 0;
+#else
+      return ::fdatasync(fd.get()) == 0;
+#endif
+    }
+
+    /**
+     * @brief Move the staged file over the target
+     */
+    std::optional<FileError> publish() {
+      if (tempPath.empty()) {
+        // linkat() cannot replace an existing name: link under a temporary name, then rename
+        const auto linked = tempPathFor(target);
+        const auto procPath = fmt::format("/proc/self/fd/{}", fd.get());
+        if (::linkat(AT_FDCWD, procPath.c_str(), AT_FDCWD, linked.c_str(), AT_SYMLINK_FOLLOW) !=
+            0) {
+          const int err = errno;
+          discard();
+          return detail::makeErrnoError(err, FileErrorCode::WriteError,
+                                        "Failed to link temporary file", target);
+        }
+        tempPath = linked;
+      }
+      if (::rename(tempPath.c_str(), target.c_str()) != 0) {
+        const int err = errno;
+        discard();
+        return detail::makeErrnoError(err, FileErrorCode::WriteError, "Failed to replace file",
+                                      target);
+      }
+      tempPath.clear();
+      fd.reset();
+      return std::nullopt;
+    }
+
+    void discard() {
+      fd.reset();
+      if (!tempPath.empty()) {
+        ::unlink(tempPath.c_str());
+        tempPath.clear();
+      }
+    }
+  };
+
+  void GroupCommitter::commitBatch(std::deque<Request *> &batch) {
+    // The data is already durable (see stage()): publish, then persist every touched
+    // directory entry once
+    std::vector<std::filesystem::path> directories;
+    for (auto *request : batch) {
+      if (request->error) {
+        continue;
+      }
+      if (auto error = request->publish()) {
+        request->error = std::move(error);
+        continue;
+      }
+      auto directory = directoryOf(request->target);
+      if (std::find(directories.begin(), directories.end(), directory) == directories.end()) {
+        directories.push_back(std::move(directory));
+      }
+    }
+    for (const auto &directory : directories) {
+      auto fd = detail::openFile(directory, O_RDONLY | O_DIRECTORY);
+      if (fd && ::fsync(fd.get()) == 0) {
+        continue;
+      }
+      const int err = errno;
+      for (auto *request : batch) {
+        if (!request->error && directoryOf(request->target) == directory) {
+          request->error = detail::makeErrnoError(err, FileErrorCode::WriteError,
+                                                  "Failed to flush directory", directory);
+        }
+      }
+    }
+  }
+#else
+  struct GroupCommitter::Request {
+    std::filesystem::path target;
+    std::filesystem::path tempPath;
+    std::optional<FileError> error;
+    bool done = false;
+
+    std::optional<FileError> stage(std::string_view content) {
+      std::error_code ec;
+      if (std::filesystem::is_directory(target, ec)) {
+        return FileError{
+            .code = FileErrorCode::IsDirectory,
+            .message = "Path is a directory, not a file",
+            .path = target.string(),
+        };
+      }
+      tempPath = tempPathFor(target);
+      std::ofstream file(tempPath, std::ios::binary);
+      file.write(content.data(), static_cast<std::streamsize>(content.size()));
+      file.close();
+      if (!file) {
+        std::filesystem::remove(tempPath, ec);
+        return FileError{
+            .code = FileErrorCode::WriteError,
+            .message = "I/O error while writing temporary file",
+            .path = target.string(),
+        };
+      }
+      return std::nullopt;
+    }
+  };
+
+  void GroupCommitter::commitBatch(std::deque<Request *> &batch) {
+    for (auto *request : batch) {
+      std::error_code ec;
+      std::filesystem::rename(request->tempPath, request->target, ec);
+      if (ec) {
+        std::filesystem::remove(request->tempPath, ec);
+        request->error = FileError{
+            .code = FileErrorCode::WriteError,
+            .message = "Failed to replace file",
+            .path = request->target.string(),
+        };
+      }
+    }
+  }
+#endif
+
+  Result<void, FileError> GroupCommitter::replace(const std::filesystem::path &target,
+                                                  std::string_view content) {
+    Request request;
+    request.target = target;
+    if (auto error = request.stage(content)) {
+      return *error;
+    }
+
+    std::unique_lock lock(mutex_);
+    queue_.push_back(&request);
+    while (!request.done) {
+      if (leaderActive_) {
+        committed_.wait(lock);
+        continue;
+      }
+      // Lead: commit everything queued so far, including requests of waiting followers
+      leaderActive_ = true;
+      std::deque<Request *> batch;
+      batch.swap(queue_);
+      lock.unlock();
+      commitBatch(batch);
+      lock.lock();
+      for (auto *committed : batch) {
+        committed->done = true;
+      }
+      stats_.files += batch.size();
+      ++stats_.batches;
+      leaderActive_ = false;
+      committed_.notify_all();
+    }
+
+    if (request.error) {
+      return *request.error;
+    }
+    return {};
+  }
+
+  GroupCommitStats GroupCommitter::stats() const {
+    std::lock_guard lock(mutex_);
+    return stats_;
+  }
+
+} // namespace nixoncpp::utils
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <Utils/UtilsError.hpp>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <string_view>
+
+namespace nixoncpp::utils {
+
+  /**
+   * @brief Counters of a GroupCommitter
+   */
+  struct GroupCommitStats {
+    std::uint64_t files = 0;   // Files replaced
+    std::uint64_t batches = 0; // Commit rounds; files / batches is the average group size
+  };
+
+  /**
+   * @brief Atomic, durable file replacement with directory flushes shared between callers
+   *
+   * replace() stages the content in a temporary file next to the target (an unnamed O_TMPFILE
+   * where the filesystem supports it, so a crash leaves nothing behind), fdatasyncs it on the
+   * calling thread, so concurrent callers flush their files in parallel, and then joins the
+   * commit queue. The first caller in the queue becomes the leader and commits every request
+   * that arrived while the previous batch was being committed: rename over the targets, then
+   * one fsync per distinct parent directory. Readers observe either the old or the new
+   * content, never a torn file.
+   *
+   * Only the renames and the directory fsyncs are shared by a batch; the data of every file
+   * still costs one fdatasync. One syncfs per filesystem would cover a whole batch, but it
+   * also flushes unrelated dirty data and, before Linux 5.8, does not report writeback
+   * errors, so a failed write could be published as durable. Share one committer (see
+   * UtilsFactory::createFileWriter()) for callers to batch together.
+   *
+   * Thread-safe. On platforms without POSIX I/O the content is written to a temporary file
+   * and renamed, without flushing.
+   */
+  class GroupCommitter final {
+  public:
+    GroupCommitter() = default;
+    GroupCommitter(const GroupCommitter &) = delete;
+    GroupCommitter &operator=(const GroupCommitter &) = delete;
+    GroupCommitter(GroupCommitter &&) = delete;
+    GroupCommitter &operator=(GroupCommitter &&) = delete;
+    ~GroupCommitter() = default;
+
+    /**
+     * @brief Replace the content of a file; returns once the new content is durable
+     *
+     * The parent directory must exist.
+     *
+     * @param target
+     * @param content
+     * @return Result<void, FileError>
+     */
+    [[nodiscard]]
+    Result<void, FileError> replace(const std::filesystem::path &target, std::string_view content);
+
+    /**
+     * @brief Snapshot of the counters
+     *
+     * @return GroupCommitStats
+     */
+    [[nodiscard]]
+    GroupCommitStats stats() const;
+
+  private:
+    struct Request;
+
+    void commitBatch(std::deque<Request *> &batch);
+
+    mutable std::mutex mutex_;
+    std::condition_variable committed_;
+    std::deque<Request *> queue_;
+    bool leaderActive_ = false;
+    GroupCommitStats stats_;
+  };
+
+} // namespace nixoncpp::utils
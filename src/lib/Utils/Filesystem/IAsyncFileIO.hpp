@@ -0,0 +1,70 @@
+#pragma once
+
+#include <Utils/UtilsError.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <future>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace nixoncpp::utils {
+
+  /**
+   * @brief Future delivering the outcome of an asynchronous file operation
+   */
+  template <typename T>
+  using AsyncFileResult = std::future<Result<T, FileError>>;
+
+  /**
+   * @brief Interface for asynchronous whole-file reads and writes
+   *
+   * Every call returns immediately; the operation runs in the background and its Result is
+   * delivered through the returned future. Operations issued from several threads may be in
+   * flight at the same time. Destroying the object waits for all issued operations.
+   */
+  class IAsyncFileIO {
+  public:
+    virtual ~IAsyncFileIO() = default;
+
+    /**
+     * @brief Read entire file content as string
+     *
+     * @param filePath
+     * @return AsyncFileResult<std::string>
+     */
+    [[nodiscard]]
+    virtual AsyncFileResult<std::string> read(const std::filesystem::path &filePath) = 0;
+
+    /**
+     * @brief Read file as binary data
+     *
+     * @param filePath
+     * @return AsyncFileResult<std::vector<uint8_t>>
+     */
+    [[nodiscard]]
+    virtual AsyncFileResult<std::vector<uint8_t>>
+        readBytes(const std::filesystem::path &filePath) = 0;
+
+    /**
+     * @brief Write string content to file, creating missing parent directories
+     *
+     * @param filePath
+     * @param content Owned by the operation until it completes
+     * @param append
+     * @return AsyncFileResult<void>
+     */
+    [[nodiscard]]
+    virtual AsyncFileResult<void> write(const std::filesystem::path &filePath, std::string content,
+                                        bool append = false) = 0;
+
+    /**
+     * @brief Name of the backend executing the operations (e.g. "io_uring", "thread-pool")
+     *
+     * @return std::string_view
+     */
+    [[nodiscard]]
+    virtual std::string_view backendName() const noexcept = 0;
+  };
+
+} // namespace nixoncpp::utils
@@ -1,6 +1,12 @@
 #pragma once
 
+#include <Utils/Filesystem/DirectoryRange.hpp>
+#include <Utils/Filesystem/DirectoryRemoval.hpp>
+#include <Utils/Filesystem/DirectorySnapshot.hpp>
+#include <Utils/Filesystem/DirectoryWalk.hpp>
+#include <Utils/Filesystem/FileCopy.hpp>
 #include <Utils/UtilsError.hpp>
+#include <cstdint>
 #include <filesystem>
 #include <vector>
 
@@ -37,11 +43,32 @@ namespace nixoncpp::utils {
      * @brief Remove a Directory object recursively
      *
      * @param dirPath
-     * @return Result<std::uintmax_t, FileError>
+     * @param progress Called with the running count as directories are emptied; may be empty.
+     * An exception it throws stops the removal and is rethrown here
+     * @return Result<std::uintmax_t, FileError> Number of entries removed, dirPath included
      */
     [[nodiscard]]
     virtual Result<std::uintmax_t, FileError>
-        removeDirectoryRecursive(const std::filesystem::path &dirPath) const = 0;
+        removeDirectoryRecursive(const std::filesystem::path &dirPath,
+                                 const RemoveProgress &progress = RemoveProgress{}) const = 0;
+
+    /**
+     * @brief Copy a directory tree
+     *
+     * Directories are recreated with their permissions, symlinks are copied as symlinks and
+     * regular files are copied like IFileWriter::copyFile(). Other entry types are skipped.
+     * An existing destination directory is merged into. Files may be copied on the manager's
+     * thread pool, so copyTree() must not be called from a task running on that pool.
+     *
+     * @param source
+     * @param destination Must not be inside source
+     * @param options
+     * @return Result<std::uintmax_t, FileError> Number of entries created below destination
+     */
+    [[nodiscard]]
+    virtual Result<std::uintmax_t, FileError>
+        copyTree(const std::filesystem::path &source, const std::filesystem::path &destination,
+                 const CopyOptions &options = CopyOptions{}) const = 0;
 
     /**
      * @brief Check if a directory exists
@@ -76,12 +103,61 @@ namespace nixoncpp::utils {
      * @brief List entries in a directory recursively
      *
      * @param dirPath
-     * @return Result<std::vector<std::filesystem::path>, FileError>
+     * @return Result<std::vector<std::filesystem::path>, FileError> Sorted by path, so every
+     * directory precedes its contents
      */
     [[nodiscard]]
     virtual Result<std::vector<std::filesystem::path>, FileError>
         listEntriesRecursive(const std::filesystem::path &dirPath) const = 0;
 
+    /**
+     * @brief Walk a directory tree, reporting the type (and optionally metadata) of entries
+     *
+     * @param dirPath
+     * @param options Depth limit, symlink handling, stat data, filter and pruning
+     * @return Result<std::vector<DirectoryEntry>, FileError> In unspecified order
+     */
+    [[nodiscard]]
+    virtual Result<std::vector<DirectoryEntry>, FileError>
+        walk(const std::filesystem::path &dirPath,
+             const WalkOptions &options = WalkOptions{}) const = 0;
+
+    /**
+     * @brief Walk a directory tree lazily, reading directories only as entries are consumed
+     *
+     * @param dirPath
+     * @param options Depth limit, symlink handling, stat data, filter and pruning
+     * @return Result<DirectoryRange, FileError> Depth-first, parents before their contents
+     */
+    [[nodiscard]]
+    virtual Result<DirectoryRange, FileError>
+        iterate(const std::filesystem::path &dirPath,
+                const WalkOptions &options = WalkOptions{}) const = 0;
+
+    /**
+     * @brief Record the type, inode, size and mtime of every entry of a directory tree
+     *
+     * @param dirPath
+     * @return Result<DirectorySnapshot, FileError>
+     */
+    [[nodiscard]]
+    virtual Result<DirectorySnapshot, FileError>
+        snapshot(const std::filesystem::path &dirPath) const = 0;
+
+    /**
+     * @brief Snapshot a directory tree again, reading only what may have changed since
+     * previous; compare the two with DirectorySnapshot::diff()
+     *
+     * @param dirPath
+     * @param previous Earlier snapshot of dirPath
+     * @param options
+     * @return Result<DirectorySnapshot, FileError>
+     */
+    [[nodiscard]]
+    virtual Result<DirectorySnapshot, FileError>
+        rescan(const std::filesystem::path &dirPath, const DirectorySnapshot &previous,
+               const RescanOptions &options = RescanOptions{}) const = 0;
+
     /**
      * @brief Get the Current Directory object
      *
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <Utils/UtilsError.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace nixoncpp::utils {
+
+  /**
+   * @brief Checksum and hash functions supported by IFileHasher
+   */
+  enum class HashAlgorithm : std::uint8_t {
+    Crc32c,   // CRC-32C (Castagnoli), hardware accelerated on SSE4.2 and ARMv8
+    Xxh3_64,  // XXH3 64-bit; needs the build to link libxxhash
+    Xxh3_128, // XXH128; needs the build to link libxxhash
+  };
+
+  /**
+   * @brief Digest of a file
+   *
+   * CRC-32C and XXH3-64 use only the low word.
+   */
+  struct FileHash {
+    HashAlgorithm algorithm = HashAlgorithm::Crc32c;
+    std::uint64_t low = 0;
+    std::uint64_t high = 0;
+
+    /**
+     * @brief Canonical lowercase hex form (8, 16 or 32 digits, as printed by xxhsum)
+     *
+     * @return std::string
+     */
+    [[nodiscard]]
+    std::string toHex() const;
+
+    bool operator==(const FileHash &) const = default;
+  };
+
+  /**
+   * @brief Interface for hashing file contents
+   *
+   * Files are streamed in fixed-size chunks, so memory use does not depend on file size.
+   */
+  class IFileHasher {
+  public:
+    virtual ~IFileHasher() = default;
+
+    /**
+     * @brief Hash the content of a file
+     *
+     * @param filePath
+     * @param algorithm
+     * @return Result<FileHash, FileError>
+     */
+    [[nodiscard]]
+    virtual Result<FileHash, FileError> hashFile(const std::filesystem::path &filePath,
+                                                 HashAlgorithm algorithm) const = 0;
+
+    /**
+     * @brief Hash several files
+     *
+     * @param filePaths
+     * @param algorithm
+     * @return std::vector<Result<FileHash, FileError>> One result per path, in order
+     */
+    [[nodiscard]]
+    virtual std::vector<Result<FileHash, FileError>>
+        hashFiles(std::span<const std::filesystem::path> filePaths,
+                  HashAlgorithm algorithm) const = 0;
+  };
+
+} // namespace nixoncpp::utils
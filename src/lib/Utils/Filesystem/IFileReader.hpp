@@ -1,13 +1,27 @@
 #pragma once
 
+#include <Utils/Filesystem/AccessPattern.hpp>
+#include <Utils/Filesystem/LineReader.hpp>
+#include <Utils/Filesystem/MappedFile.hpp>
 #include <Utils/UtilsError.hpp>
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
+#include <span>
 #include <string>
 #include <vector>
 
 namespace nixoncpp::utils {
 
+  /**
+   * @brief Hints for a whole-file read
+   */
+  struct ReadOptions {
+    // Sequential, Random and WillNeed are applied before reading; DontNeed drops the file
+    // from the page cache afterwards so bulk jobs do not evict hotter data
+    AccessPattern pattern = AccessPattern::Normal;
+  };
+
   /**
    * @brief Interface for reading file content
    *
@@ -37,6 +51,28 @@ namespace nixoncpp::utils {
     virtual Result<std::vector<uint8_t>, FileError>
         readBytes(const std::filesystem::path &filePath) const = 0;
 
+    /**
+     * @brief Read the entire content of a file as a string, with page cache hints
+     *
+     * @param filePath
+     * @param options
+     * @return Result<std::string, FileError>
+     */
+    [[nodiscard]]
+    virtual Result<std::string, FileError> read(const std::filesystem::path &filePath,
+                                                const ReadOptions &options) const = 0;
+
+    /**
+     * @brief Read the entire content of a file as bytes, with page cache hints
+     *
+     * @param filePath
+     * @param options
+     * @return Result<std::vector<uint8_t>, FileError>
+     */
+    [[nodiscard]]
+    virtual Result<std::vector<uint8_t>, FileError>
+        readBytes(const std::filesystem::path &filePath, const ReadOptions &options) const = 0;
+
     /**
      * @brief Read the content of a file as a vector of lines
      *
@@ -47,6 +83,74 @@ namespace nixoncpp::utils {
     virtual Result<std::vector<std::string>, FileError>
         readLines(const std::filesystem::path &filePath) const = 0;
 
+    /**
+     * @brief Read part of a file into a caller-provided buffer
+     *
+     * Fills the destination from the given offset until it is full or the end of the file is
+     * reached. Nothing is allocated, so hot loops can reuse their buffers.
+     *
+     * @param filePath
+     * @param destination
+     * @param offset Byte offset in the file
+     * @return Result<std::size_t, FileError> Bytes read; fewer than requested only at EOF
+     */
+    [[nodiscard]]
+    virtual Result<std::size_t, FileError> readInto(const std::filesystem::path &filePath,
+                                                    std::span<std::byte> destination,
+                                                    std::uint64_t offset = 0) const = 0;
+
+    /**
+     * @brief Read length bytes starting at offset
+     *
+     * @param filePath
+     * @param offset Byte offset in the file
+     * @param length
+     * @return Result<std::vector<uint8_t>, FileError> Shorter than length only at EOF
+     */
+    [[nodiscard]]
+    virtual Result<std::vector<uint8_t>, FileError>
+        readRange(const std::filesystem::path &filePath, std::uint64_t offset,
+                  std::size_t length) const = 0;
+
+    /**
+     * @brief Read many whole files in one call
+     *
+     * Files are read in inode order for locality and, when the implementation has an
+     * asynchronous backend, concurrently. A failure affects only the result of its own path.
+     *
+     * @param filePaths
+     * @return std::vector<Result<std::string, FileError>> One result per path, in input order
+     */
+    [[nodiscard]]
+    virtual std::vector<Result<std::string, FileError>>
+        readMany(std::span<const std::filesystem::path> filePaths) const = 0;
+
+    /**
+     * @brief Iterate over the lines of a file lazily, without one allocation per line
+     *
+     * Unlike readLines(), a trailing '\r' is removed from each line.
+     *
+     * @param filePath
+     * @param chunkSize Bytes read from the file at a time
+     * @return Result<LineReader, FileError>
+     */
+    [[nodiscard]]
+    virtual Result<LineReader, FileError>
+        lines(const std::filesystem::path &filePath,
+              std::size_t chunkSize = LineReader::kDefaultChunkSize) const = 0;
+
+    /**
+     * @brief Map the entire content of a file into memory without copying it
+     *
+     * @param filePath
+     * @param pattern Access hint for the mapping
+     * @return Result<MappedFile, FileError>
+     */
+    [[nodiscard]]
+    virtual Result<MappedFile, FileError>
+        map(const std::filesystem::path &filePath,
+            AccessPattern pattern = AccessPattern::Sequential) const = 0;
+
     /**
      * @brief Check if a file exists
      *
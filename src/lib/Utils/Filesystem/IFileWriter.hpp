@@ -1,13 +1,31 @@
 #pragma once
 
+#include <Utils/Filesystem/AccessPattern.hpp>
+#include <Utils/Filesystem/FileAppender.hpp>
+#include <Utils/Filesystem/FileCopy.hpp>
 #include <Utils/UtilsError.hpp>
 #include <cstdint>
 #include <filesystem>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace nixoncpp::utils {
 
+  /**
+   * @brief Placement and page cache hints for a write
+   */
+  struct WriteOptions {
+    bool append = false;
+    // Final file size to reserve up front (fallocate) so the filesystem can lay the file out
+    // contiguously; 0 reserves the size of the write itself when it is large
+    std::uintmax_t expectedSize = 0;
+    // DontNeed writes the data back and drops it from the page cache; other patterns only
+    // matter for reads
+    AccessPattern pattern = AccessPattern::Normal;
+  };
+
   /**
    * @brief Interface for writing file content
    *
@@ -44,6 +62,32 @@ namespace nixoncpp::utils {
                                                const std::vector<uint8_t> &data,
                                                bool append = false) const = 0;
 
+    /**
+     * @brief Write string content to file with preallocation and page cache hints
+     *
+     * @param filePath
+     * @param content
+     * @param options
+     * @return Result<void, FileError>
+     */
+    [[nodiscard]]
+    virtual Result<void, FileError> write(const std::filesystem::path &filePath,
+                                          std::string_view content,
+                                          const WriteOptions &options) const = 0;
+
+    /**
+     * @brief Write binary data to file with preallocation and page cache hints
+     *
+     * @param filePath
+     * @param data
+     * @param options
+     * @return Result<void, FileError>
+     */
+    [[nodiscard]]
+    virtual Result<void, FileError> writeBytes(const std::filesystem::path &filePath,
+                                               std::span<const uint8_t> data,
+                                               const WriteOptions &options) const = 0;
+
     /**
      * @brief Write lines to file (each string becomes one line)
      *
@@ -57,6 +101,66 @@ namespace nixoncpp::utils {
                                                const std::vector<std::string> &lines,
                                                bool append = false) const = 0;
 
+    /**
+     * @brief Write lines to file without requiring owned strings
+     *
+     * @param filePath
+     * @param lines
+     * @param append
+     * @return Result<void, FileError>
+     */
+    [[nodiscard]]
+    virtual Result<void, FileError> writeLines(const std::filesystem::path &filePath,
+                                               std::span<const std::string_view> lines,
+                                               bool append = false) const = 0;
+
+    /**
+     * @brief Open a persistent, buffered handle for repeated appends
+     *
+     * Validates the path and creates missing parent directories once; later appends go
+     * straight to the open file.
+     *
+     * @param filePath
+     * @param options
+     * @return Result<FileAppender, FileError>
+     */
+    [[nodiscard]]
+    virtual Result<FileAppender, FileError>
+        openAppender(const std::filesystem::path &filePath,
+                     const AppenderOptions &options = AppenderOptions{}) const = 0;
+
+    /**
+     * @brief Atomically replace a file; returns once the new content is durable
+     *
+     * Readers see either the old or the new content. Concurrent calls through the same
+     * GroupCommitter share their renames and directory flushes (group commit); the data of
+     * each file is flushed with its own fdatasync. Creates missing parent directories and
+     * keeps the mode of a replaced file.
+     *
+     * @param filePath
+     * @param content
+     * @return Result<void, FileError>
+     */
+    [[nodiscard]]
+    virtual Result<void, FileError> writeAtomic(const std::filesystem::path &filePath,
+                                                std::string_view content) const = 0;
+
+    /**
+     * @brief Copy a regular file inside the kernel where possible
+     *
+     * Uses a reflink, copy_file_range or sendfile depending on what the filesystem supports,
+     * and keeps holes of sparse files. Creates missing parent directories of the destination.
+     *
+     * @param source
+     * @param destination
+     * @param options
+     * @return Result<std::uintmax_t, FileError> Bytes copied
+     */
+    [[nodiscard]]
+    virtual Result<std::uintmax_t, FileError>
+        copyFile(const std::filesystem::path &source, const std::filesystem::path &destination,
+                 const CopyOptions &options = CopyOptions{}) const = 0;
+
     /**
      * @brief Create empty file or update timestamp of existing file
      *
@@ -0,0 +1,697 @@
+#include "IoUringFileIO.hpp"
+#include <Utils/Filesystem/PosixIo.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <variant>
+
+#if defined(NIXONCPP_HAS_IO_URING)
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#endif
+
+namespace nixoncpp::utils {
+
+#if defined(NIXONCPP_HAS_IO_URING)
+  namespace {
+    constexpr std::size_t kMinReadChunk = 4096;
+    constexpr std::size_t kMaxTransfer = std::size_t{1} << 30; // Largest length of one SQE
+    constexpr std::uint64_t kWakeTag = 0;                        // user_data of the eventfd read
+    constexpr unsigned kProbeOps = 256;
+
+    // Raw system calls; the kernel UAPI header is all that is needed, no liburing
+    int ioUringSetup(unsigned entries, io_uring_params *params) {
+      return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+    }
+
+    int ioUringEnter(int ringFd, unsigned toSubmit, unsigned minComplete, unsigned flags) {
+      return static_cast<int>(
+          ::syscall(__NR_io_uring_enter, ringFd, toSubmit, minComplete, flags, nullptr, 0));
+    }
+
+    int ioUringRegister(int ringFd, unsigned opcode, void *arg, unsigned count) {
+      return static_cast<int>(::syscall(__NR_io_uring_register, ringFd, opcode, arg, count));
+    }
+
+    FileError ringError(int err, std::string_view what) {
+      return detail::makeErrnoError(err, FileErrorCode::Unknown, what, std::filesystem::path{});
+    }
+
+    /**
+     * @brief One queued read or write together with its promise
+     */
+    struct Operation {
+      enum class Kind : std::uint8_t { Read, ReadBytes, Write };
+      using Promise = std::variant<std::promise<Result<std::string, FileError>>,
+                                   std::promise<Result<std::vector<uint8_t>, FileError>>,
+                                   std::promise<Result<void, FileError>>>;
+
+      Kind kind = Kind::Read;
+      std::filesystem::path path;
+      bool append = false;
+      detail::UniqueFd fd;
+      std::uint64_t expectedSize = 0; // st_size of a regular file; 0 = read until EOF
+      std::size_t done = 0;           // Bytes transferred so far
+      int fixedSlot = -1;             // Registered buffer used by the next read
+      std::string text;               // Read destination or write source
+      std::vector<uint8_t> bytes;     // ReadBytes destination
+      Promise promise;
+
+      [[nodiscard]]
+      char *data() {
+        return kind == Kind::ReadBytes ? reinterpret_cast<char *>(bytes.data()) : text.data();
+      }
+
+      [[nodiscard]]
+      std::size_t size() const {
+        return kind == Kind::ReadBytes ? bytes.size() : text.size();
+      }
+
+      void resize(std::size_t size) {
+        if (kind == Kind::ReadBytes) {
+          bytes.resize(size);
+        } else {
+          text.resize(size);
+        }
+      }
+
+      void fail(FileError error) {
+        fd.reset();
+        std::visit([&error](auto &promise) { promise.set_value(std::move(error)); }, promise);
+      }
+
+      // Fail with an error that is not specific to this operation
+      void failWith(const FileError &error) {
+        auto own = error;
+        own.path = path.string();
+        fail(std::move(own));
+      }
+
+      void complete() {
+        fd.reset();
+        switch (kind) {
+        case Kind::Read:
+          text.resize(done);
+          std::get<0>(promise).set_value(std::move(text));
+          break;
+        case Kind::ReadBytes:
+          bytes.resize(done);
+          std::get<1>(promise).set_value(std::move(bytes));
+          break;
+        case Kind::Write: std::get<2>(promise).set_value(Result<void, FileError>{}); break;
+        }
+      }
+    };
+
+    unsigned loadAcquire(unsigned *value) {
+      return std::atomic_ref<unsigned>(*value).load(std::memory_order_acquire);
+    }
+
+    void storeRelease(unsigned *value, unsigned newValue) {
+      std::atomic_ref<unsigned>(*value).store(newValue, std::memory_order_release);
+    }
+  } // namespace
+
+  /**
+   * @brief Ring mappings, registered buffers and the completion thread
+   *
+   * Only the completion thread touches the rings and the operations in flight. Other threads
+   * hand over operations through the incoming queue and wake it with an eventfd that always
+   * has a read pending in the ring.
+   */
+  struct IoUringFileIO::Ring {
+    Ring() = default;
+    Ring(const Ring &) = delete;
+    Ring &operator=(const Ring &) = delete;
+    Ring(Ring &&) = delete;
+    Ring &operator=(Ring &&) = delete;
+
+    ~Ring() {
+      if (completionThread.joinable()) {
+        stop();
+      }
+      if (sqeMapping != MAP_FAILED) {
+        ::munmap(sqeMapping, sqeMappingSize);
+      }
+      if (cqMapping != MAP_FAILED && cqMapping != sqMapping) {
+        ::munmap(cqMapping, cqMappingSize);
+      }
+      if (sqMapping != MAP_FAILED) {
+        ::munmap(sqMapping, sqMappingSize);
+      }
+      ringFd.reset();
+    }
+
+    Result<void, FileError> setup(const IoUringConfig &config) {
+      io_uring_params params{};
+      ringFd.reset(ioUringSetup(std::max(config.queueDepth, 1U), &params));
+      if (!ringFd) {
+        return ringError(errno, "io_uring_setup failed");
+      }
+      sqEntries = params.sq_entries;
+
+      sqMappingSize = params.sq_off.array + (params.sq_entries * sizeof(unsigned));
+      cqMappingSize = params.cq_off.cqes + (params.cq_entries * sizeof(io_uring_cqe));
+      const bool singleMapping = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+      if (singleMapping) {
+        sqMappingSize = cqMappingSize = std::max(sqMappingSize, cqMappingSize);
+      }
+      sqMapping = ::mmap(nullptr, sqMappingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                         ringFd.get(), IORING_OFF_SQ_RING);
+      if (sqMapping == MAP_FAILED) {
+        return ringError(errno, "Failed to map io_uring submission ring");
+      }
+      cqMapping = singleMapping ? sqMapping
+                                : ::mmap(nullptr, cqMappingSize, PROT_READ | PROT_WRITE,
+                                         MAP_SHARED | MAP_POPULATE, ringFd.get(),
+                                         IORING_OFF_CQ_RING);
+      if (cqMapping == MAP_FAILED) {
+        return ringError(errno, "Failed to map io_uring completion ring");
+      }
+      sqeMappingSize = params.sq_entries * sizeof(io_uring_sqe);
+      sqeMapping = ::mmap(nullptr, sqeMappingSize, PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_POPULATE, ringFd.get(), IORING_OFF_SQES);
+      if (sqeMapping == MAP_FAILED) {
+        return ringError(errno, "Failed to map io_uring submission entries");
+      }
+
+      auto *sq = static_cast<char *>(sqMapping);
+      sqTail = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+      sqMask = *reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+      sqArray = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+      sqes = static_cast<io_uring_sqe *>(sqeMapping);
+      auto *cq = static_cast<char *>(cqMapping);
+      cqHead = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+      cqTail = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+      cqMask = *reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+      cqes = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+      sqLocalTail = loadAcquire(sqTail);
+
+      // Kernels before 5.6 lack the probe and IORING_OP_READ/WRITE
+      std::vector<std::byte> probeBuffer(sizeof(io_uring_probe) +
+                                         (kProbeOps * sizeof(io_uring_probe_op)));
+      auto *probe = reinterpret_cast<io_uring_probe *>(probeBuffer.data());
+      if (ioUringRegister(ringFd.get(), IORING_REGISTER_PROBE, probe, kProbeOps) < 0) {
+        return ringError(errno, "io_uring opcode probe failed");
+      }
+      for (const unsigned opcode : {IORING_OP_READ, IORING_OP_WRITE, IORING_OP_READ_FIXED}) {
+        if (opcode > probe->last_op || (probe->ops[opcode].flags & IO_URING_OP_SUPPORTED) == 0) {
+          return ringError(ENOSYS, "io_uring lacks read/write support");
+        }
+      }
+
+      wakeFd.reset(::eventfd(0, EFD_CLOEXEC));
+      if (!wakeFd) {
+        return ringError(errno, "Failed to create io_uring wake-up eventfd");
+      }
+
+      if (config.fixedBufferCount > 0 && config.fixedBufferSize > 0) {
+        fixedBufferSize = config.fixedBufferSize;
+        fixedStorage = std::make_unique<char[]>(config.fixedBufferCount * fixedBufferSize);
+        std::vector<iovec> buffers(config.fixedBufferCount);
+        for (std::uint32_t slot = 0; slot < config.fixedBufferCount; ++slot) {
+          buffers[slot] = iovec{.iov_base = fixedStorage.get() + (slot * fixedBufferSize),
+                                .iov_len = fixedBufferSize};
+        }
+        if (ioUringRegister(ringFd.get(), IORING_REGISTER_BUFFERS, buffers.data(),
+                            config.fixedBufferCount) == 0) {
+          for (std::uint32_t slot = config.fixedBufferCount; slot > 0; --slot) {
+            freeSlots.push_back(static_cast<int>(slot - 1));
+          }
+        } else {
+          fixedStorage.reset();
+        }
+      }
+
+      completionThread = std::thread([this] { run(); });
+      return {};
+    }
+
+    void enqueue(std::unique_ptr<Operation> operation) {
+      bool wasEmpty = false;
+      {
+        std::lock_guard lock(mutex);
+        if (failure) {
+          operation->failWith(*failure);
+          return;
+        }
+        wasEmpty = incoming.empty();
+        incoming.push_back(std::move(operation));
+      }
+      // The completion thread takes the whole queue at once, so one wake-up per batch suffices
+      if (wasEmpty) {
+        wake();
+      }
+    }
+
+    void stop() {
+      {
+        std::lock_guard lock(mutex);
+        stopping = true;
+      }
+      wake();
+      completionThread.join();
+    }
+
+    void wake() const {
+      const std::uint64_t one = 1;
+      while (::write(wakeFd.get(), &one, sizeof(one)) < 0 && errno == EINTR) {
+      }
+    }
+
+    void run() {
+      for (;;) {
+        bool stopRequested = false;
+        {
+          std::lock_guard lock(mutex);
+          for (auto &operation : incoming) {
+            pending.push_back(std::move(operation));
+          }
+          incoming.clear();
+          stopRequested = stopping;
+        }
+
+        while (!pending.empty() && inFlight < sqEntries) {
+          auto operation = std::move(pending.front());
+          pending.pop_front();
+          if (!operation->fd && !openOperation(*operation)) {
+            continue;
+          }
+          queueTransfer(operation.release());
+        }
+
+        const std::size_t idle = wakeArmed ? 1 : 0;
+        if (stopRequested && pending.empty() && inFlight == idle) {
+          return;
+        }
+        if (!wakeArmed && inFlight < sqEntries) {
+          armWake();
+        }
+
+        const int submittedNow = ioUringEnter(ringFd.get(), toSubmit, 1, IORING_ENTER_GETEVENTS);
+        if (submittedNow > 0) {
+          toSubmit -= static_cast<unsigned>(submittedNow);
+          submitCalls.fetch_add(1, std::memory_order_relaxed);
+        } else if (submittedNow < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+          abandon(ringError(errno, "io_uring_enter failed"));
+          return;
+        }
+        // EINTR, EAGAIN and EBUSY only mean "reap and try again"
+        reap();
+      }
+    }
+
+    /**
+     * @brief Fail every operation after the ring stopped working; the completion thread exits
+     *
+     * Operations still owned by the kernel are failed but stay allocated, since the kernel may
+     * write into their buffers until the ring is closed.
+     */
+    void abandon(const FileError &error) {
+      std::deque<std::unique_ptr<Operation>> queued;
+      {
+        std::lock_guard lock(mutex);
+        failure = error;
+        queued.swap(incoming);
+      }
+      reap();
+      for (auto *operations : {&pending, &queued}) {
+        for (auto &operation : *operations) {
+          operation->failWith(error);
+        }
+        operations->clear();
+      }
+      for (auto *operation : submittedOperations) {
+        operation->failWith(error);
+      }
+      submittedOperations.clear();
+    }
+
+    /**
+     * @brief Open the file of an operation and size its buffer
+     *
+     * @return false when the operation has already been completed or failed
+     */
+    bool openOperation(Operation &operation) {
+      if (operation.path.empty()) {
+        operation.fail(FileError{
+            .code = FileErrorCode::InvalidPath,
+            .message = "Empty file path",
+            .path = "",
+        });
+        return false;
+      }
+
+      if (operation.kind == Operation::Kind::Write) {
+        const auto parent = operation.path.parent_path();
+        std::error_code ec;
+        if (!parent.empty() && !std::filesystem::exists(parent, ec)) {
+          std::filesystem::create_directories(parent, ec);
+          if (ec) {
+            operation.fail(FileError{
+                .code = FileErrorCode::WriteError,
+                .message = fmt::format("Failed to create parent directory: {}", ec.message()),
+                .path = parent.string(),
+            });
+            return false;
+          }
+        }
+        const int flags = O_WRONLY | O_CREAT | (operation.append ? O_APPEND : O_TRUNC);
+        operation.fd = detail::openFile(operation.path, flags);
+        if (!operation.fd) {
+          operation.fail(detail::makeErrnoError(errno, FileErrorCode::WriteError,
+                                                "Failed to open file for writing", operation.path));
+          return false;
+        }
+        if (operation.text.empty()) {
+          operation.complete();
+          return false;
+        }
+        return true;
+      }
+
+      operation.fd = detail::openFile(operation.path, O_RDONLY);
+      if (!operation.fd) {
+        operation.fail(detail::makeErrnoError(errno, FileErrorCode::ReadError,
+                                              "Failed to open file for reading", operation.path));
+        return false;
+      }
+      struct stat info{};
+      if (::fstat(operation.fd.get(), &info) != 0) {
+        operation.fail(detail::makeErrnoError(errno, FileErrorCode::ReadError,
+                                              "Failed to stat file", operation.path));
+        return false;
+      }
+      if (S_ISDIR(info.st_mode)) {
+        operation.fail(FileError{
+            .code = FileErrorCode::IsDirectory,
+            .message = "Path is a directory, not a file",
+            .path = operation.path.string(),
+        });
+        return false;
+      }
+
+      operation.expectedSize = S_ISREG(info.st_mode) ? static_cast<std::uint64_t>(info.st_size) : 0;
+      if (operation.expectedSize > 0 && operation.expectedSize <= fixedBufferSize &&
+          !freeSlots.empty()) {
+        operation.fixedSlot = freeSlots.back();
+        freeSlots.pop_back();
+      } else {
+        operation.resize(operation.expectedSize > 0
+                             ? static_cast<std::size_t>(operation.expectedSize)
+                             : kMinReadChunk);
+      }
+      return true;
+    }
+
+    void pushSqe(const io_uring_sqe &entry) {
+      const unsigned index = sqLocalTail & sqMask;
+      sqes[index] = entry;
+      sqArray[index] = index;
+      storeRelease(sqTail, ++sqLocalTail);
+      ++toSubmit;
+      ++inFlight;
+    }
+
+    void armWake() {
+      io_uring_sqe entry{};
+      entry.opcode = IORING_OP_READ;
+      entry.fd = wakeFd.get();
+      entry.addr = reinterpret_cast<std::uintptr_t>(&wakeValue);
+      entry.len = sizeof(wakeValue);
+      entry.user_data = kWakeTag;
+      pushSqe(entry);
+      wakeArmed = true;
+    }
+
+    void queueTransfer(Operation *operation) {
+      io_uring_sqe entry{};
+      entry.fd = operation->fd.get();
+      entry.user_data = reinterpret_cast<std::uintptr_t>(operation);
+      submittedOperations.insert(operation);
+
+      if (operation->kind == Operation::Kind::Write) {
+        entry.opcode = IORING_OP_WRITE;
+        entry.addr = reinterpret_cast<std::uintptr_t>(operation->text.data() + operation->done);
+        entry.len = static_cast<std::uint32_t>(
+            std::min(operation->text.size() - operation->done, kMaxTransfer));
+        entry.off = operation->done; // Ignored for O_APPEND
+      } else if (operation->fixedSlot >= 0) {
+        entry.opcode = IORING_OP_READ_FIXED;
+        entry.addr = reinterpret_cast<std::uintptr_t>(fixedSlotData(operation->fixedSlot));
+        entry.len = static_cast<std::uint32_t>(fixedBufferSize);
+        entry.buf_index = static_cast<std::uint16_t>(operation->fixedSlot);
+        fixedReads.fetch_add(1, std::memory_order_relaxed);
+      } else {
+        if (operation->done == operation->size()) {
+          operation->resize(std::max(operation->size() * 2, kMinReadChunk));
+        }
+        entry.opcode = IORING_OP_READ;
+        entry.addr = reinterpret_cast<std::uintptr_t>(operation->data() + operation->done);
+        entry.len = static_cast<std::uint32_t>(
+            std::min(operation->size() - operation->done, kMaxTransfer));
+        entry.off = operation->done;
+      }
+      pushSqe(entry);
+      submitted.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]]
+    char *fixedSlotData(int slot) const {
+      return fixedStorage.get() + (static_cast<std::size_t>(slot) * fixedBufferSize);
+    }
+
+    void releaseSlot(Operation &operation) {
+      if (operation.fixedSlot >= 0) {
+        freeSlots.push_back(operation.fixedSlot);
+        operation.fixedSlot = -1;
+      }
+    }
+
+    void reap() {
+      unsigned head = *cqHead;
+      const unsigned tail = loadAcquire(cqTail);
+      while (head != tail) {
+        const auto &completion = cqes[head & cqMask];
+        const auto userData = completion.user_data;
+        const auto res = completion.res;
+        ++head;
+        --inFlight;
+        if (userData == kWakeTag) {
+          wakeArmed = false;
+        } else {
+          auto *operation = reinterpret_cast<Operation *>(userData);
+          submittedOperations.erase(operation);
+          complete(std::unique_ptr<Operation>(operation), res);
+        }
+      }
+      storeRelease(cqHead, head);
+    }
+
+    void complete(std::unique_ptr<Operation> operation, int res) {
+      const bool isWrite = operation->kind == Operation::Kind::Write;
+      if (res == -EINTR || res == -EAGAIN) {
+        pending.push_front(std::move(operation));
+        return;
+      }
+      if (res < 0) {
+        releaseSlot(*operation);
+        operation->fail(detail::makeErrnoError(
+            -res, isWrite ? FileErrorCode::WriteError : FileErrorCode::ReadError,
+            isWrite ? "I/O error while writing file" : "I/O error while reading file",
+            operation->path));
+        return;
+      }
+
+      const auto transferred = static_cast<std::size_t>(res);
+      if (isWrite) {
+        if (transferred == 0) {
+          operation->fail(FileError{
+              .code = FileErrorCode::WriteError,
+              .message = "I/O error while writing file: no progress",
+              .path = operation->path.string(),
+          });
+          return;
+        }
+        operation->done += transferred;
+        if (operation->done == operation->text.size()) {
+          operation->complete();
+        } else {
+          pending.push_front(std::move(operation));
+        }
+        return;
+      }
+
+      if (operation->fixedSlot >= 0) {
+        operation->resize(transferred);
+        std::memcpy(operation->data(), fixedSlotData(operation->fixedSlot), transferred);
+        releaseSlot(*operation);
+      }
+      operation->done += transferred;
+      const bool atEnd = transferred == 0 || (operation->expectedSize > 0 &&
+                                              operation->done >= operation->expectedSize);
+      if (atEnd) {
+        operation->complete();
+      } else {
+        pending.push_front(std::move(operation));
+      }
+    }
+
+    detail::UniqueFd ringFd;
+    void *sqMapping = MAP_FAILED;
+    std::size_t sqMappingSize = 0;
+    void *cqMapping = MAP_FAILED;
+    std::size_t cqMappingSize = 0;
+    void *sqeMapping = MAP_FAILED;
+    std::size_t sqeMappingSize = 0;
+    unsigned *sqTail = nullptr;
+    unsigned *sqArray = nullptr;
+    unsigned sqMask = 0;
+    io_uring_sqe *sqes = nullptr;
+    unsigned *cqHead = nullptr;
+    unsigned *cqTail = nullptr;
+    unsigned cqMask = 0;
+    io_uring_cqe *cqes = nullptr;
+    unsigned sqEntries = 0;
+    unsigned sqLocalTail = 0;
+    unsigned toSubmit = 0;
+    std::size_t inFlight = 0;
+
+    detail::UniqueFd wakeFd;
+    std::uint64_t wakeValue = 0;
+    bool wakeArmed = false;
+
+    std::unique_ptr<char[]> fixedStorage;
+    std::size_t fixedBufferSize = 0;
+    std::vector<int> freeSlots;
+
+    std::mutex mutex;
+    std::deque<std::unique_ptr<Operation>> incoming;
+    bool stopping = false;
+    std::optional<FileError> failure; // Set once the ring is unusable
+    std::deque<std::unique_ptr<Operation>> pending; // Completion thread only
+    std::unordered_set<Operation *> submittedOperations; // Completion thread only; in the kernel
+
+    std::atomic<std::uint64_t> submitCalls{0};
+    std::atomic<std::uint64_t> submitted{0};
+    std::atomic<std::uint64_t> fixedReads{0};
+    std::thread completionThread;
+  };
+
+  IoUringFileIO::IoUringFileIO(std::unique_ptr<Ring> ring) : ring_(std::move(ring)) {}
+
+  // Destroying the ring waits for every queued operation
+  IoUringFileIO::~IoUringFileIO() = default;
+
+  Result<std::shared_ptr<IoUringFileIO>, FileError>
+      IoUringFileIO::open(const IoUringConfig &config) {
+    auto ring = std::make_unique<Ring>();
+    if (auto started = ring->setup(config); !started) {
+      return started.error();
+    }
+    return std::shared_ptr<IoUringFileIO>(new IoUringFileIO(std::move(ring)));
+  }
+
+  AsyncFileResult<std::string> IoUringFileIO::read(const std::filesystem::path &filePath) {
+    auto operation = std::make_unique<Operation>();
+    operation->kind = Operation::Kind::Read;
+    operation->path = filePath;
+    std::promise<Result<std::string, FileError>> promise;
+    auto future = promise.get_future();
+    operation->promise = std::move(promise);
+    ring_->enqueue(std::move(operation));
+    return future;
+  }
+
+  AsyncFileResult<std::vector<uint8_t>>
+      IoUringFileIO::readBytes(const std::filesystem::path &filePath) {
+    auto operation = std::make_unique<Operation>();
+    operation->kind = Operation::Kind::ReadBytes;
+    operation->path = filePath;
+    std::promise<Result<std::vector<uint8_t>, FileError>> promise;
+    auto future = promise.get_future();
+    operation->promise = std::move(promise);
+    ring_->enqueue(std::move(operation));
+    return future;
+  }
+
+  AsyncFileResult<void> IoUringFileIO::write(const std::filesystem::path &filePath,
+                                             std::string content, bool append) {
+    auto operation = std::make_unique<Operation>();
+    operation->kind = Operation::Kind::Write;
+    operation->path = filePath;
+    operation->append = append;
+    operation->text = std::move(content);
+    std::promise<Result<void, FileError>> promise;
+    auto future = promise.get_future();
+    operation->promise = std::move(promise);
+    ring_->enqueue(std::move(operation));
+    return future;
+  }
+
+  IoUringStats IoUringFileIO::stats() const noexcept {
+    return IoUringStats{
+        .submitCalls = ring_->submitCalls.load(std::memory_order_relaxed),
+        .submitted = ring_->submitted.load(std::memory_order_relaxed),
+        .fixedReads = ring_->fixedReads.load(std::memory_order_relaxed),
+    };
+  }
+
+#else
+  // Built without io_uring: open() always fails, so no instance and no Ring ever exists
+
+  struct IoUringFileIO::Ring {};
+
+  namespace {
+    FileError unavailableError() {
+      return FileError{
+          .code = FileErrorCode::Unknown,
+          .message = "io_uring support is not compiled in",
+          .path = "",
+      };
+    }
+
+    template <typename T>
+    AsyncFileResult<T> unavailable() {
+      std::promise<Result<T, FileError>> promise;
+      promise.set_value(unavailableError());
+      return promise.get_future();
+    }
+  } // namespace
+
+  IoUringFileIO::IoUringFileIO(std::unique_ptr<Ring> ring) : ring_(std::move(ring)) {}
+
+  IoUringFileIO::~IoUringFileIO() = default;
+
+  Result<std::shared_ptr<IoUringFileIO>, FileError>
+      IoUringFileIO::open(const IoUringConfig & /*config*/) {
+    return unavailableError();
+  }
+
+  AsyncFileResult<std::string> IoUringFileIO::read(const std::filesystem::path & /*filePath*/) {
+    return unavailable<std::string>();
+  }
+
+  AsyncFileResult<std::vector<uint8_t>>
+      IoUringFileIO::readBytes(const std::filesystem::path & /*filePath*/) {
+    return unavailable<std::vector<uint8_t>>();
+  }
+
+  AsyncFileResult<void> IoUringFileIO::write(const std::filesystem::path & /*filePath*/,
+                                             std::string /*content*/, bool /*append*/) {
+    return unavailable<void>();
+  }
+
+  IoUringStats IoUringFileIO::stats() const noexcept { return IoUringStats{}; }
+#endif
+
+} // namespace nixoncpp::utils
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <Utils/Filesystem/IAsyncFileIO.hpp>
+#include <Utils/UtilsError.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace nixoncpp::utils {
+
+  /**
+   * @brief Configuration of the io_uring backend
+   */
+  struct IoUringConfig {
+    std::uint32_t queueDepth = 64;          // Submission queue entries; bounds operations in flight
+    std::uint32_t fixedBufferCount = 16;    // Registered buffers for small reads (0 = none)
+    std::size_t fixedBufferSize = 64 * 1024; // Bytes per registered buffer
+  };
+
+  /**
+   * @brief Counters describing the work done by an IoUringFileIO
+   */
+  struct IoUringStats {
+    std::uint64_t submitCalls = 0; // io_uring_enter calls that submitted at least one operation
+    std::uint64_t submitted = 0;   // Read/write operations submitted to the kernel
+    std::uint64_t fixedReads = 0;  // Reads served through a registered buffer
+  };
+
+  /**
+   * @brief IAsyncFileIO on top of Linux io_uring
+   *
+   * One background thread owns the ring. Operations queued by any thread are opened and
+   * submitted together, so requests for many files share one io_uring_enter call. Files that
+   * fit into a registered buffer are read with IORING_OP_READ_FIXED and copied out; larger
+   * files are read straight into the result buffer. Should the ring stop working, every
+   * outstanding and later operation fails with the io_uring_enter error.
+   *
+   * Only available when built with NIXONCPP_HAS_IO_URING (detected by meson on Linux) and
+   * when the running kernel permits io_uring; open() fails otherwise and callers should fall
+   * back to ThreadPoolFileIO (UtilsFactory::createAsyncFileIO does this).
+   */
+  class IoUringFileIO final : public IAsyncFileIO {
+  public:
+    IoUringFileIO(const IoUringFileIO &) = delete;
+    IoUringFileIO &operator=(const IoUringFileIO &) = delete;
+    IoUringFileIO(IoUringFileIO &&) = delete;
+    IoUringFileIO &operator=(IoUringFileIO &&) = delete;
+    ~IoUringFileIO() override;
+
+    /**
+     * @brief Set up the ring, register the fixed buffers and start the completion thread
+     *
+     * Failing to register the buffers (e.g. RLIMIT_MEMLOCK) is not an error; reads then use
+     * plain IORING_OP_READ.
+     *
+     * @param config
+     * @return Result<std::shared_ptr<IoUringFileIO>, FileError>
+     */
+    [[nodiscard]]
+    static Result<std::shared_ptr<IoUringFileIO>, FileError>
+        open(const IoUringConfig &config = IoUringConfig{});
+
+    [[nodiscard]]
+    AsyncFileResult<std::string> read(const std::filesystem::path &filePath) override;
+
+    [[nodiscard]]
+    AsyncFileResult<std::vector<uint8_t>> readBytes(const std::filesystem::path &filePath) override;
+
+    [[nodiscard]]
+    AsyncFileResult<void> write(const std::filesystem::path &filePath, std::string content,
+                                bool append = false) override;
+
+    [[nodiscard]]
+    std::string_view backendName() const noexcept override {
+      return "io_uring";
+    }
+
+    /**
+     * @brief Snapshot of the submission counters
+     *
+     * @return IoUringStats
+     */
+    [[nodiscard]]
+    IoUringStats stats() const noexcept;
+
+  private:
+    struct Ring;
+
+    explicit IoUringFileIO(std::unique_ptr<Ring> ring);
+
+    std::unique_ptr<Ring> ring_;
+  };
+
+} // namespace nixoncpp::utils
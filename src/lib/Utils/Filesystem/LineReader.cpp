@@ -0,0 +1,229 @@
+#include "LineReader.hpp"
+#include <Utils/Filesystem/PosixIo.hpp>
+#include <Utils/String/NewlineScanner.hpp>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <span>
+
+namespace nixoncpp::utils {
+
+  namespace {
+    std::string_view stripCarriageReturn(std::string_view line) noexcept {
+      if (!line.empty() && line.back() == '\r') {
+        line.remove_suffix(1);
+      }
+      return line;
+    }
+
+    /**
+     * @return Bytes decoded, 0 at the end of the data, -1 on error (stored in error)
+     */
+    std::ptrdiff_t readDecoded(DecompressingReader &decoder, std::optional<FileError> &error,
+                               char *data, std::size_t size) {
+      auto got = decoder.read(std::as_writable_bytes(std::span(data, size)));
+      if (!got) {
+        error = got.error();
+        return -1;
+      }
+      return static_cast<std::ptrdiff_t>(got.value());
+    }
+  } // namespace
+
+  // ============================================================================
+  // LineSplitter
+  // ============================================================================
+
+  bool LineSplitter::next(std::string_view &line) noexcept {
+    if (done_ || rest_.empty()) {
+      done_ = true;
+      return false;
+    }
+    const char *begin = rest_.data();
+    const char *end = begin + rest_.size();
+    const char *newline = findNewline(begin, end);
+    line = stripCarriageReturn(std::string_view(begin, static_cast<std::size_t>(newline - begin)));
+    if (newline == end) {
+      rest_ = {};
+    } else {
+      rest_.remove_prefix(static_cast<std::size_t>(newline - begin) + 1);
+    }
+    return true;
+  }
+
+  // ============================================================================
+  // LineReader
+  // ============================================================================
+
+#if defined(NIXONCPP_HAS_POSIX_IO)
+  struct LineReader::Source {
+    detail::UniqueFd fd;
+    std::optional<DecompressingReader> decoder; // Replaces fd when set
+    std::optional<FileError> error;             // Set by the decoder
+
+    /**
+     * @return Bytes read, 0 at end of file, -1 on error (errno or error set)
+     */
+    std::ptrdiff_t read(char *data, std::size_t size) {
+      if (decoder) {
+        return readDecoded(*decoder, error, data, size);
+      }
+      for (;;) {
+        const auto got = ::read(fd.get(), data, size);
+        if (got >= 0 || errno != EINTR) {
+          return static_cast<std::ptrdiff_t>(got);
+        }
+      }
+    }
+  };
+#else
+  struct LineReader::Source {
+    std::ifstream stream;
+    std::optional<DecompressingReader> decoder;
+    std::optional<FileError> error;
+
+    std::ptrdiff_t read(char *data, std::size_t size) {
+      if (decoder) {
+        return readDecoded(*decoder, error, data, size);
+      }
+      stream.read(data, static_cast<std::streamsize>(size));
+      if (stream.bad()) {
+        return -1;
+      }
+      return static_cast<std::ptrdiff_t>(stream.gcount());
+    }
+  };
+#endif
+
+  LineReader::LineReader(std::unique_ptr<Source> source, std::filesystem::path filePath,
+                         std::size_t chunkSize)
+      : source_(std::move(source)), filePath_(std::move(filePath)),
+        buffer_(std::max<std::size_t>(chunkSize, 1)) {}
+
+  LineReader::LineReader(LineReader &&other) noexcept = default;
+  LineReader &LineReader::operator=(LineReader &&other) noexcept = default;
+  LineReader::~LineReader() = default;
+
+  Result<LineReader, FileError> LineReader::open(const std::filesystem::path &filePath,
+                                                 std::size_t chunkSize) {
+    if (filePath.empty()) {
+      return FileError{
+          .code = FileErrorCode::InvalidPath,
+          .message = "Empty file path",
+          .path = "",
+      };
+    }
+
+    auto source = std::make_unique<Source>();
+#if defined(NIXONCPP_HAS_POSIX_IO)
+    source->fd = detail::openFile(filePath, O_RDONLY);
+    if (!source->fd) {
+      return detail::makeErrnoError(errno, FileErrorCode::ReadError,
+                                    "Failed to open file for reading", filePath);
+    }
+    struct stat info{};
+    if (::fstat(source->fd.get(), &info) == 0 && S_ISDIR(info.st_mode)) {
+      return FileError{
+          .code = FileErrorCode::IsDirectory,
+          .message = "Path is a directory, not a file",
+          .path = filePath.string(),
+      };
+    }
+#else
+    std::error_code ec;
+    if (std::filesystem::is_directory(filePath, ec)) {
+      return FileError{
+          .code = FileErrorCode::IsDirectory,
+          .message = "Path is a directory, not a file",
+          .path = filePath.string(),
+      };
+    }
+    source->stream.open(filePath, std::ios::binary);
+    if (!source->stream.is_open()) {
+      return FileError{
+          .code = std::filesystem::exists(filePath, ec) ? FileErrorCode::ReadError
+                                                        : FileErrorCode::NotFound,
+          .message = "Failed to open file for reading",
+          .path = filePath.string(),
+      };
+    }
+#endif
+
+    return LineReader(std::move(source), filePath, chunkSize);
+  }
+
+  LineReader LineReader::decompressing(DecompressingReader decoder, std::size_t chunkSize) {
+    auto source = std::make_unique<Source>();
+    source->decoder.emplace(std::move(decoder));
+    return LineReader(std::move(source), {}, chunkSize);
+  }
+
+  bool LineReader::fill() {
+    // Keep the unfinished line, drop everything before it
+    if (begin_ > 0) {
+      std::memmove(buffer_.data(), buffer_.data() + begin_, end_ - begin_);
+      end_ -= begin_;
+      scanFrom_ -= begin_;
+      begin_ = 0;
+    }
+    if (end_ == buffer_.size()) {
+      buffer_.resize(buffer_.size() * 2); // A single line longer than the buffer
+    }
+
+    const auto got = source_->read(buffer_.data() + end_, buffer_.size() - end_);
+    if (got < 0 && source_->error) {
+      error_ = source_->error;
+      return false;
+    }
+    if (got < 0) {
+#if defined(NIXONCPP_HAS_POSIX_IO)
+      error_ = detail::makeErrnoError(errno, FileErrorCode::ReadError,
+                                      "I/O error while reading file", filePath_);
+#else
+      error_ = FileError{
+          .code = FileErrorCode::ReadError,
+          .message = "I/O error while reading file",
+          .path = filePath_.string(),
+      };
+#endif
+      return false;
+    }
+    if (got == 0) {
+      eof_ = true;
+      return false;
+    }
+    end_ += static_cast<std::size_t>(got);
+    return true;
+  }
+
+  bool LineReader::next(std::string_view &line) {
+    if (!source_ || error_) {
+      return false;
+    }
+
+    for (;;) {
+      const char *data = buffer_.data();
+      const char *newline = findNewline(data + scanFrom_, data + end_);
+      if (newline != data + end_) {
+        const auto lineEnd = static_cast<std::size_t>(newline - data);
+        line = stripCarriageReturn(std::string_view(data + begin_, lineEnd - begin_));
+        begin_ = lineEnd + 1;
+        scanFrom_ = begin_;
+        return true;
+      }
+      scanFrom_ = end_;
+
+      if (eof_ || !fill()) {
+        if (error_ || begin_ == end_) {
+          return false;
+        }
+        // Last line without a trailing newline
+        line = stripCarriageReturn(std::string_view(buffer_.data() + begin_, end_ - begin_));
+        begin_ = end_;
+        scanFrom_ = end_;
+        return true;
+      }
+    }
+  }
+
+} // namespace nixoncpp::utils
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <Utils/Filesystem/Compression.hpp>
+#include <Utils/UtilsError.hpp>
+#include <cstddef>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace nixoncpp::utils {
+
+  /**
+   * @brief Input iterator over the lines produced by a line source
+   *
+   * @tparam Source Type with `bool next(std::string_view &line)`
+   */
+  template <typename Source>
+  class LineIterator {
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = std::string_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const std::string_view *;
+    using reference = const std::string_view &;
+
+    LineIterator() = default;
+    explicit LineIterator(Source *source) : source_(source) { ++*this; }
+
+    reference operator*() const { return line_; }
+    pointer operator->() const { return &line_; }
+
+    LineIterator &operator++() {
+      if (source_ != nullptr && !source_->next(line_)) {
+        source_ = nullptr;
+      }
+      return *this;
+    }
+
+    void operator++(int) { ++*this; }
+
+    friend bool operator==(const LineIterator &it, std::default_sentinel_t) {
+      return it.source_ == nullptr;
+    }
+
+  private:
+    Source *source_ = nullptr;
+    std::string_view line_;
+  };
+
+  /**
+   * @brief Lazy line range over text already in memory (e.g. MappedFile::view())
+   *
+   * Lines are split on '\n', a trailing '\r' is removed and a final newline does not produce
+   * an extra empty line. Yielded views point into the original text.
+   */
+  class LineSplitter {
+  public:
+    explicit LineSplitter(std::string_view text) noexcept : rest_(text) {}
+
+    /**
+     * @brief Advance to the next line
+     *
+     * @param line Receives the line without its line break
+     * @return false when there are no more lines
+     */
+    bool next(std::string_view &line) noexcept;
+
+    [[nodiscard]]
+    LineIterator<LineSplitter> begin() {
+      return LineIterator<LineSplitter>(this);
+    }
+
+    [[nodiscard]]
+    std::default_sentinel_t end() const noexcept {
+      return {};
+    }
+
+  private:
+    std::string_view rest_;
+    bool done_ = false;
+  };
+
+  /**
+   * @brief Lazy line range streaming a file through one reusable chunk buffer
+   *
+   * Memory use is bounded by the chunk size (or the longest line, if longer); no per-line
+   * allocation takes place. Yielded views stay valid until the next line is requested. Line
+   * handling matches LineSplitter. Move-only.
+   */
+  class LineReader {
+  public:
+    static constexpr std::size_t kDefaultChunkSize = 64 * 1024;
+
+    LineReader(const LineReader &) = delete;
+    LineReader &operator=(const LineReader &) = delete;
+    LineReader(LineReader &&other) noexcept;
+    LineReader &operator=(LineReader &&other) noexcept;
+    ~LineReader();
+
+    /**
+     * @brief Open a file for line-by-line reading
+     *
+     * @param filePath
+     * @param chunkSize Bytes requested from the file per read
+     * @return Result<LineReader, FileError>
+     */
+    [[nodiscard]]
+    static Result<LineReader, FileError> open(const std::filesystem::path &filePath,
+                                              std::size_t chunkSize = kDefaultChunkSize);
+
+    /**
+     * @brief Read the lines of a decoded (e.g. gzip or zstd compressed) stream
+     *
+     * @param decoder
+     * @param chunkSize Decoded bytes requested per read
+     * @return LineReader
+     */
+    [[nodiscard]]
+    static LineReader decompressing(DecompressingReader decoder,
+                                    std::size_t chunkSize = kDefaultChunkSize);
+
+    /**
+     * @brief Advance to the next line
+     *
+     * @param line Receives the line without its line break
+     * @return false at end of file or on a read error (see error())
+     */
+    bool next(std::string_view &line);
+
+    /**
+     * @brief Read error that ended iteration early, if any
+     *
+     * @return const std::optional<FileError>&
+     */
+    [[nodiscard]]
+    const std::optional<FileError> &error() const noexcept {
+      return error_;
+    }
+
+    [[nodiscard]]
+    LineIterator<LineReader> begin() {
+      return LineIterator<LineReader>(this);
+    }
+
+    [[nodiscard]]
+    std::default_sentinel_t end() const noexcept {
+      return {};
+    }
+
+  private:
+    struct Source;
+
+    LineReader(std::unique_ptr<Source> source, std::filesystem::path filePath,
+               std::size_t chunkSize);
+
+    bool fill();
+
+    std::unique_ptr<Source> source_;
+    std::filesystem::path filePath_;
+    std::vector<char> buffer_;
+    std::size_t begin_ = 0;    // Start of the next line
+    std::size_t scanFrom_ = 0; // Bytes before this offset are known not to contain '\n'
+    std::size_t end_ = 0;      // End of valid data
+    bool eof_ = false;
+    std::optional<FileError> error_;
+  };
+
+} // namespace nixoncpp::utils
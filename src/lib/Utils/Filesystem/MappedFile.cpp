@@ -0,0 +1,139 @@
+#include "MappedFile.hpp"
+#include <Utils/Filesystem/PosixIo.hpp>
+#include <fstream>
+#include <utility>
+
+#if defined(NIXONCPP_HAS_POSIX_IO)
+#include <sys/mman.h>
+#endif
+
+namespace nixoncpp::utils {
+
+  MappedFile::MappedFile(const std::byte *data, std::size_t size, bool mapped,
+                         std::unique_ptr<std::byte[]> buffer) noexcept
+      : data_(data), size_(size), mapped_(mapped), buffer_(std::move(buffer)) {}
+
+  MappedFile::MappedFile(MappedFile &&other) noexcept
+      : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)),
+        mapped_(std::exchange(other.mapped_, false)), buffer_(std::move(other.buffer_)) {}
+
+  MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+    if (this != &other) {
+      release();
+      data_ = std::exchange(other.data_, nullptr);
+      size_ = std::exchange(other.size_, 0);
+      mapped_ = std::exchange(other.mapped_, false);
+      buffer_ = std::move(other.buffer_);
+    }
+    return *this;
+  }
+
+  MappedFile::~MappedFile() { release(); }
+
+  void MappedFile::release() noexcept {
+#if defined(NIXONCPP_HAS_POSIX_IO)
+    if (mapped_ && data_ != nullptr) {
+      ::munmap(const_cast<std::byte *>(data_), size_);
+    }
+#endif
+    buffer_.reset();
+    data_ = nullptr;
+    size_ = 0;
+    mapped_ = false;
+  }
+
+  void MappedFile::advise(AccessPattern pattern) const noexcept {
+#if defined(NIXONCPP_HAS_POSIX_IO)
+    if (!mapped_ || data_ == nullptr) {
+      return;
+    }
+    int advice = MADV_NORMAL;
+    switch (pattern) {
+    case AccessPattern::Normal: advice = MADV_NORMAL; break;
+    case AccessPattern::Sequential: advice = MADV_SEQUENTIAL; break;
+    case AccessPattern::Random: advice = MADV_RANDOM; break;
+    case AccessPattern::WillNeed: advice = MADV_WILLNEED; break;
+    case AccessPattern::DontNeed: advice = MADV_DONTNEED; break;
+    }
+    // Purely a hint; failure does not affect the content
+    (void)::madvise(const_cast<std::byte *>(data_), size_, advice);
+#else
+    (void)pattern;
+#endif
+  }
+
+  Result<MappedFile, FileError> MappedFile::open(const std::filesystem::path &filePath,
+                                                 AccessPattern pattern) {
+#if defined(NIXONCPP_HAS_POSIX_IO)
+    auto fd = detail::openFile(filePath, O_RDONLY);
+    if (!fd) {
+      return detail::makeErrnoError(errno, FileErrorCode::ReadError,
+                                    "Failed to open file for reading", filePath);
+    }
+
+    struct stat info{};
+    if (::fstat(fd.get(), &info) != 0) {
+      return detail::makeErrnoError(errno, FileErrorCode::ReadError, "Failed to stat file",
+                                    filePath);
+    }
+    if (S_ISDIR(info.st_mode)) {
+      return FileError{
+          .code = FileErrorCode::IsDirectory,
+          .message = "Path is a directory, not a file",
+          .path = filePath.string(),
+      };
+    }
+
+    const auto size = static_cast<std::size_t>(info.st_size);
+    if (size == 0) {
+      return MappedFile{};
+    }
+
+    void *mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd.get(), 0);
+    if (mapping == MAP_FAILED) {
+      return detail::makeErrnoError(errno, FileErrorCode::ReadError, "Failed to map file",
+                                    filePath);
+    }
+
+    // The mapping stays valid after the descriptor is closed
+    MappedFile file(static_cast<const std::byte *>(mapping), size, true);
+    file.advise(pattern);
+    return file;
+#else
+    (void)pattern;
+    std::error_code ec;
+    const auto size = std::filesystem::file_size(filePath, ec);
+    if (ec) {
+      return FileError{
+          .code = FileErrorCode::ReadError,
+          .message = fmt::format("Failed to get file size: {}", ec.message()),
+          .path = filePath.string(),
+      };
+    }
+    if (size == 0) {
+      return MappedFile{};
+    }
+
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+      return FileError{
+          .code = FileErrorCode::ReadError,
+          .message = "Failed to open file for reading",
+          .path = filePath.string(),
+      };
+    }
+    auto buffer = std::make_unique<std::byte[]>(static_cast<std::size_t>(size));
+    file.read(reinterpret_cast<char *>(buffer.get()), static_cast<std::streamsize>(size));
+    if (static_cast<std::uintmax_t>(file.gcount()) != size) {
+      return FileError{
+          .code = FileErrorCode::ReadError,
+          .message = "I/O error while reading file",
+          .path = filePath.string(),
+      };
+    }
+    const auto *data = buffer.get();
+    return MappedFile(data, static_cast<std::size_t>(size), false, std::move(buffer));
+#endif
+  }
+
+} // namespace nixoncpp::utils
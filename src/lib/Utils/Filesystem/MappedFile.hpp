@@ -0,0 +1,101 @@
+#pragma once
+
+#include <Utils/Filesystem/AccessPattern.hpp>
+#include <Utils/UtilsError.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string_view>
+
+namespace nixoncpp::utils {
+
+  /**
+   * @brief Read-only view of a whole file mapped into memory
+   *
+   * Move-only; the mapping is released when the object is destroyed. On POSIX the content is
+   * mmap'ed and never copied. On platforms without mmap support the file is read once into a
+   * single heap buffer, with the same interface.
+   */
+  class MappedFile final {
+  public:
+    MappedFile() = default;
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    MappedFile(MappedFile &&other) noexcept;
+    MappedFile &operator=(MappedFile &&other) noexcept;
+    ~MappedFile();
+
+    /**
+     * @brief Map a regular file read-only
+     *
+     * @param filePath
+     * @param pattern Initial access hint
+     * @return Result<MappedFile, FileError>
+     */
+    [[nodiscard]]
+    static Result<MappedFile, FileError> open(const std::filesystem::path &filePath,
+                                              AccessPattern pattern = AccessPattern::Sequential);
+
+    /**
+     * @brief Content as bytes
+     *
+     * @return std::span<const std::byte>
+     */
+    [[nodiscard]]
+    std::span<const std::byte> bytes() const noexcept {
+      return {data_, size_};
+    }
+
+    /**
+     * @brief Content as characters
+     *
+     * @return std::string_view
+     */
+    [[nodiscard]]
+    std::string_view view() const noexcept {
+      return {reinterpret_cast<const char *>(data_), size_};
+    }
+
+    [[nodiscard]]
+    std::size_t size() const noexcept {
+      return size_;
+    }
+
+    [[nodiscard]]
+    bool empty() const noexcept {
+      return size_ == 0;
+    }
+
+    /**
+     * @brief Whether the content is an actual memory mapping (false for the fallback buffer)
+     *
+     * @return true
+     * @return false
+     */
+    [[nodiscard]]
+    bool isMapped() const noexcept {
+      return mapped_;
+    }
+
+    /**
+     * @brief Change the access hint for the whole mapping; no-op without mmap support
+     *
+     * @param pattern
+     */
+    void advise(AccessPattern pattern) const noexcept;
+
+  private:
+    MappedFile(const std::byte *data, std::size_t size, bool mapped,
+               std::unique_ptr<std::byte[]> buffer = nullptr) noexcept;
+
+    void release() noexcept;
+
+    const std::byte *data_ = nullptr;
+    std::size_t size_ = 0;
+    bool mapped_ = false;
+    std::unique_ptr<std::byte[]> buffer_; // Fallback storage when mmap is unavailable
+  };
+
+} // namespace nixoncpp::utils
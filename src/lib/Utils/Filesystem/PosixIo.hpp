@@ -0,0 +1,248 @@
+#pragma once
+
+#include <Utils/Filesystem/AccessPattern.hpp>
+#include <Utils/UtilsError.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fmt/core.h>
+#include <span>
+#include <string_view>
+#include <utility>
+
+#if defined(__linux__) || defined(__APPLE__)
+#define NIXONCPP_HAS_POSIX_IO 1
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+// Small helpers shared by the POSIX fast paths of the filesystem utilities.
+// Other platforms fall back to the std::filesystem / iostream implementations.
+
+namespace nixoncpp::utils::detail {
+
+  /**
+   * @brief Map an errno value to the closest FileErrorCode
+   *
+   * @param err errno value
+   * @param fallback Code used when errno has no specific mapping
+   * @return FileErrorCode
+   */
+  inline FileErrorCode fileErrorCodeFromErrno(int err, FileErrorCode fallback) noexcept {
+    switch (err) {
+    case ENOENT: return FileErrorCode::NotFound;
+    case EACCES:
+    case EPERM: return FileErrorCode::AccessDenied;
+    case EEXIST: return FileErrorCode::AlreadyExists;
+    case EISDIR: return FileErrorCode::IsDirectory;
+    case ENOTDIR: return FileErrorCode::NotDirectory;
+    case ENAMETOOLONG:
+    case EINVAL: return FileErrorCode::InvalidPath;
+    default: return fallback;
+    }
+  }
+
+  /**
+   * @brief Build a FileError from errno
+   *
+   * @param err errno value
+   * @param fallback Code used when errno has no specific mapping
+   * @param what Short description of the failed operation
+   * @param path
+   * @return FileError
+   */
+  inline FileError makeErrnoError(int err, FileErrorCode fallback, std::string_view what,
+                                  const std::filesystem::path &path) {
+    return FileError{
+        .code = fileErrorCodeFromErrno(err, fallback),
+        .message = fmt::format("{}: {}", what, std::strerror(err)),
+        .path = path.string(),
+    };
+  }
+
+#if defined(NIXONCPP_HAS_POSIX_IO)
+  /**
+   * @brief Owning, move-only file descriptor
+   */
+  class UniqueFd final {
+  public:
+    UniqueFd() = default;
+    explicit UniqueFd(int fd) noexcept : fd_(fd) {}
+    UniqueFd(const UniqueFd &) = delete;
+    UniqueFd &operator=(const UniqueFd &) = delete;
+    UniqueFd(UniqueFd &&other) noexcept : fd_(std::exchange(other.fd_, -1)) {}
+    UniqueFd &operator=(UniqueFd &&other) noexcept {
+      if (this != &other) {
+        reset(std::exchange(other.fd_, -1));
+      }
+      return *this;
+    }
+    ~UniqueFd() { reset(); }
+
+    [[nodiscard]]
+    int get() const noexcept {
+      return fd_;
+    }
+
+    [[nodiscard]]
+    explicit operator bool() const noexcept {
+      return fd_ >= 0;
+    }
+
+    int release() noexcept { return std::exchange(fd_, -1); }
+
+    void reset(int fd = -1) noexcept {
+      if (fd_ >= 0) {
+        ::close(fd_);
+      }
+      fd_ = fd;
+    }
+
+  private:
+    int fd_ = -1;
+  };
+
+  /**
+   * @brief open(2) with O_CLOEXEC, retrying on EINTR
+   *
+   * @param path
+   * @param flags
+   * @param mode Permissions when O_CREAT is given
+   * @return UniqueFd Invalid on failure, errno is preserved
+   */
+  inline UniqueFd openFile(const std::filesystem::path &path, int flags, mode_t mode = 0644) {
+    int fd = -1;
+    do {
+      fd = ::open(path.c_str(), flags | O_CLOEXEC, mode);
+    } while (fd < 0 && errno == EINTR);
+    return UniqueFd{fd};
+  }
+
+#if defined(IOV_MAX)
+  inline constexpr std::size_t kMaxIovecs = IOV_MAX;
+#else
+  inline constexpr std::size_t kMaxIovecs = 1024; // POSIX minimum is 16; Linux and macOS use 1024
+#endif
+
+  /**
+   * @brief writev(2) every piece, in kMaxIovecs-sized calls, retrying partial writes
+   *
+   * @param fd
+   * @param pieces Adjusted in place while writing
+   * @return false on error, errno is preserved
+   */
+  inline bool writeAllVectored(int fd, std::span<iovec> pieces) {
+    std::size_t index = 0;
+    while (index < pieces.size()) {
+      const auto count = std::min(pieces.size() - index, kMaxIovecs);
+      const auto written = ::writev(fd, pieces.data() + index, static_cast<int>(count));
+      if (written < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return false;
+      }
+      auto remaining = static_cast<std::size_t>(written);
+      while (index < pieces.size() && remaining >= pieces[index].iov_len) {
+        remaining -= pieces[index].iov_len;
+        ++index;
+      }
+      if (index < pieces.size()) {
+        pieces[index].iov_base = static_cast<char *>(pieces[index].iov_base) + remaining;
+        pieces[index].iov_len -= remaining;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Forward an access pattern to posix_fadvise(); a hint, failures are ignored
+   *
+   * @param fd
+   * @param offset
+   * @param length 0 = up to the end of the file
+   * @param pattern
+   */
+  inline void adviseFile(int fd, off_t offset, off_t length, AccessPattern pattern) noexcept {
+#if defined(POSIX_FADV_NORMAL)
+    int advice = POSIX_FADV_NORMAL;
+    switch (pattern) {
+    case AccessPattern::Normal: advice = POSIX_FADV_NORMAL; break;
+    case AccessPattern::Sequential: advice = POSIX_FADV_SEQUENTIAL; break;
+    case AccessPattern::Random: advice = POSIX_FADV_RANDOM; break;
+    case AccessPattern::WillNeed: advice = POSIX_FADV_WILLNEED; break;
+    case AccessPattern::DontNeed: advice = POSIX_FADV_DONTNEED; break;
+    }
+    (void)::posix_fadvise(fd, offset, length, advice);
+#else
+    (void)fd;
+    (void)offset;
+    (void)length;
+    (void)pattern;
+#endif
+  }
+
+  /**
+   * @brief Drop freshly written pages from the page cache
+   *
+   * Dirty pages cannot be dropped, so the range is written back first (without the metadata
+   * flush of fdatasync() where sync_file_range() exists).
+   *
+   * @param fd
+   * @param offset
+   * @param length
+   */
+  inline void dropWrittenPages(int fd, off_t offset, off_t length) noexcept {
+#if defined(__linux__)
+    (void)::sync_file_range(fd, offset, length,
+                            SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE |
+                                SYNC_FILE_RANGE_WAIT_AFTER);
+#else
+    (void)::fsync(fd);
+#endif
+    adviseFile(fd, offset, length, AccessPattern::DontNeed);
+  }
+
+  /**
+   * @brief Reserve disk space for [offset, offset + length) without changing the file size
+   *
+   * Lets the filesystem allocate one contiguous extent up front instead of extending the
+   * file piecemeal. A hint: unsupported filesystems simply fall back to allocate-on-write.
+   * posix_fallocate() is not used since it grows the file and, where the filesystem lacks
+   * support, emulates the reservation by writing every block.
+   *
+   * @param fd
+   * @param offset
+   * @param length
+   */
+  inline void reserveSpace(int fd, off_t offset, off_t length) noexcept {
+    if (length <= 0) {
+      return;
+    }
+#if defined(__linux__)
+    (void)::fallocate(fd, FALLOC_FL_KEEP_SIZE, offset, length);
+#elif defined(__APPLE__)
+    // F_PREALLOCATE reserves beyond the current end of file
+    struct stat info{};
+    if (::fstat(fd, &info) != 0 || offset + length <= info.st_size) {
+      return;
+    }
+    fstore_t store{.fst_flags = F_ALLOCATECONTIG,
+                   .fst_posmode = F_PEOFPOSMODE,
+                   .fst_offset = 0,
+                   .fst_length = offset + length - info.st_size,
+                   .fst_bytesalloc = 0};
+    if (::fcntl(fd, F_PREALLOCATE, &store) == -1) {
+      store.fst_flags = F_ALLOCATEALL;
+      (void)::fcntl(fd, F_PREALLOCATE, &store);
+    }
+#endif
+  }
+#endif
+
+} // namespace nixoncpp::utils::detail
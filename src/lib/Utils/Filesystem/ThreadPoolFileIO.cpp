@@ -0,0 +1,78 @@
+#include "ThreadPoolFileIO.hpp"
+#include <exception>
+#include <future>
+#include <type_traits>
+#include <utility>
+
+namespace nixoncpp::utils {
+
+  ThreadPoolFileIO::ThreadPoolFileIO(std::shared_ptr<IFileReader> fileReader,
+                                     std::shared_ptr<IFileWriter> fileWriter,
+                                     std::shared_ptr<ThreadPool> pool)
+      : fileReader_(std::move(fileReader)), fileWriter_(std::move(fileWriter)),
+        pool_(std::move(pool)) {}
+
+  ThreadPoolFileIO::~ThreadPoolFileIO() {
+    std::unique_lock lock(inFlightMutex_);
+    idle_.wait(lock, [this] { return inFlight_ == 0; });
+  }
+
+  template <typename Fn>
+  auto ThreadPoolFileIO::submit(Fn &&operation) {
+    using R = std::invoke_result_t<std::decay_t<Fn>>;
+    std::promise<R> promise;
+    auto future = promise.get_future();
+    {
+      const std::lock_guard lock(inFlightMutex_);
+      ++inFlight_;
+    }
+    struct Done {
+      explicit Done(ThreadPoolFileIO *owner) : self(owner) {}
+      Done(const Done &) = delete;
+      Done &operator=(const Done &) = delete;
+      Done(Done &&) = delete;
+      Done &operator=(Done &&) = delete;
+      ~Done() {
+        // Notify under the lock: the destructor may free the object as soon as it is released
+        const std::lock_guard lock(self->inFlightMutex_);
+        if (--self->inFlight_ == 0) {
+          self->idle_.notify_all();
+        }
+      }
+      ThreadPoolFileIO *self;
+    };
+    try {
+      // The result is stored before the count drops, so destruction finds every future ready
+      (void)pool_->submit([this, promise = std::move(promise),
+                           operation = std::forward<Fn>(operation)]() mutable {
+        const Done done(this);
+        try {
+          promise.set_value(operation());
+        } catch (...) {
+          promise.set_exception(std::current_exception());
+        }
+      });
+    } catch (...) {
+      const Done done(this);
+      throw;
+    }
+    return future;
+  }
+
+  AsyncFileResult<std::string> ThreadPoolFileIO::read(const std::filesystem::path &filePath) {
+    return submit([reader = fileReader_, filePath] { return reader->read(filePath); });
+  }
+
+  AsyncFileResult<std::vector<uint8_t>>
+      ThreadPoolFileIO::readBytes(const std::filesystem::path &filePath) {
+    return submit([reader = fileReader_, filePath] { return reader->readBytes(filePath); });
+  }
+
+  AsyncFileResult<void> ThreadPoolFileIO::write(const std::filesystem::path &filePath,
+                                                std::string content, bool append) {
+    return submit([writer = fileWriter_, filePath, content = std::move(content), append] {
+      return writer->write(filePath, content, append);
+    });
+  }
+
+} // namespace nixoncpp::utils
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <Utils/Concurrency/ThreadPool.hpp>
+#include <Utils/Filesystem/IAsyncFileIO.hpp>
+#include <Utils/Filesystem/IFileReader.hpp>
+#include <Utils/Filesystem/IFileWriter.hpp>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+
+namespace nixoncpp::utils {
+
+  /**
+   * @brief Portable IAsyncFileIO running the blocking reader/writer calls on a thread pool
+   *
+   * Used wherever io_uring is not available. Concurrency is bounded by the pool size; a pool
+   * without threads completes every operation before the call returns. The destructor waits
+   * for the operations issued through this object, so it must not run on a thread of the pool.
+   */
+  class ThreadPoolFileIO final : public IAsyncFileIO {
+  public:
+    ThreadPoolFileIO(std::shared_ptr<IFileReader> fileReader,
+                     std::shared_ptr<IFileWriter> fileWriter, std::shared_ptr<ThreadPool> pool);
+    ThreadPoolFileIO(const ThreadPoolFileIO &) = delete;
+    ThreadPoolFileIO &operator=(const ThreadPoolFileIO &) = delete;
+    ThreadPoolFileIO(ThreadPoolFileIO &&) = delete;
+    ThreadPoolFileIO &operator=(ThreadPoolFileIO &&) = delete;
+    ~ThreadPoolFileIO() override;
+
+    [[nodiscard]]
+    AsyncFileResult<std::string> read(const std::filesystem::path &filePath) override;
+
+    [[nodiscard]]
+    AsyncFileResult<std::vector<uint8_t>> readBytes(const std::filesystem::path &filePath) override;
+
+    [[nodiscard]]
+    AsyncFileResult<void> write(const std::filesystem::path &filePath, std::string content,
+                                bool append = false) override;
+
+    [[nodiscard]]
+    std::string_view backendName() const noexcept override {
+      return "thread-pool";
+    }
+
+  private:
+    // Run an operation on the pool, counted in inFlight_ until its result is stored
+    template <typename Fn>
+    auto submit(Fn &&operation);
+
+    std::shared_ptr<IFileReader> fileReader_;
+    std::shared_ptr<IFileWriter> fileWriter_;
+    std::shared_ptr<ThreadPool> pool_;
+    std::mutex inFlightMutex_;
+    std::condition_variable idle_;
+    std::size_t inFlight_ = 0;
+  };
+
+} // namespace nixoncpp::utils
@@ -1,9 +1,14 @@
 #ifndef CONSOLELOGGER_HPP
 #define CONSOLELOGGER_HPP
 
+#include "ILogSink.hpp"
 #include "ILogger.hpp"
+#include "LogIndex.hpp"
 
+#include <Utils/Concurrency/AtomicSnapshot.hpp>
+#include <atomic>
 #include <chrono>
+#include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -12,6 +17,7 @@
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "fmt/core.h"
 
@@ -25,29 +31,50 @@
 #endif
 
 class ConsoleLogger : public nixoncpp::logging::ILogger {
+public:
+  /**
+   * @brief Formatting configuration of the logger.
+   *
+   * Held as an immutable snapshot: setters publish a modified copy, log calls read the
+   * current one without locking.
+   */
+  struct Format {
+    std::string appPrefix;
+    std::string headerName; // Shown before the prefix when set
+    bool includeName = true;
+    bool includeTime = true;
+    bool includeCaller = true;
+    bool includeLevel = true;
+    bool addNewLine = true;
+    bool colorEnabled = true;    // User can override
+    bool autoDetectColor = true; // Auto-detect TTY support
+  };
+
 private:
-  std::mutex logMutex_;
+  std::mutex logMutex_; // Serializes output only
   std::ofstream logFile_;
-  bool addNewLine_ = true;
-  std::string appPrefix_;
+  std::string logFilePath_;
+  std::uint64_t logFileOffset_ = 0; // Bytes in the log file, used by the sidecar index
+  std::uint32_t logIndexRecordsPerBlock_ = 0; // 0 = no sidecar index
+  std::unique_ptr<nixoncpp::logging::LogIndexWriter> logIndex_;
+  nixoncpp::utils::AtomicSnapshot<Format> format_;
+  nixoncpp::utils::AtomicSnapshot<std::vector<std::shared_ptr<nixoncpp::logging::ILogSink>>> sinks_;
 
 /**
  * @brief Current logging level for the console logger defined at compile time.
  *
  */
 #ifdef DEBUG
-  nixoncpp::logging::Level currentLevel_ = nixoncpp::logging::Level::LOG_DEBUG;
+  std::atomic<nixoncpp::logging::Level> currentLevel_{nixoncpp::logging::Level::LOG_DEBUG};
 #else
-  nixoncpp::logging::Level currentLevel_ = nixoncpp::logging::Level::LOG_INFO;
+  std::atomic<nixoncpp::logging::Level> currentLevel_{nixoncpp::logging::Level::LOG_INFO};
 #endif
 
-  bool colorEnabled_ = true;    // User can override
-  bool autoDetectColor_ = true; // Auto-detect TTY support
-
 public:
   ConsoleLogger() = default;
   ~ConsoleLogger() {
     std::lock_guard<std::mutex> lock(logMutex_);
+    logIndex_.reset();
     if (logFile_.is_open()) {
       logFile_.close();
     }
@@ -56,9 +83,11 @@ public:
   ConsoleLogger(const ConsoleLogger &) = delete;
   ConsoleLogger &operator=(const ConsoleLogger &) = delete;
   ConsoleLogger(ConsoleLogger &&other) noexcept
-      : logFile_(std::move(other.logFile_)), addNewLine_(other.addNewLine_),
-        appPrefix_(std::move(other.appPrefix_)), currentLevel_(other.currentLevel_),
-        colorEnabled_(other.colorEnabled_), autoDetectColor_(other.autoDetectColor_) {}
+      : logFile_(std::move(other.logFile_)), logFilePath_(std::move(other.logFilePath_)),
+        logFileOffset_(other.logFileOffset_),
+        logIndexRecordsPerBlock_(other.logIndexRecordsPerBlock_),
+        logIndex_(std::move(other.logIndex_)), format_(other.format_.load()),
+        sinks_(other.sinks_.load()), currentLevel_(other.currentLevel_.load()) {}
 
   ConsoleLogger &operator=(ConsoleLogger &&other) noexcept {
     if (this != &other) {
@@ -68,11 +97,14 @@ public:
       std::lock_guard<std::mutex> lock2(other.logMutex_, std::adopt_lock);
 
       logFile_ = std::move(other.logFile_);
-      addNewLine_ = other.addNewLine_;
-      appPrefix_ = std::move(other.appPrefix_);
-      currentLevel_ = other.currentLevel_;
-      colorEnabled_ = other.colorEnabled_;
-      autoDetectColor_ = other.autoDetectColor_;
+      logFilePath_ = std::move(other.logFilePath_);
+      logFileOffset_ = other.logFileOffset_;
+      logIndexRecordsPerBlock_ = other.logIndexRecordsPerBlock_;
+      logIndex_ = std::move(other.logIndex_);
+      // Snapshots are immutable, so the moved-to logger shares them instead of copying
+      format_.adopt(other.format_.load());
+      sinks_.adopt(other.sinks_.load());
+      currentLevel_.store(other.currentLevel_.load());
     }
     return *this;
   }
@@ -100,85 +132,137 @@ public:
   /**
    * @brief Logs a message with a specified level to the console and optionally to a file.
    *
+   * The header is built from the current format snapshot outside of the lock; the lock only
+   * serializes console and file output. Registered sinks are called afterwards, outside of the
+   * lock.
+   *
    * @param level
    * @param message
    * @param caller
    */
   void log(nixoncpp::logging::Level level, const std::string &message, const std::string &caller) {
-    std::lock_guard<std::mutex> lock(logMutex_);
-
-    // Get current time
-    auto now = std::chrono::system_clock::now();
-    std::time_t now_c = std::chrono::system_clock::to_time_t(now);
-    std::tm now_tm;
-
-    // Windows and POSIX have different thread-safe localtime functions
-#ifdef _WIN32
-    localtime_s(&now_tm, &now_c);
-#else
-    localtime_r(&now_c, &now_tm);
-#endif
+    const auto format = format_.load();
+    const auto now = std::chrono::system_clock::now();
+    const std::string header = buildHeader(*format, caller, level, now);
+    const bool useColors = shouldUseColors(*format);
+
+    {
+      std::lock_guard<std::mutex> lock(logMutex_);
+      writeOutput(*format, level, header, message, useColors, now);
+    }
 
-    // Create log header
-    std::ostringstream header;
-    if (!appPrefix_.empty()) {
-      header << "[" << appPrefix_ << "]";
+    const auto sinks = sinks_.load();
+    if (!sinks->empty()) {
+      const std::string line = header + message;
+      const nixoncpp::logging::LogRecord record{.level = level, .timestamp = now, .line = line};
+      for (const auto &sink : *sinks) {
+        sink->write(record);
+      }
     }
-    header << "[" << std::put_time(&now_tm, "%Y-%m-%d %H:%M:%S") << "]";
-    header << "[" << levelToString(level) << "]";
-    if (!caller.empty()) {
-      header << "[" << caller << "]";
+  };
+
+  /**
+   * @brief Register an additional log destination
+   *
+   * @param sink
+   */
+  void addSink(std::shared_ptr<nixoncpp::logging::ILogSink> sink) {
+    if (!sink) {
+      return;
     }
-    header << " ";
+    sinks_.update([&sink](auto &sinks) { sinks.push_back(std::move(sink)); });
+  }
+
+  /**
+   * @brief Remove all registered sinks
+   *
+   */
+  void clearSinks() {
+    sinks_.store({});
+  }
 
+private:
+  /**
+   * @brief Write a formatted message to the console and the log file; caller holds logMutex_
+   *
+   * @param format
+   * @param level
+   * @param header
+   * @param message
+   * @param useColors
+   * @param now Timestamp of the record, for the sidecar index
+   */
+  void writeOutput(const Format &format, nixoncpp::logging::Level level, const std::string &header,
+                   const std::string &message, bool useColors,
+                   std::chrono::system_clock::time_point now) {
     // Log to console
-    if (shouldUseColors()) {
+    if (useColors) {
       setConsoleColor(level);
     }
-    std::cout << header.str() << message;
-    if (addNewLine_) {
+    std::cout << header << message;
+    if (format.addNewLine) {
       std::cout << "\n";
     }
 
-    if (shouldUseColors()) {
+    if (useColors) {
       resetConsoleColor();
     }
 
     // Log to file if enabled
     if (logFile_.is_open()) {
-      logFile_ << header.str() << message;
-      if (addNewLine_) {
+      logFile_ << header << message;
+      if (format.addNewLine) {
         logFile_ << "\n";
       }
       logFile_.flush(); // Force immediate write to disk
+
+      const std::uint64_t length = header.size() + message.size() + (format.addNewLine ? 1 : 0);
+      if (logIndex_) {
+        const auto timestampNs =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
+        logIndex_->append(level, timestampNs, logFileOffset_, length);
+      }
+      logFileOffset_ += length;
     }
-  };
+  }
+
+public:
 
   void setLevel(nixoncpp::logging::Level level) override {
-    std::lock_guard<std::mutex> lock(logMutex_);
-    currentLevel_ = level;
+    currentLevel_.store(level, std::memory_order_relaxed);
   };
 
   [[nodiscard]]
   nixoncpp::logging::Level getLevel() const override {
-    return currentLevel_;
+    return currentLevel_.load(std::memory_order_relaxed);
   };
 
   void setAppPrefix(const std::string &prefix) override {
-    std::lock_guard<std::mutex> lock(logMutex_);
-    appPrefix_ = prefix;
+    format_.update([&prefix](Format &format) { format.appPrefix = prefix; });
   };
 
   [[nodiscard]]
   std::string getAppPrefix() const override {
-    return appPrefix_;
+    return format_.load()->appPrefix;
   };
 
   bool enableFileLogging(const std::string &filename) override {
     std::lock_guard<std::mutex> lock(logMutex_);
     try {
+      logIndex_.reset();
+      if (logFile_.is_open()) {
+        logFile_.close();
+      }
       logFile_.open(filename, std::ios::out | std::ios::app);
-      return logFile_.is_open();
+      if (!logFile_.is_open()) {
+        return false;
+      }
+      std::error_code ec;
+      const auto size = std::filesystem::file_size(filename, ec);
+      logFileOffset_ = ec ? 0 : size;
+      logFilePath_ = filename;
+      openLogIndex();
+      return true;
     } catch (const std::ios_base::failure &e) {
       std::cerr << "Failed to open log file: " << filename << " - " << e.what() << "\n";
       return false;
@@ -193,11 +277,31 @@ public:
 
   void disableFileLogging() override {
     std::lock_guard<std::mutex> lock(logMutex_);
+    logIndex_.reset();
     if (logFile_.is_open()) {
       logFile_.close();
     }
   };
 
+  /**
+   * @brief Maintain a time-indexed sidecar (<log>.idx) next to the log file
+   *
+   * Applies to the current log file and to files opened later by enableFileLogging().
+   *
+   * @param recordsPerBlock Log lines per index entry; 0 disables the index
+   * @return true if the index is active (or disabled on request), false if it cannot be opened
+   */
+  bool enableLogIndex(
+      std::uint32_t recordsPerBlock = nixoncpp::logging::LogIndexWriter::kDefaultRecordsPerBlock) {
+    std::lock_guard<std::mutex> lock(logMutex_);
+    logIndex_.reset();
+    logIndexRecordsPerBlock_ = recordsPerBlock;
+    if (recordsPerBlock == 0 || !logFile_.is_open()) {
+      return true;
+    }
+    return openLogIndex();
+  }
+
   /**
    * @brief Convert a logging level to its string representation
    *
@@ -276,55 +380,45 @@ public:
   }
 
 private:
-  std::string headerName_ = "NixonCppLib";
-  bool includeName_ = true;
-  bool includeTime_ = true;
-  bool includeCaller_ = true;
-  bool includeLevel_ = true;
-
-  /**
-   * @brief Log a message to a given stream with formatting
-   *
-   * @param stream
-   * @param level
-   * @param message
-   * @param caller
-   * @param now_tm
-   */
-  void logToStream(std::ostream &stream, nixoncpp::logging::Level level, const std::string &message,
-                   const std::string &caller, const std::tm &now_tm) {
-    setConsoleColor(level);
-    stream << buildHeader(now_tm, caller, level) << message;
-    resetConsoleColor();
-    if (addNewLine_) {
-      stream << "\n";
-    }
-    // Explicitly flush the stream to ensure immediate output
-    stream.flush();
-  }
-
   /**
    * @brief Build the log header string
    *
-   * @param now_tm
+   * @param format
    * @param caller
    * @param level
+   * @param now
    * @return std::string
    */
-  std::string buildHeader(const std::tm &now_tm, const std::string &caller,
-                          nixoncpp::logging::Level level) const {
+  static std::string buildHeader(const Format &format, const std::string &caller,
+                                 nixoncpp::logging::Level level,
+                                 std::chrono::system_clock::time_point now) {
     std::ostringstream header;
-    if (includeName_) {
-      header << "[" << headerName_ << "] ";
+    if (format.includeName && !format.headerName.empty()) {
+      header << "[" << format.headerName << "]";
     }
-    if (includeTime_) {
-      header << "[" << std::put_time(&now_tm, "%d-%m-%Y %H:%M:%S") << "] ";
+    if (format.includeName && !format.appPrefix.empty()) {
+      header << "[" << format.appPrefix << "]";
     }
-    if (includeCaller_ && !caller.empty()) {
-      header << "[" << caller << "] ";
+    if (format.includeTime) {
+      std::time_t now_c = std::chrono::system_clock::to_time_t(now);
+      std::tm now_tm;
+
+      // Windows and POSIX have different thread-safe localtime functions
+#ifdef _WIN32
+      localtime_s(&now_tm, &now_c);
+#else
+      localtime_r(&now_c, &now_tm);
+#endif
+      header << "[" << std::put_time(&now_tm, "%Y-%m-%d %H:%M:%S") << "]";
     }
-    if (includeLevel_) {
-      header << "[" << levelToString(level) << "] ";
+    if (format.includeLevel) {
+      header << "[" << levelToString(level) << "]";
+    }
+    if (format.includeCaller && !caller.empty()) {
+      header << "[" << caller << "]";
+    }
+    if (header.tellp() > 0) {
+      header << " ";
     }
     return header.str();
   }
@@ -333,21 +427,19 @@ public:
   /**
    * @brief Set the Header Name object
    *
-   * @param headerName
+   * @param headerName Shown before the app prefix; empty (the default) shows nothing
    */
   void setHeaderName(const std::string &headerName) {
-    std::lock_guard<std::mutex> lock(logMutex_);
-    headerName_ = headerName;
+    format_.update([&headerName](Format &format) { format.headerName = headerName; });
   }
 
   /**
-   * @brief Show or hide the header name in the log output
+   * @brief Show or hide the header name and app prefix in the log output
    *
-   * @param includeName Whether to include the header name
+   * @param includeName Whether to include the header name and app prefix
    */
   void showHeaderName(bool includeName) {
-    std::lock_guard<std::mutex> lock(logMutex_);
-    includeName_ = includeName;
+    format_.update([&includeName](Format &format) { format.includeName = includeName; });
   }
 
   /**
@@ -356,8 +448,7 @@ public:
    * @param includeTime Whether to include the header time
    */
   void showHeaderTime(bool includeTime) {
-    std::lock_guard<std::mutex> lock(logMutex_);
-    includeTime_ = includeTime;
+    format_.update([&includeTime](Format &format) { format.includeTime = includeTime; });
   }
 
   /**
@@ -366,8 +457,7 @@ public:
    * @param includeCaller Whether to include the header caller
    */
   void showHeaderCaller(bool includeCaller) {
-    std::lock_guard<std::mutex> lock(logMutex_);
-    includeCaller_ = includeCaller;
+    format_.update([&includeCaller](Format &format) { format.includeCaller = includeCaller; });
   }
 
   /**
@@ -376,8 +466,7 @@ public:
    * @param includeLevel Whether to include the header level
    */
   void showHeaderLevel(bool includeLevel) {
-    std::lock_guard<std::mutex> lock(logMutex_);
-    includeLevel_ = includeLevel;
+    format_.update([&includeLevel](Format &format) { format.includeLevel = includeLevel; });
   }
 
   /**
@@ -420,9 +509,10 @@ public:
    * @param enabled Whether to use colored output (overrides auto-detection)
    */
   void setColorEnabled(bool enabled) {
-    std::lock_guard<std::mutex> lock(logMutex_);
-    colorEnabled_ = enabled;
-    autoDetectColor_ = false; // Manual override disables auto-detection
+    format_.update([enabled](Format &format) {
+      format.colorEnabled = enabled;
+      format.autoDetectColor = false; // Manual override disables auto-detection
+    });
   }
 
   /**
@@ -431,25 +521,53 @@ public:
    * @param autoDetect Whether to auto-detect color support
    */
   void setAutoDetectColor(bool autoDetect) {
-    std::lock_guard<std::mutex> lock(logMutex_);
-    autoDetectColor_ = autoDetect;
+    format_.update([autoDetect](Format &format) { format.autoDetectColor = autoDetect; });
+  }
+
+  /**
+   * @brief Get the current formatting configuration
+   *
+   * @return std::shared_ptr<const Format> Immutable snapshot, safe to keep across threads
+   */
+  [[nodiscard]]
+  std::shared_ptr<const Format> getFormat() const {
+    return format_.load();
   }
 
 private:
+  /**
+   * @brief Open the sidecar index for the current log file; caller holds logMutex_
+   *
+   * @return true if the index is open or not requested
+   */
+  bool openLogIndex() {
+    if (logIndexRecordsPerBlock_ == 0) {
+      return true;
+    }
+    auto index = nixoncpp::logging::LogIndexWriter::open(logFilePath_, logIndexRecordsPerBlock_);
+    if (!index) {
+      std::cerr << "Failed to open log index: " << index.error().toString() << "\n";
+      return false;
+    }
+    logIndex_ = std::move(index.value());
+    return true;
+  }
+
   /**
    * @brief Check if colors should be used for console output
    *
+   * @param format
    * @return true if colors should be used, false otherwise
    */
-  bool shouldUseColors() const {
-    if (!autoDetectColor_) {
-      return colorEnabled_;
+  static bool shouldUseColors(const Format &format) {
+    if (!format.autoDetectColor) {
+      return format.colorEnabled;
     }
     // Auto-detect: check if stdout is a TTY
 #ifdef __EMSCRIPTEN__
     return false; // No color support in Emscripten
 #else
-    return colorEnabled_ && (isatty(fileno(stdout)) != 0);
+    return format.colorEnabled && (isatty(fileno(stdout)) != 0);
 #endif
   }
 }; // class ConsoleLogger
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "ILogger.hpp"
+#include <chrono>
+#include <string_view>
+
+namespace nixoncpp::logging {
+
+  /**
+   * @brief A single formatted log record handed to sinks
+   *
+   * The line view is only valid for the duration of the ILogSink::write() call.
+   */
+  struct LogRecord {
+    Level level;
+    std::chrono::system_clock::time_point timestamp;
+    std::string_view line; // Header and message, without trailing newline
+  };
+
+  /**
+   * @brief Interface for additional log destinations
+   *
+   * Sinks are invoked outside of the logger's output lock and must be thread-safe.
+   */
+  class ILogSink {
+  public:
+    virtual ~ILogSink() = default;
+
+    /**
+     * @brief Write a record to the sink
+     *
+     * @param record
+     */
+    virtual void write(const LogRecord &record) = 0;
+
+    /**
+     * @brief Flush any buffered records
+     *
+     */
+    virtual void flush() {}
+  };
+
+} // namespace nixoncpp::logging
@@ -0,0 +1,468 @@
+#include "LogIndex.hpp"
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <fmt/core.h>
+#include <limits>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__) || defined(__APPLE__)
+#define NIXONCPP_HAS_PREAD 1
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace nixoncpp::logging {
+
+  namespace {
+    constexpr std::array<char, 8> kIndexMagic = {'N', 'X', 'L', 'O', 'G', 'I', 'X', '1'};
+
+    /**
+     * @brief Positioned reads from the log file; one descriptor per query
+     */
+    class BlockReader {
+    public:
+      explicit BlockReader(const std::filesystem::path &path) {
+#if defined(NIXONCPP_HAS_PREAD)
+        fd_ = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+#else
+        stream_.open(path, std::ios::binary);
+#endif
+      }
+
+      ~BlockReader() {
+#if defined(NIXONCPP_HAS_PREAD)
+        if (fd_ >= 0) {
+          ::close(fd_);
+        }
+#endif
+      }
+
+      BlockReader(const BlockReader &) = delete;
+      BlockReader &operator=(const BlockReader &) = delete;
+      BlockReader(BlockReader &&) = delete;
+      BlockReader &operator=(BlockReader &&) = delete;
+
+      [[nodiscard]]
+      bool isOpen() const {
+#if defined(NIXONCPP_HAS_PREAD)
+        return fd_ >= 0;
+#else
+        return stream_.is_open();
+#endif
+      }
+
+      /**
+       * @brief Read up to length bytes at offset into buffer
+       *
+       * @return false on I/O error; a short read at end of file is not an error
+       */
+      bool read(std::uint64_t offset, std::uint64_t length, std::string &buffer) {
+        buffer.resize(static_cast<std::size_t>(length));
+#if defined(NIXONCPP_HAS_PREAD)
+        std::size_t done = 0;
+        while (done < buffer.size()) {
+          const auto got = ::pread(fd_, buffer.data() + done, buffer.size() - done,
+                                   static_cast<off_t>(offset + done));
+          if (got < 0) {
+            if (errno == EINTR) {
+              continue;
+            }
+            return false;
+          }
+          if (got == 0) {
+            break;
+          }
+          done += static_cast<std::size_t>(got);
+        }
+        buffer.resize(done);
+        return true;
+#else
+        stream_.clear();
+        stream_.seekg(static_cast<std::streamoff>(offset));
+        stream_.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.resize(static_cast<std::size_t>(stream_.gcount()));
+        return !stream_.bad();
+#endif
+      }
+
+    private:
+#if defined(NIXONCPP_HAS_PREAD)
+      int fd_ = -1;
+#else
+      std::ifstream stream_;
+#endif
+    };
+
+    constexpr std::int64_t kNsPerSecond = 1'000'000'000;
+    constexpr std::uint64_t kUnindexedChunkSize = 1U << 20;
+
+    /**
+     * @brief Per-line level and time check, based on the header ConsoleLogger writes
+     *
+     * Looks at the leading "[...]" fields of a line for a level tag (DBG, INF, ...) and a local
+     * "YYYY-mm-dd HH:MM:SS" timestamp. A line is rejected only by a field that is present, so
+     * lines logged without a header pass whenever they are read at all.
+     */
+    class LineFilter {
+    public:
+      LineFilter(std::uint32_t levelMask, std::int64_t fromNs, std::int64_t toNs)
+          : levelMask_(levelMask), fromNs_(fromNs), toNs_(toNs),
+            checkTime_(fromNs != std::numeric_limits<std::int64_t>::min() ||
+                       toNs != std::numeric_limits<std::int64_t>::max()) {}
+
+      [[nodiscard]]
+      bool accepts(std::string_view line) {
+        bool levelSeen = false;
+        bool timeSeen = false;
+        std::size_t pos = 0;
+        while (pos < line.size() && line[pos] == '[') {
+          const auto close = line.find(']', pos + 1);
+          if (close == std::string_view::npos) {
+            break;
+          }
+          const auto field = line.substr(pos + 1, close - pos - 1);
+          pos = close + 1;
+          if (!levelSeen) {
+            if (const auto bit = levelBitOf(field); bit != 0) {
+              levelSeen = true;
+              if ((bit & levelMask_) == 0) {
+                return false;
+              }
+              continue;
+            }
+          }
+          if (checkTime_ && !timeSeen) {
+            if (const auto second = secondOf(field)) {
+              timeSeen = true;
+              // The line was logged somewhere within that second
+              if (*second > toNs_ || *second + kNsPerSecond <= fromNs_) {
+                return false;
+              }
+            }
+          }
+        }
+        return true;
+      }
+
+    private:
+      static std::uint32_t levelBitOf(std::string_view field) {
+        static constexpr std::array<std::pair<std::string_view, Level>, 5> kTags = {{
+            {"DBG", Level::LOG_DEBUG},
+            {"INF", Level::LOG_INFO},
+            {"WRN", Level::LOG_WARNING},
+            {"ERR", Level::LOG_ERROR},
+            {"CRI", Level::LOG_CRITICAL},
+        }};
+        for (const auto &[tag, level] : kTags) {
+          if (field == tag) {
+            return levelBit(level);
+          }
+        }
+        return 0;
+      }
+
+      // Nanoseconds since the epoch of a local "YYYY-mm-dd HH:MM:SS" field
+      std::optional<std::int64_t> secondOf(std::string_view field) {
+        static constexpr std::string_view kShape = "dddd-dd-dd dd:dd:dd";
+        if (field.size() != kShape.size()) {
+          return std::nullopt;
+        }
+        if (field == lastField_) {
+          return lastSecond_;
+        }
+        for (std::size_t i = 0; i < kShape.size(); ++i) {
+          const bool digit = field[i] >= '0' && field[i] <= '9';
+          if (kShape[i] == 'd' ? !digit : field[i] != kShape[i]) {
+            return std::nullopt;
+          }
+        }
+        const auto number = [field](std::size_t at, std::size_t digits) {
+          int value = 0;
+          for (std::size_t i = at; i < at + digits; ++i) {
+            value = (value * 10) + (field[i] - '0');
+          }
+          return value;
+        };
+        std::tm tm{};
+        tm.tm_year = number(0, 4) - 1900;
+        tm.tm_mon = number(5, 2) - 1;
+        tm.tm_mday = number(8, 2);
+        tm.tm_hour = number(11, 2);
+        tm.tm_min = number(14, 2);
+        tm.tm_sec = number(17, 2);
+        tm.tm_isdst = -1;
+        const auto seconds = std::mktime(&tm);
+        if (seconds == static_cast<std::time_t>(-1)) {
+          return std::nullopt;
+        }
+        lastField_.assign(field);
+        lastSecond_ = static_cast<std::int64_t>(seconds) * kNsPerSecond;
+        return lastSecond_;
+      }
+
+      std::uint32_t levelMask_;
+      std::int64_t fromNs_;
+      std::int64_t toNs_;
+      bool checkTime_;
+      std::string lastField_; // Consecutive lines mostly share their second
+      std::int64_t lastSecond_ = 0;
+    };
+
+    /**
+     * @brief Split text into lines and deliver them
+     *
+     * @param text
+     * @param filter Null to deliver every line
+     * @param callback
+     * @return std::size_t Lines delivered
+     */
+    std::size_t deliverLines(std::string_view text, LineFilter *filter,
+                             const LogIndexReader::LineCallback &callback) {
+      std::size_t lines = 0;
+      while (!text.empty()) {
+        const auto end = text.find('\n');
+        auto line = text.substr(0, end);
+        if (!line.empty() && line.back() == '\r') {
+          line.remove_suffix(1);
+        }
+        if (filter == nullptr || filter->accepts(line)) {
+          callback(line);
+          ++lines;
+        }
+        if (end == std::string_view::npos) {
+          break;
+        }
+        text.remove_prefix(end + 1);
+      }
+      return lines;
+    }
+  } // namespace
+
+  // ============================================================================
+  // LogIndexWriter
+  // ============================================================================
+
+  LogIndexWriter::LogIndexWriter(std::ofstream index, std::uint32_t recordsPerBlock)
+      : index_(std::move(index)), recordsPerBlock_(std::max<std::uint32_t>(recordsPerBlock, 1)) {}
+
+  LogIndexWriter::~LogIndexWriter() { finishBlock(); }
+
+  std::filesystem::path LogIndexWriter::indexPathFor(const std::filesystem::path &logPath) {
+    auto indexPath = logPath;
+    indexPath += ".idx";
+    return indexPath;
+  }
+
+  utils::Result<std::unique_ptr<LogIndexWriter>, utils::FileError>
+      LogIndexWriter::open(const std::filesystem::path &logPath, std::uint32_t recordsPerBlock) {
+    const auto indexPath = indexPathFor(logPath);
+    std::error_code ec;
+    const auto existingSize = std::filesystem::exists(indexPath, ec)
+                                  ? std::filesystem::file_size(indexPath, ec)
+                                  : std::uintmax_t{0};
+
+    if (existingSize > 0) {
+      std::ifstream existing(indexPath, std::ios::binary);
+      std::array<char, kIndexMagic.size()> magic{};
+      existing.read(magic.data(), magic.size());
+      if (!existing || magic != kIndexMagic) {
+        return utils::FileError{
+            .code = utils::FileErrorCode::ReadError,
+            .message = "Existing file is not a log index",
+            .path = indexPath.string(),
+        };
+      }
+      const auto tornBytes = (existingSize - kIndexMagic.size()) % sizeof(LogIndexEntry);
+      if (tornBytes != 0) {
+        // Drop a torn trailing entry so new entries stay aligned
+        std::filesystem::resize_file(indexPath, existingSize - tornBytes, ec);
+        if (ec) {
+          return utils::FileError{
+              .code = utils::FileErrorCode::WriteError,
+              .message = fmt::format("Failed to repair log index: {}", ec.message()),
+              .path = indexPath.string(),
+          };
+        }
+      }
+    }
+
+    std::ofstream index(indexPath, std::ios::binary | std::ios::app);
+    if (!index.is_open()) {
+      return utils::FileError{
+          .code = utils::FileErrorCode::WriteError,
+          .message = "Failed to open log index for writing",
+          .path = indexPath.string(),
+      };
+    }
+    if (existingSize == 0) {
+      index.write(kIndexMagic.data(), kIndexMagic.size());
+      index.flush();
+    }
+
+    return std::unique_ptr<LogIndexWriter>(new LogIndexWriter(std::move(index), recordsPerBlock));
+  }
+
+  void LogIndexWriter::append(Level level, std::int64_t timestampNs, std::uint64_t offset,
+                              std::uint64_t length) {
+    if (current_.recordCount == 0) {
+      current_.minTimestampNs = timestampNs;
+      current_.maxTimestampNs = timestampNs;
+      current_.offset = offset;
+    } else {
+      // Timestamps are taken before the output lock, so neighbours may be slightly out of order
+      current_.minTimestampNs = std::min(current_.minTimestampNs, timestampNs);
+      current_.maxTimestampNs = std::max(current_.maxTimestampNs, timestampNs);
+    }
+    current_.length = offset + length - current_.offset;
+    current_.levelMask |= levelBit(level);
+    if (++current_.recordCount >= recordsPerBlock_) {
+      finishBlock();
+    }
+  }
+
+  void LogIndexWriter::finishBlock() {
+    if (current_.recordCount == 0) {
+      return;
+    }
+    index_.write(reinterpret_cast<const char *>(&current_), sizeof(current_));
+    index_.flush();
+    current_ = LogIndexEntry{};
+  }
+
+  // ============================================================================
+  // LogIndexReader
+  // ============================================================================
+
+  utils::Result<LogQueryStats, utils::FileError>
+      LogIndexReader::query(const std::filesystem::path &logPath, const LogQuery &query,
+                            const LineCallback &callback) {
+    const auto indexPath = LogIndexWriter::indexPathFor(logPath);
+    std::ifstream index(indexPath, std::ios::binary);
+    if (!index.is_open()) {
+      return utils::FileError{
+          .code = utils::FileErrorCode::NotFound,
+          .message = "Log index not found",
+          .path = indexPath.string(),
+      };
+    }
+    std::array<char, kIndexMagic.size()> magic{};
+    index.read(magic.data(), magic.size());
+    if (!index || magic != kIndexMagic) {
+      return utils::FileError{
+          .code = utils::FileErrorCode::ReadError,
+          .message = "File is not a log index",
+          .path = indexPath.string(),
+      };
+    }
+
+    std::vector<LogIndexEntry> entries;
+    LogIndexEntry entry{};
+    while (index.read(reinterpret_cast<char *>(&entry), sizeof(entry))) {
+      entries.push_back(entry);
+    }
+
+    BlockReader reader(logPath);
+    if (!reader.isOpen()) {
+      return utils::FileError{
+          .code = utils::FileErrorCode::NotFound,
+          .message = "Log file not found",
+          .path = logPath.string(),
+      };
+    }
+
+    const auto toNs = [](std::chrono::system_clock::time_point point) {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(point.time_since_epoch()).count();
+    };
+    const auto fromNs = query.from == std::chrono::system_clock::time_point::min()
+                            ? std::numeric_limits<std::int64_t>::min()
+                            : toNs(query.from);
+    const auto toNsValue = query.to == std::chrono::system_clock::time_point::max()
+                               ? std::numeric_limits<std::int64_t>::max()
+                               : toNs(query.to);
+
+    LogQueryStats stats;
+    stats.blocksTotal = entries.size();
+    std::string buffer;
+    LineFilter filter(query.levelMask, fromNs, toNsValue);
+
+    const auto readBlock = [&](const LogIndexEntry &block) {
+      if (!reader.read(block.offset, block.length, buffer)) {
+        return false;
+      }
+      ++stats.blocksRead;
+      stats.bytesRead += buffer.size();
+      // A block entirely inside the query needs no per-line check
+      const bool covered = (block.levelMask & ~query.levelMask) == 0 &&
+                           block.minTimestampNs >= fromNs && block.maxTimestampNs <= toNsValue;
+      stats.lines += deliverLines(buffer, covered ? nullptr : &filter, callback);
+      return true;
+    };
+
+    // Bytes no block describes, such as lines written before the index was enabled or after
+    // the last complete block; read in bounded chunks that end on a line boundary
+    const auto readUnindexed = [&](std::uint64_t offset, std::uint64_t end) {
+      while (offset < end) {
+        if (!reader.read(offset, std::min(end - offset, kUnindexedChunkSize), buffer)) {
+          return false;
+        }
+        if (buffer.empty()) {
+          break;
+        }
+        std::string_view text(buffer);
+        if (offset + text.size() < end) {
+          if (const auto lastNewline = text.rfind('\n'); lastNewline != std::string_view::npos) {
+            text = text.substr(0, lastNewline + 1);
+          }
+        }
+        offset += text.size();
+        stats.bytesRead += text.size();
+        stats.unindexedBytes += text.size();
+        stats.lines += deliverLines(text, &filter, callback);
+      }
+      return true;
+    };
+    const auto unindexedError = [&logPath](std::uint64_t offset) {
+      return utils::FileError{
+          .code = utils::FileErrorCode::ReadError,
+          .message = fmt::format("Failed to read unindexed log data at offset {}", offset),
+          .path = logPath.string(),
+      };
+    };
+
+    std::sort(entries.begin(), entries.end(),
+              [](const LogIndexEntry &a, const LogIndexEntry &b) { return a.offset < b.offset; });
+    std::uint64_t indexedEnd = 0;
+    for (const auto &block : entries) {
+      if (block.offset > indexedEnd && !readUnindexed(indexedEnd, block.offset)) {
+        return unindexedError(indexedEnd);
+      }
+      indexedEnd = std::max(indexedEnd, block.offset + block.length);
+      const bool overlaps = block.maxTimestampNs >= fromNs && block.minTimestampNs <= toNsValue;
+      if (!overlaps || (block.levelMask & query.levelMask) == 0) {
+        continue;
+      }
+      if (!readBlock(block)) {
+        return utils::FileError{
+            .code = utils::FileErrorCode::ReadError,
+            .message = fmt::format("Failed to read log block at offset {}", block.offset),
+            .path = logPath.string(),
+        };
+      }
+    }
+
+    std::error_code ec;
+    const auto logSize = std::filesystem::file_size(logPath, ec);
+    if (!ec && logSize > indexedEnd && !readUnindexed(indexedEnd, logSize)) {
+      return unindexedError(indexedEnd);
+    }
+
+    return stats;
+  }
+
+} // namespace nixoncpp::logging
@@ -0,0 +1,153 @@
+#pragma once
+
+#include "ILogger.hpp"
+#include <Utils/UtilsError.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string_view>
+
+namespace nixoncpp::logging {
+
+  /**
+   * @brief Bit of a level inside LogIndexEntry::levelMask and LogQuery::levelMask
+   *
+   * @param level
+   * @return constexpr std::uint32_t
+   */
+  constexpr std::uint32_t levelBit(Level level) noexcept {
+    return 1U << static_cast<std::uint32_t>(level);
+  }
+
+  constexpr std::uint32_t kAllLevels = 0x1FU;
+
+  /**
+   * @brief One fixed-size sidecar record describing a contiguous block of log lines
+   */
+  struct LogIndexEntry {
+    std::int64_t minTimestampNs; // system_clock since epoch
+    std::int64_t maxTimestampNs;
+    std::uint64_t offset; // Byte offset of the first line in the log file
+    std::uint64_t length; // Bytes covered by the block
+    std::uint32_t recordCount;
+    std::uint32_t levelMask; // levelBit() of every level present in the block
+  };
+
+  static_assert(sizeof(LogIndexEntry) == 40, "LogIndexEntry is a stable on-disk format");
+
+  /**
+   * @brief Appends a sidecar index (<log>.idx) while a log file is written
+   *
+   * Every recordsPerBlock log lines one LogIndexEntry is appended. The partially filled
+   * block is written when the writer is destroyed. Not thread-safe; the owning logger
+   * serializes calls together with its file output.
+   */
+  class LogIndexWriter final {
+  public:
+    static constexpr std::uint32_t kDefaultRecordsPerBlock = 256;
+
+    LogIndexWriter(const LogIndexWriter &) = delete;
+    LogIndexWriter &operator=(const LogIndexWriter &) = delete;
+    LogIndexWriter(LogIndexWriter &&) = delete;
+    LogIndexWriter &operator=(LogIndexWriter &&) = delete;
+    ~LogIndexWriter();
+
+    /**
+     * @brief Open or create the index for a log file; existing entries are kept
+     *
+     * @param logPath Path of the log file being indexed
+     * @param recordsPerBlock Log lines per index entry
+     * @return Result<std::unique_ptr<LogIndexWriter>, utils::FileError>
+     */
+    [[nodiscard]]
+    static utils::Result<std::unique_ptr<LogIndexWriter>, utils::FileError>
+        open(const std::filesystem::path &logPath,
+             std::uint32_t recordsPerBlock = kDefaultRecordsPerBlock);
+
+    /**
+     * @brief Sidecar path belonging to a log file
+     *
+     * @param logPath
+     * @return std::filesystem::path
+     */
+    [[nodiscard]]
+    static std::filesystem::path indexPathFor(const std::filesystem::path &logPath);
+
+    /**
+     * @brief Account for one line written to the log file
+     *
+     * @param level
+     * @param timestampNs
+     * @param offset Byte offset of the line in the log file
+     * @param length Bytes written including the newline
+     */
+    void append(Level level, std::int64_t timestampNs, std::uint64_t offset, std::uint64_t length);
+
+    /**
+     * @brief Write the partially filled block, if any
+     *
+     */
+    void finishBlock();
+
+  private:
+    LogIndexWriter(std::ofstream index, std::uint32_t recordsPerBlock);
+
+    std::ofstream index_;
+    std::uint32_t recordsPerBlock_;
+    LogIndexEntry current_{};
+  };
+
+  /**
+   * @brief Time window and levels to look for
+   */
+  struct LogQuery {
+    std::chrono::system_clock::time_point from = std::chrono::system_clock::time_point::min();
+    std::chrono::system_clock::time_point to = std::chrono::system_clock::time_point::max();
+    std::uint32_t levelMask = kAllLevels;
+  };
+
+  /**
+   * @brief Work done by a query
+   */
+  struct LogQueryStats {
+    std::size_t blocksTotal = 0;      // Index entries
+    std::size_t blocksRead = 0;       // Index entries whose bytes were read
+    std::uint64_t bytesRead = 0;      // Everything read, unindexedBytes included
+    std::uint64_t unindexedBytes = 0; // Bytes no index entry describes, always read
+    std::size_t lines = 0;
+  };
+
+  /**
+   * @brief Answers time/level queries against a log file using its sidecar index
+   */
+  class LogIndexReader final {
+  public:
+    using LineCallback = std::function<void(std::string_view line)>;
+
+    /**
+     * @brief Deliver the lines matching the query
+     *
+     * Only blocks whose time range overlaps [from, to] and which contain at least one of the
+     * requested levels are read, each with a single positioned read. Lines of a block that is
+     * not entirely inside the query are checked one by one against the level tag and local
+     * timestamp of their ConsoleLogger header. Bytes no block describes (written before the
+     * index was enabled, or after the last complete block, e.g. after a crash) are read in
+     * full and checked the same way. Lines without a header cannot be checked and are
+     * delivered whenever they are read.
+     *
+     * @param logPath
+     * @param query
+     * @param callback Receives each line without its newline
+     * @return Result<LogQueryStats, utils::FileError>
+     */
+    [[nodiscard]]
+    static utils::Result<LogQueryStats, utils::FileError>
+        query(const std::filesystem::path &logPath, const LogQuery &query,
+              const LineCallback &callback);
+  };
+
+} // namespace nixoncpp::logging
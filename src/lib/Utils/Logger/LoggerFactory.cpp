@@ -1,6 +1,8 @@
 #include "LoggerFactory.hpp"
 #include "ConsoleLogger.hpp"
 #include "NullLogger.hpp"
+#include "ShmLogRing.hpp"
+#include "UnixSocketSink.hpp"
 
 namespace nixoncpp::logging {
 
@@ -21,10 +23,32 @@ namespace nixoncpp::logging {
       logger->setAppPrefix(config.appPrefix);
     }
 
+    if (config.logIndexInterval > 0) {
+      logger->enableLogIndex(config.logIndexInterval);
+    }
+
     if (config.enableFileLogging && !config.logFilePath.empty()) {
       logger->enableFileLogging(config.logFilePath);
     }
 
+    if (!config.sharedMemoryRing.empty()) {
+      auto ring = ShmLogRing::open(config.sharedMemoryRing);
+      if (ring) {
+        logger->addSink(std::move(ring.value()));
+      } else {
+        logger->warning("Shared-memory log ring unavailable: " + ring.error().toString());
+      }
+    }
+
+    if (!config.logSocketPath.empty()) {
+      auto socketSink = UnixSocketSink::open(config.logSocketPath);
+      if (socketSink) {
+        logger->addSink(std::move(socketSink.value()));
+      } else {
+        logger->warning("Log socket unavailable: " + socketSink.error().toString());
+      }
+    }
+
     return logger;
   }
 
@@ -16,6 +16,9 @@ namespace nixoncpp::logging {
     std::string logFilePath;
     bool colorOutput = true;
     std::string appPrefix;
+    std::string sharedMemoryRing;       // Also write records into this shared-memory ring (POSIX)
+    std::string logSocketPath;          // Also send records to this Unix datagram socket (POSIX)
+    std::uint32_t logIndexInterval = 0; // Write <logFilePath>.idx every N records (0 = off)
   };
 
   class LoggerFactory {
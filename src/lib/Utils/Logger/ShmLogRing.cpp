@@ -0,0 +1,376 @@
+#include "ShmLogRing.hpp"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fmt/core.h>
+#include <thread>
+
+#if defined(__linux__) || defined(__APPLE__)
+#define NIXONCPP_HAS_SHM_LOG_RING 1
+#include <csignal>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace nixoncpp::logging {
+
+  namespace {
+    constexpr std::uint64_t kMagic = 0x4E49584F4E524E47ULL; // "NIXONRNG"
+    constexpr std::uint32_t kVersion = 2;
+    constexpr std::uint32_t kStateReady = 2;
+    constexpr std::uint32_t kMinSlotCount = 16;
+    constexpr std::uint32_t kMinSlotSize = 128;
+    constexpr std::uint32_t kSlotAlignment = 64;
+    constexpr std::uint64_t kWritingBit = 1;
+    constexpr std::int64_t kPendingTimeoutNs = 1'000'000'000;
+    constexpr std::int64_t kPeerCheckDelayNs = 50'000'000;
+    constexpr auto kAttachTimeout = std::chrono::seconds(1);
+
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+                  "Shared-memory ring requires lock-free 64-bit atomics");
+    static_assert(std::atomic<std::uint32_t>::is_always_lock_free,
+                  "Shared-memory ring requires lock-free 32-bit atomics");
+
+    std::int64_t nowNs() {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                 std::chrono::steady_clock::now().time_since_epoch())
+          .count();
+    }
+
+    // Slot state encodes the sequence it holds: (sequence + 1) << 1, low bit set while writing
+    constexpr std::uint64_t tagFor(std::uint64_t sequence) { return (sequence + 1) << 1; }
+  } // namespace
+
+  namespace detail {
+    struct ShmRingHeader {
+      std::atomic<std::uint32_t> state;
+      std::uint32_t version;
+      std::uint64_t magic;
+      std::uint32_t slotCount;
+      std::uint32_t slotSize;
+      alignas(64) std::atomic<std::uint64_t> head; // Next sequence to reserve
+      alignas(64) std::atomic<std::uint64_t> tail; // Next sequence the collector expects
+      std::atomic<std::uint64_t> lost;
+    };
+
+    struct ShmRingSlot {
+      std::atomic<std::uint64_t> state;
+      std::atomic<std::uint64_t> skipped; // Tag of a sequence whose writer gave up on the slot
+      std::atomic<std::int64_t> timestampNs;
+      std::atomic<std::int32_t> pid;
+      std::atomic<std::uint32_t> length;
+      std::atomic<std::uint8_t> level;
+      std::atomic<std::uint8_t> truncated;
+      // Payload follows the slot header
+    };
+  } // namespace detail
+
+  namespace {
+    constexpr std::size_t kHeaderSize =
+        (sizeof(detail::ShmRingHeader) + kSlotAlignment - 1) / kSlotAlignment * kSlotAlignment;
+    constexpr std::size_t kSlotHeaderSize = sizeof(detail::ShmRingSlot);
+
+    std::size_t mappingSizeFor(std::uint32_t slotCount, std::uint32_t slotSize) {
+      return kHeaderSize + (static_cast<std::size_t>(slotCount) * slotSize);
+    }
+
+    std::string normalizeName(const std::string &name) {
+      return name.starts_with('/') ? name : "/" + name;
+    }
+
+    std::int32_t currentPid() {
+#if defined(NIXONCPP_HAS_SHM_LOG_RING)
+      return static_cast<std::int32_t>(::getpid());
+#else
+      return 0;
+#endif
+    }
+  } // namespace
+
+  ShmLogRing::ShmLogRing(void *mapping, std::size_t mappingSize)
+      : mapping_(mapping), mappingSize_(mappingSize), header_(static_cast<Header *>(mapping)),
+        pid_(currentPid()) {}
+
+  ShmLogRing::~ShmLogRing() {
+#if defined(NIXONCPP_HAS_SHM_LOG_RING)
+    ::munmap(mapping_, mappingSize_);
+#endif
+  }
+
+  utils::Result<std::shared_ptr<ShmLogRing>, utils::FileError>
+      ShmLogRing::open(const std::string &name, const ShmLogRingConfig &config) {
+    if (name.empty() || name == "/") {
+      return utils::FileError{
+          .code = utils::FileErrorCode::InvalidPath,
+          .message = "Empty shared memory name",
+          .path = "",
+      };
+    }
+
+#if defined(NIXONCPP_HAS_SHM_LOG_RING)
+    const std::string shmName = normalizeName(name);
+    auto openError = [&shmName](const char *what) {
+      const int err = errno;
+      return utils::FileError{
+          .code = err == EACCES ? utils::FileErrorCode::AccessDenied
+                                : utils::FileErrorCode::WriteError,
+          .message = fmt::format("{}: {}", what, std::strerror(err)),
+          .path = shmName,
+      };
+    };
+
+    // Creator path: exclusive create, size and initialize the header
+    int fd = ::shm_open(shmName.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd >= 0) {
+      const std::uint32_t slotCount = std::bit_ceil(std::max(config.slotCount, kMinSlotCount));
+      const std::uint32_t slotSize =
+          (std::max(config.slotSize, kMinSlotSize) + kSlotAlignment - 1) / kSlotAlignment *
+          kSlotAlignment;
+      const std::size_t size = mappingSizeFor(slotCount, slotSize);
+
+      if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        auto error = openError("Failed to size shared memory");
+        ::close(fd);
+        ::shm_unlink(shmName.c_str());
+        return error;
+      }
+      void *mapping = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+      ::close(fd);
+      if (mapping == MAP_FAILED) {
+        auto error = openError("Failed to map shared memory");
+        ::shm_unlink(shmName.c_str());
+        return error;
+      }
+
+      // Fresh shared memory is zero-filled, so all atomics start at zero
+      auto *header = static_cast<Header *>(mapping);
+      header->version = kVersion;
+      header->magic = kMagic;
+      header->slotCount = slotCount;
+      header->slotSize = slotSize;
+      header->state.store(kStateReady, std::memory_order_release);
+      return std::shared_ptr<ShmLogRing>(new ShmLogRing(mapping, size));
+    }
+    if (errno != EEXIST) {
+      return openError("Failed to create shared memory");
+    }
+
+    // Attach path: wait for the creator to publish the geometry, then map everything
+    fd = ::shm_open(shmName.c_str(), O_RDWR, 0600);
+    if (fd < 0) {
+      return openError("Failed to open shared memory");
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + kAttachTimeout;
+    struct stat st {};
+    while (::fstat(fd, &st) == 0 && static_cast<std::size_t>(st.st_size) < kHeaderSize) {
+      if (std::chrono::steady_clock::now() > deadline) {
+        ::close(fd);
+        return utils::FileError{
+            .code = utils::FileErrorCode::ReadError,
+            .message = "Shared memory ring was never initialized",
+            .path = shmName,
+        };
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    void *headerMapping = ::mmap(nullptr, kHeaderSize, PROT_READ, MAP_SHARED, fd, 0);
+    if (headerMapping == MAP_FAILED) {
+      auto error = openError("Failed to map shared memory header");
+      ::close(fd);
+      return error;
+    }
+    const auto *header = static_cast<const Header *>(headerMapping);
+    while (header->state.load(std::memory_order_acquire) != kStateReady &&
+           std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    const bool valid = header->state.load(std::memory_order_acquire) == kStateReady &&
+                       header->magic == kMagic && header->version == kVersion;
+    const std::size_t size = mappingSizeFor(header->slotCount, header->slotSize);
+    ::munmap(headerMapping, kHeaderSize);
+
+    if (!valid || static_cast<std::size_t>(st.st_size) < size) {
+      ::close(fd);
+      return utils::FileError{
+          .code = utils::FileErrorCode::ReadError,
+          .message = "Shared memory object is not a compatible log ring",
+          .path = shmName,
+      };
+    }
+
+    void *mapping = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+      return openError("Failed to map shared memory");
+    }
+    return std::shared_ptr<ShmLogRing>(new ShmLogRing(mapping, size));
+#else
+    return utils::FileError{
+        .code = utils::FileErrorCode::Unknown,
+        .message = "Shared memory log ring is not supported on this platform",
+        .path = name,
+    };
+#endif
+  }
+
+  bool ShmLogRing::remove(const std::string &name) {
+#if defined(NIXONCPP_HAS_SHM_LOG_RING)
+    return !name.empty() && ::shm_unlink(normalizeName(name).c_str()) == 0;
+#else
+    (void)name;
+    return false;
+#endif
+  }
+
+  ShmLogRing::Slot *ShmLogRing::slotAt(std::uint64_t sequence) const noexcept {
+    auto *base = static_cast<std::byte *>(mapping_) + kHeaderSize;
+    const auto index = sequence & (header_->slotCount - 1);
+    return reinterpret_cast<Slot *>(base + (index * header_->slotSize));
+  }
+
+  void ShmLogRing::write(const LogRecord &record) {
+    push(record.level,
+         std::chrono::duration_cast<std::chrono::nanoseconds>(record.timestamp.time_since_epoch())
+             .count(),
+         record.line);
+  }
+
+  void ShmLogRing::push(Level level, std::int64_t timestampNs, std::string_view line) noexcept {
+    const auto sequence = header_->head.fetch_add(1, std::memory_order_relaxed);
+    Slot *slot = slotAt(sequence);
+    const auto tag = tagFor(sequence);
+
+    // Claim the slot unless another writer is still filling it or a newer lap owns it. The
+    // collector counts the record as lost; the mark lets it move on without waiting for it.
+    auto current = slot->state.load(std::memory_order_relaxed);
+    do {
+      if ((current & kWritingBit) != 0 || current >= tag) {
+        slot->skipped.store(tag, std::memory_order_release);
+        return;
+      }
+    } while (!slot->state.compare_exchange_weak(current, tag | kWritingBit,
+                                                std::memory_order_acquire,
+                                                std::memory_order_relaxed));
+
+    const std::size_t length = std::min(line.size(), maxLineLength());
+    slot->pid.store(pid_, std::memory_order_relaxed);
+    slot->timestampNs.store(timestampNs, std::memory_order_relaxed);
+    slot->level.store(static_cast<std::uint8_t>(level), std::memory_order_relaxed);
+    slot->truncated.store(length < line.size() ? 1 : 0, std::memory_order_relaxed);
+    slot->length.store(static_cast<std::uint32_t>(length), std::memory_order_relaxed);
+    std::memcpy(reinterpret_cast<std::byte *>(slot) + kSlotHeaderSize, line.data(), length);
+
+    // Only commit if the collector has not given up on this write and released the slot
+    auto claimed = tag | kWritingBit;
+    slot->state.compare_exchange_strong(claimed, tag, std::memory_order_release,
+                                        std::memory_order_relaxed);
+  }
+
+  ShmDrainStats ShmLogRing::drain(const DrainCallback &callback, std::size_t maxRecords) {
+    ShmDrainStats stats;
+    std::string payload;
+    payload.reserve(maxLineLength());
+
+    auto tail = header_->tail.load(std::memory_order_relaxed);
+    while (maxRecords == 0 || stats.records < maxRecords) {
+      const auto head = header_->head.load(std::memory_order_acquire);
+      if (tail >= head) {
+        break;
+      }
+      if (head - tail > header_->slotCount) {
+        // Writers lapped the collector; everything older than one ring is gone
+        const auto oldest = head - header_->slotCount;
+        stats.lost += oldest - tail;
+        tail = oldest;
+        continue;
+      }
+
+      Slot *slot = slotAt(tail);
+      const auto tag = tagFor(tail);
+      const auto state = slot->state.load(std::memory_order_acquire);
+
+      if (state == tag) {
+        // Seqlock read: copy, then confirm the slot was not reused meanwhile
+        const ShmLogRecord header{
+            .sequence = tail,
+            .pid = slot->pid.load(std::memory_order_relaxed),
+            .level = static_cast<Level>(slot->level.load(std::memory_order_relaxed)),
+            .timestampNs = slot->timestampNs.load(std::memory_order_relaxed),
+            .line = {},
+            .truncated = slot->truncated.load(std::memory_order_relaxed) != 0,
+        };
+        const auto length = std::min<std::size_t>(slot->length.load(std::memory_order_relaxed),
+                                                  maxLineLength());
+        payload.assign(reinterpret_cast<const char *>(slot) + kSlotHeaderSize, length);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        ++tail;
+        if (slot->state.load(std::memory_order_relaxed) != tag) {
+          ++stats.lost;
+          continue;
+        }
+
+        ShmLogRecord record = header;
+        record.line = payload;
+        callback(record);
+        ++stats.records;
+        pendingSequence_ = 0;
+        continue;
+      }
+
+      if (state > (tag | kWritingBit) || slot->skipped.load(std::memory_order_acquire) == tag) {
+        ++stats.lost; // Already overwritten by a newer lap, or dropped by its writer
+        ++tail;
+        pendingSequence_ = 0;
+        continue;
+      }
+
+      // Reserved but not committed: wait, unless the writer is gone or took too long
+      const auto now = nowNs();
+      if (pendingSequence_ != tail + 1) {
+        pendingSequence_ = tail + 1;
+        pendingSinceNs_ = now;
+        break;
+      }
+      bool abandoned = now - pendingSinceNs_ > kPendingTimeoutNs;
+#if defined(NIXONCPP_HAS_SHM_LOG_RING)
+      if (!abandoned && state == (tag | kWritingBit) && now - pendingSinceNs_ > kPeerCheckDelayNs) {
+        const auto pid = slot->pid.load(std::memory_order_relaxed);
+        abandoned = pid > 0 && ::kill(static_cast<pid_t>(pid), 0) != 0 && errno == ESRCH;
+      }
+#endif
+      if (!abandoned) {
+        break;
+      }
+      // Mark an abandoned claim committed so that writers of later laps can reuse the slot
+      auto claimed = tag | kWritingBit;
+      slot->state.compare_exchange_strong(claimed, tag, std::memory_order_relaxed);
+      ++stats.lost;
+      ++tail;
+      pendingSequence_ = 0;
+    }
+
+    header_->tail.store(tail, std::memory_order_release);
+    if (stats.lost > 0) {
+      header_->lost.fetch_add(stats.lost, std::memory_order_relaxed);
+    }
+    return stats;
+  }
+
+  std::uint64_t ShmLogRing::lostCount() const noexcept {
+    return header_->lost.load(std::memory_order_relaxed);
+  }
+
+  std::uint32_t ShmLogRing::slotCount() const noexcept { return header_->slotCount; }
+
+  std::size_t ShmLogRing::maxLineLength() const noexcept {
+    return header_->slotSize - kSlotHeaderSize;
+  }
+
+} // namespace nixoncpp::logging
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <Utils/Logger/ILogSink.hpp>
+#include <Utils/UtilsError.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace nixoncpp::logging {
+
+  namespace detail {
+    struct ShmRingHeader;
+    struct ShmRingSlot;
+  } // namespace detail
+
+  /**
+   * @brief Configuration of a shared-memory log ring
+   */
+  struct ShmLogRingConfig {
+    std::uint32_t slotCount = 4096; // Rounded up to a power of two
+    std::uint32_t slotSize = 512;   // Bytes per record including the slot header
+  };
+
+  /**
+   * @brief A record drained from a shared-memory log ring
+   *
+   * The line view is only valid during the drain callback.
+   */
+  struct ShmLogRecord {
+    std::uint64_t sequence;
+    std::int32_t pid;
+    Level level;
+    std::int64_t timestampNs; // system_clock since epoch
+    std::string_view line;
+    bool truncated;
+  };
+
+  /**
+   * @brief Result of a single drain pass
+   */
+  struct ShmDrainStats {
+    std::uint64_t records = 0; // Records delivered to the callback
+    // Records overwritten, dropped by a writer that found its slot busy or abandoned by a
+    // crashed writer; each is counted once, by the collector
+    std::uint64_t lost = 0;
+  };
+
+  /**
+   * @brief Multi-process log ring in POSIX shared memory (shm_open + mmap)
+   *
+   * Any number of processes attach to the same named ring and write records without system
+   * calls: a writer reserves a sequence number with one atomic fetch_add, fills the slot and
+   * publishes it. Writers never block; when the collector falls behind, the oldest records are
+   * overwritten and reported as lost.
+   *
+   * A single collector drains records in sequence order. Committed records survive the crash
+   * of the process that wrote them; slots reserved by a writer that died before committing are
+   * skipped once the owning process is gone or the slot has been pending for too long, and
+   * the slot is released for the next lap.
+   *
+   * Only available on Linux and macOS; open() fails elsewhere.
+   */
+  class ShmLogRing final : public ILogSink {
+  public:
+    using DrainCallback = std::function<void(const ShmLogRecord &)>;
+
+    ShmLogRing(const ShmLogRing &) = delete;
+    ShmLogRing &operator=(const ShmLogRing &) = delete;
+    ShmLogRing(ShmLogRing &&) = delete;
+    ShmLogRing &operator=(ShmLogRing &&) = delete;
+    ~ShmLogRing() override;
+
+    /**
+     * @brief Attach to a named ring, creating and initializing it if it does not exist
+     *
+     * The geometry in config is only used by the process that creates the ring.
+     *
+     * @param name Shared memory object name (a leading '/' is added if missing)
+     * @param config
+     * @return Result<std::shared_ptr<ShmLogRing>, utils::FileError>
+     */
+    [[nodiscard]]
+    static utils::Result<std::shared_ptr<ShmLogRing>, utils::FileError>
+        open(const std::string &name, const ShmLogRingConfig &config = ShmLogRingConfig{});
+
+    /**
+     * @brief Remove the named shared memory object; attached processes keep their mapping
+     *
+     * @param name
+     * @return true if the object was removed
+     */
+    static bool remove(const std::string &name);
+
+    /**
+     * @brief Append a record to the ring (ILogSink)
+     *
+     * @param record
+     */
+    void write(const LogRecord &record) override;
+
+    /**
+     * @brief Append a raw record to the ring
+     *
+     * @param level
+     * @param timestampNs
+     * @param line
+     */
+    void push(Level level, std::int64_t timestampNs, std::string_view line) noexcept;
+
+    /**
+     * @brief Deliver committed records to the callback in sequence order
+     *
+     * Only one process may drain a ring at a time.
+     *
+     * @param callback
+     * @param maxRecords Upper bound on records delivered in this pass (0 = no limit)
+     * @return ShmDrainStats
+     */
+    ShmDrainStats drain(const DrainCallback &callback, std::size_t maxRecords = 0);
+
+    /**
+     * @brief Number of records lost since the ring was created, as counted by drain()
+     *
+     * @return std::uint64_t
+     */
+    [[nodiscard]]
+    std::uint64_t lostCount() const noexcept;
+
+    /**
+     * @brief Slots in the ring
+     *
+     * @return std::uint32_t
+     */
+    [[nodiscard]]
+    std::uint32_t slotCount() const noexcept;
+
+    /**
+     * @brief Maximum payload bytes per record; longer lines are truncated
+     *
+     * @return std::size_t
+     */
+    [[nodiscard]]
+    std::size_t maxLineLength() const noexcept;
+
+  private:
+    using Header = detail::ShmRingHeader;
+    using Slot = detail::ShmRingSlot;
+
+    ShmLogRing(void *mapping, std::size_t mappingSize);
+
+    [[nodiscard]]
+    Slot *slotAt(std::uint64_t sequence) const noexcept;
+
+    void *mapping_;
+    std::size_t mappingSize_;
+    Header *header_;
+    std::int32_t pid_;
+
+    // Collector-side bookkeeping for slots reserved but not yet committed
+    std::uint64_t pendingSequence_ = 0;
+    std::int64_t pendingSinceNs_ = 0;
+  };
+
+} // namespace nixoncpp::logging
@@ -0,0 +1,282 @@
+#include "UnixSocketSink.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fmt/core.h>
+#include <vector>
+
+#if defined(__linux__) || defined(__APPLE__)
+#define NIXONCPP_HAS_UNIX_SOCKET_SINK 1
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace nixoncpp::logging {
+
+#if defined(NIXONCPP_HAS_UNIX_SOCKET_SINK)
+  namespace {
+    bool makeAddress(const std::filesystem::path &socketPath, sockaddr_un &address) {
+      const std::string native = socketPath.string();
+      if (native.empty() || native.size() >= sizeof(address.sun_path)) {
+        return false;
+      }
+      std::memset(&address, 0, sizeof(address));
+      address.sun_family = AF_UNIX;
+      std::memcpy(address.sun_path, native.c_str(), native.size() + 1);
+      return true;
+    }
+
+    bool connectSocket(int fd, const std::filesystem::path &socketPath) {
+      sockaddr_un address{};
+      if (!makeAddress(socketPath, address)) {
+        errno = ENAMETOOLONG;
+        return false;
+      }
+      return ::connect(fd, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) == 0;
+    }
+
+    bool isReceiverBusy(int err) { return err == EAGAIN || err == EWOULDBLOCK || err == ENOBUFS; }
+
+    bool isReceiverGone(int err) {
+      return err == ECONNREFUSED || err == ENOTCONN || err == ENOENT || err == EDESTADDRREQ;
+    }
+  } // namespace
+#endif
+
+  UnixSocketSink::UnixSocketSink(int socketFd, std::filesystem::path socketPath,
+                                 UnixSocketSinkConfig config)
+      : socketFd_(socketFd), socketPath_(std::move(socketPath)), config_(config) {
+    config_.batchSize = std::max<std::size_t>(config_.batchSize, 1);
+    config_.queueCapacity = std::max<std::size_t>(config_.queueCapacity, 1);
+    sender_ = std::thread([this] { run(); });
+  }
+
+  UnixSocketSink::~UnixSocketSink() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+      stopDeadline_ = std::chrono::steady_clock::now() + config_.flushTimeout;
+    }
+    wakeSender_.notify_all();
+    if (sender_.joinable()) {
+      sender_.join();
+    }
+#if defined(NIXONCPP_HAS_UNIX_SOCKET_SINK)
+    ::close(socketFd_);
+#endif
+  }
+
+  utils::Result<std::shared_ptr<UnixSocketSink>, utils::FileError>
+      UnixSocketSink::open(const std::filesystem::path &socketPath,
+                           const UnixSocketSinkConfig &config) {
+#if defined(NIXONCPP_HAS_UNIX_SOCKET_SINK)
+    sockaddr_un address{};
+    if (!makeAddress(socketPath, address)) {
+      return utils::FileError{
+          .code = utils::FileErrorCode::InvalidPath,
+          .message = "Socket path is empty or too long",
+          .path = socketPath.string(),
+      };
+    }
+
+    const int fd = ::socket(AF_UNIX, SOCK_DGRAM, 0);
+    if (fd < 0) {
+      return utils::FileError{
+          .code = utils::FileErrorCode::Unknown,
+          .message = fmt::format("Failed to create socket: {}", std::strerror(errno)),
+          .path = socketPath.string(),
+      };
+    }
+    ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+    ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+    if (!connectSocket(fd, socketPath)) {
+      const int err = errno;
+      ::close(fd);
+      return utils::FileError{
+          .code = err == EACCES                          ? utils::FileErrorCode::AccessDenied
+                  : (err == ENOENT || err == ECONNREFUSED) ? utils::FileErrorCode::NotFound
+                                                           : utils::FileErrorCode::WriteError,
+          .message = fmt::format("Failed to connect to log receiver: {}", std::strerror(err)),
+          .path = socketPath.string(),
+      };
+    }
+
+    return std::shared_ptr<UnixSocketSink>(new UnixSocketSink(fd, socketPath, config));
+#else
+    (void)config;
+    return utils::FileError{
+        .code = utils::FileErrorCode::Unknown,
+        .message = "Unix socket log sink is not supported on this platform",
+        .path = socketPath.string(),
+    };
+#endif
+  }
+
+  void UnixSocketSink::write(const LogRecord &record) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (queue_.size() >= config_.queueCapacity) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        if (config_.overflowPolicy == OverflowPolicy::DropNewest) {
+          return;
+        }
+        queue_.pop_front();
+      }
+      queue_.emplace_back(record.line);
+    }
+    wakeSender_.notify_one();
+  }
+
+  void UnixSocketSink::flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    queueDrained_.wait_for(lock, config_.flushTimeout,
+                           [this] { return queue_.empty() && inFlight_ == 0; });
+  }
+
+  std::uint64_t UnixSocketSink::sentCount() const noexcept {
+    return sent_.load(std::memory_order_relaxed);
+  }
+
+  std::uint64_t UnixSocketSink::droppedCount() const noexcept {
+    return dropped_.load(std::memory_order_relaxed);
+  }
+
+  void UnixSocketSink::run() {
+    std::deque<std::string> batch;
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    for (;;) {
+      wakeSender_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+      if (queue_.empty()) {
+        break; // Stopping and nothing left to send
+      }
+
+      const auto take = std::min(config_.batchSize, queue_.size());
+      for (std::size_t i = 0; i < take; ++i) {
+        batch.push_back(std::move(queue_.front()));
+        queue_.pop_front();
+      }
+      inFlight_ = batch.size();
+      lock.unlock();
+
+      const auto consumed = sendBatch(batch);
+      batch.erase(batch.begin(), batch.begin() + static_cast<std::ptrdiff_t>(consumed));
+      const bool receiverBusy = !batch.empty();
+
+      lock.lock();
+      inFlight_ = 0;
+      if (receiverBusy) {
+        // Keep the unsent records at the front, then enforce the queue capacity
+        while (!batch.empty()) {
+          queue_.push_front(std::move(batch.back()));
+          batch.pop_back();
+        }
+        while (queue_.size() > config_.queueCapacity) {
+          if (config_.overflowPolicy == OverflowPolicy::DropNewest) {
+            queue_.pop_back();
+          } else {
+            queue_.pop_front();
+          }
+          dropped_.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (stopping_ && std::chrono::steady_clock::now() >= stopDeadline_) {
+          dropped_.fetch_add(queue_.size(), std::memory_order_relaxed);
+          queue_.clear();
+        }
+      }
+      if (queue_.empty()) {
+        queueDrained_.notify_all();
+      }
+      if (receiverBusy && !queue_.empty()) {
+        // Back off without holding up producers; they only touch the queue
+        lock.unlock();
+        std::this_thread::sleep_for(config_.retryDelay);
+        lock.lock();
+      }
+    }
+    queueDrained_.notify_all();
+  }
+
+  std::size_t UnixSocketSink::sendBatch(const std::deque<std::string> &batch) {
+#if defined(NIXONCPP_HAS_UNIX_SOCKET_SINK)
+    std::size_t consumed = 0;
+    bool reconnected = false;
+
+    // Returns true when the caller should stop and retry later
+    auto handleError = [&](int err) {
+      if (err == EINTR) {
+        return false;
+      }
+      if (isReceiverBusy(err)) {
+        return true;
+      }
+      if (isReceiverGone(err)) {
+        if (!reconnected && reconnect()) {
+          reconnected = true;
+          return false;
+        }
+        return true;
+      }
+      // The socket rejected this record itself (e.g. EMSGSIZE): drop it and continue
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      ++consumed;
+      return false;
+    };
+
+#if defined(__linux__)
+    thread_local std::vector<mmsghdr> messages;
+    thread_local std::vector<iovec> vectors;
+    messages.assign(batch.size(), mmsghdr{});
+    vectors.resize(batch.size());
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+      vectors[i].iov_base = const_cast<char *>(batch[i].data());
+      vectors[i].iov_len = batch[i].size();
+      messages[i].msg_hdr.msg_iov = &vectors[i];
+      messages[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    while (consumed < batch.size()) {
+      const int sent =
+          ::sendmmsg(socketFd_, messages.data() + consumed,
+                     static_cast<unsigned int>(batch.size() - consumed), MSG_DONTWAIT);
+      if (sent > 0) {
+        consumed += static_cast<std::size_t>(sent);
+        sent_.fetch_add(static_cast<std::uint64_t>(sent), std::memory_order_relaxed);
+        continue;
+      }
+      if (handleError(errno)) {
+        break;
+      }
+    }
+#else
+    while (consumed < batch.size()) {
+      const auto &record = batch[consumed];
+      if (::send(socketFd_, record.data(), record.size(), 0) >= 0) {
+        ++consumed;
+        sent_.fetch_add(1, std::memory_order_relaxed);
+        continue;
+      }
+      if (handleError(errno)) {
+        break;
+      }
+    }
+#endif
+    return consumed;
+#else
+    dropped_.fetch_add(batch.size(), std::memory_order_relaxed);
+    return batch.size();
+#endif
+  }
+
+  bool UnixSocketSink::reconnect() {
+#if defined(NIXONCPP_HAS_UNIX_SOCKET_SINK)
+    return connectSocket(socketFd_, socketPath_);
+#else
+    return false;
+#endif
+  }
+
+} // namespace nixoncpp::logging
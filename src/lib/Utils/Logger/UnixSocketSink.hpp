@@ -0,0 +1,128 @@
+#pragma once
+
+#include <Utils/Logger/ILogSink.hpp>
+#include <Utils/UtilsError.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace nixoncpp::logging {
+
+  /**
+   * @brief What to discard when the send queue is full
+   */
+  enum class OverflowPolicy : std::uint8_t { DropNewest, DropOldest };
+
+  /**
+   * @brief Configuration of a Unix datagram socket sink
+   */
+  struct UnixSocketSinkConfig {
+    std::size_t queueCapacity = 8192; // Records buffered while the receiver is slow
+    std::size_t batchSize = 64;       // Records handed to one sendmmsg call
+    OverflowPolicy overflowPolicy = OverflowPolicy::DropOldest;
+    std::chrono::milliseconds retryDelay{5};     // Back-off while the receiver is full or absent
+    std::chrono::milliseconds flushTimeout{500}; // Upper bound for flush() and shutdown
+  };
+
+  /**
+   * @brief Sink forwarding records to a local aggregator over a Unix datagram socket
+   *
+   * write() only appends to a bounded in-memory queue and never waits for the socket. A
+   * background thread sends queued records in batches (sendmmsg on Linux, one send per record
+   * elsewhere). While the receiver is slow the records stay queued; once the queue is full
+   * records are dropped according to the overflow policy and counted.
+   *
+   * Only available on POSIX platforms; open() fails elsewhere.
+   */
+  class UnixSocketSink final : public ILogSink {
+  public:
+    UnixSocketSink(const UnixSocketSink &) = delete;
+    UnixSocketSink &operator=(const UnixSocketSink &) = delete;
+    UnixSocketSink(UnixSocketSink &&) = delete;
+    UnixSocketSink &operator=(UnixSocketSink &&) = delete;
+    ~UnixSocketSink() override;
+
+    /**
+     * @brief Connect to a bound datagram socket and start the sender thread
+     *
+     * @param socketPath Path of the receiver's socket
+     * @param config
+     * @return Result<std::shared_ptr<UnixSocketSink>, utils::FileError>
+     */
+    [[nodiscard]]
+    static utils::Result<std::shared_ptr<UnixSocketSink>, utils::FileError>
+        open(const std::filesystem::path &socketPath,
+             const UnixSocketSinkConfig &config = UnixSocketSinkConfig{});
+
+    /**
+     * @brief Queue a record for sending (ILogSink)
+     *
+     * @param record
+     */
+    void write(const LogRecord &record) override;
+
+    /**
+     * @brief Wait until the queue is empty or the flush timeout expires
+     *
+     */
+    void flush() override;
+
+    /**
+     * @brief Records delivered to the socket
+     *
+     * @return std::uint64_t
+     */
+    [[nodiscard]]
+    std::uint64_t sentCount() const noexcept;
+
+    /**
+     * @brief Records discarded because the queue was full or the receiver was gone
+     *
+     * @return std::uint64_t
+     */
+    [[nodiscard]]
+    std::uint64_t droppedCount() const noexcept;
+
+  private:
+    UnixSocketSink(int socketFd, std::filesystem::path socketPath, UnixSocketSinkConfig config);
+
+    void run();
+
+    /**
+     * @brief Send records from the front of the batch
+     *
+     * Records the socket rejects outright (e.g. oversized) are consumed and counted as dropped.
+     *
+     * @param batch
+     * @return std::size_t Records consumed; fewer than batch.size() means the receiver is busy
+     */
+    std::size_t sendBatch(const std::deque<std::string> &batch);
+
+    bool reconnect();
+
+    int socketFd_;
+    std::filesystem::path socketPath_;
+    UnixSocketSinkConfig config_;
+
+    std::mutex mutex_;
+    std::condition_variable wakeSender_;
+    std::condition_variable queueDrained_;
+    std::deque<std::string> queue_;
+    std::size_t inFlight_ = 0;
+    bool stopping_ = false;
+    std::chrono::steady_clock::time_point stopDeadline_{};
+
+    std::atomic<std::uint64_t> sent_{0};
+    std::atomic<std::uint64_t> dropped_{0};
+    std::thread sender_;
+  };
+
+} // namespace nixoncpp::logging
@@ -0,0 +1,104 @@
+#include "NewlineScanner.hpp"
+#include <cstdint>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(_M_X64))
+#define NIXONCPP_NEWLINE_X86 1
+#include <immintrin.h>
+#elif defined(__GNUC__) && defined(__aarch64__)
+#define NIXONCPP_NEWLINE_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace nixoncpp::utils {
+
+  namespace {
+    using ScanFn = const char *(*)(const char *, const char *) noexcept;
+
+    const char *scanMemchr(const char *begin, const char *end) noexcept {
+      if (begin >= end) {
+        return end;
+      }
+      const void *found = std::memchr(begin, '\n', static_cast<std::size_t>(end - begin));
+      return found != nullptr ? static_cast<const char *>(found) : end;
+    }
+
+#if defined(NIXONCPP_NEWLINE_X86)
+    const char *scanSse2(const char *begin, const char *end) noexcept {
+      const __m128i newline = _mm_set1_epi8('\n');
+      while (end - begin >= 16) {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(begin));
+        const int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(block, newline));
+        if (mask != 0) {
+          return begin + __builtin_ctz(static_cast<unsigned>(mask));
+        }
+        begin += 16;
+      }
+      return scanMemchr(begin, end);
+    }
+
+    __attribute__((target("avx2"))) const char *scanAvx2(const char *begin,
+                                                         const char *end) noexcept {
+      const __m256i newline = _mm256_set1_epi8('\n');
+      while (end - begin >= 32) {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(begin));
+        const int mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(block, newline));
+        if (mask != 0) {
+          return begin + __builtin_ctz(static_cast<unsigned>(mask));
+        }
+        begin += 32;
+      }
+      return scanSse2(begin, end);
+    }
+#endif
+
+#if defined(NIXONCPP_NEWLINE_NEON)
+    const char *scanNeon(const char *begin, const char *end) noexcept {
+      const uint8x16_t newline = vdupq_n_u8('\n');
+      while (end - begin >= 16) {
+        const uint8x16_t equal =
+            vceqq_u8(vld1q_u8(reinterpret_cast<const std::uint8_t *>(begin)), newline);
+        // Narrow each byte to a nibble so the match mask fits in 64 bits
+        const uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(equal), 4);
+        const std::uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(nibbles), 0);
+        if (mask != 0) {
+          return begin + (__builtin_ctzll(mask) >> 2);
+        }
+        begin += 16;
+      }
+      return scanMemchr(begin, end);
+    }
+#endif
+
+    struct Scanner {
+      ScanFn scan;
+      std::string_view name;
+    };
+
+    Scanner selectScanner() noexcept {
+#if defined(NIXONCPP_NEWLINE_X86)
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx2")) {
+        return {scanAvx2, "avx2"};
+      }
+      return {scanSse2, "sse2"};
+#elif defined(NIXONCPP_NEWLINE_NEON)
+      return {scanNeon, "neon"};
+#else
+      return {scanMemchr, "memchr"};
+#endif
+    }
+
+    const Scanner &scanner() noexcept {
+      static const Scanner selected = selectScanner();
+      return selected;
+    }
+  } // namespace
+
+  const char *findNewline(const char *begin, const char *end) noexcept {
+    return scanner().scan(begin, end);
+  }
+
+  std::string_view newlineScannerName() noexcept { return scanner().name; }
+
+} // namespace nixoncpp::utils
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <string_view>
+
+namespace nixoncpp::utils {
+
+  /**
+   * @brief Find the first '\n' in [begin, end)
+   *
+   * Uses the widest vector unit available at runtime (AVX2 or SSE2 on x86-64, NEON on
+   * AArch64) and falls back to memchr elsewhere.
+   *
+   * @param begin
+   * @param end
+   * @return const char* Position of the newline, or end if there is none
+   */
+  [[nodiscard]]
+  const char *findNewline(const char *begin, const char *end) noexcept;
+
+  /**
+   * @brief Name of the scanner selected for this CPU ("avx2", "sse2", "neon" or "memchr")
+   *
+   * @return std::string_view
+   */
+  [[nodiscard]]
+  std::string_view newlineScannerName() noexcept;
+
+} // namespace nixoncpp::utils
@@ -1,9 +1,14 @@
 #include "UtilsFactory.hpp"
 #include "Assets/AssetManagerFactory.hpp"
+#include "Filesystem/CompressedFileReader.hpp"
+#include "Filesystem/CompressedFileWriter.hpp"
 #include "Filesystem/DirectoryManager.hpp"
+#include "Filesystem/FileHasher.hpp"
 #include "Filesystem/FileReader.hpp"
 #include "Filesystem/FileWriter.hpp"
+#include "Filesystem/IoUringFileIO.hpp"
 #include "Filesystem/PathResolver.hpp"
+#include "Filesystem/ThreadPoolFileIO.hpp"
 #include "Logger/LoggerFactory.hpp"
 #include "Platform/PlatformInfoFactory.hpp"
 #include "String/StringFormatter.hpp"
@@ -15,11 +20,49 @@ namespace nixoncpp::utils {
 
   // Filesystem factories
   std::shared_ptr<IFileReader> UtilsFactory::createFileReader() {
-    return std::make_shared<FileReader>();
+    return std::make_shared<FileReader>(
+        [] { return UtilsFactory::createAsyncFileIO(UtilsFactory::createThreadPool()); });
+  }
+
+  std::shared_ptr<IFileReader>
+      UtilsFactory::createFileReader(std::shared_ptr<IAsyncFileIO> asyncIo,
+                                     std::shared_ptr<FileHandleCache> handleCache) {
+    return std::make_shared<FileReader>(std::move(asyncIo), std::move(handleCache));
+  }
+
+  std::shared_ptr<CachingFileReader>
+      UtilsFactory::createCachingFileReader(std::size_t capacityBytes) {
+    return createCachingFileReader(createFileReader(), capacityBytes);
+  }
+
+  std::shared_ptr<CachingFileReader>
+      UtilsFactory::createCachingFileReader(std::shared_ptr<IFileReader> inner,
+                                            std::size_t capacityBytes) {
+    return std::make_shared<CachingFileReader>(std::move(inner), capacityBytes);
+  }
+
+  std::shared_ptr<IFileReader> UtilsFactory::createCompressedFileReader() {
+    return std::make_shared<CompressedFileReader>(createFileReader());
+  }
+
+  std::shared_ptr<FileHandleCache> UtilsFactory::createFileHandleCache(std::size_t capacity) {
+    return std::make_shared<FileHandleCache>(capacity);
   }
 
   std::shared_ptr<IFileWriter> UtilsFactory::createFileWriter() {
-    return std::make_shared<FileWriter>();
+    // No threads and nothing to flush at exit: safe to keep for the whole process
+    static const auto groupCommit = std::make_shared<GroupCommitter>();
+    return createFileWriter(groupCommit);
+  }
+
+  std::shared_ptr<IFileWriter>
+      UtilsFactory::createFileWriter(std::shared_ptr<GroupCommitter> groupCommit) {
+    return std::make_shared<FileWriter>(std::move(groupCommit));
+  }
+
+  std::shared_ptr<IFileWriter>
+      UtilsFactory::createCompressedFileWriter(CompressionOptions options) {
+    return std::make_shared<CompressedFileWriter>(createFileWriter(), options);
   }
 
   std::shared_ptr<IPathResolver> UtilsFactory::createPathResolver() {
@@ -30,6 +73,38 @@ namespace nixoncpp::utils {
     return std::make_shared<DirectoryManager>();
   }
 
+  std::shared_ptr<IDirectoryManager>
+      UtilsFactory::createDirectoryManager(std::shared_ptr<ThreadPool> pool) {
+    return std::make_shared<DirectoryManager>(std::move(pool));
+  }
+
+  std::shared_ptr<IFileHasher> UtilsFactory::createFileHasher() {
+    return std::make_shared<FileHasher>();
+  }
+
+  std::shared_ptr<IFileHasher> UtilsFactory::createFileHasher(std::shared_ptr<ThreadPool> pool) {
+    return std::make_shared<FileHasher>(std::move(pool));
+  }
+
+  // Concurrency factories
+  std::shared_ptr<ThreadPool> UtilsFactory::createThreadPool(std::size_t threadCount) {
+    return std::make_shared<ThreadPool>(threadCount);
+  }
+
+  std::shared_ptr<ChunkedFileProcessor>
+      UtilsFactory::createChunkedFileProcessor(std::shared_ptr<ThreadPool> pool) {
+    return std::make_shared<ChunkedFileProcessor>(createFileReader(), std::move(pool));
+  }
+
+  std::shared_ptr<IAsyncFileIO> UtilsFactory::createAsyncFileIO(std::shared_ptr<ThreadPool> pool) {
+    if (auto ring = IoUringFileIO::open()) {
+      return ring.value();
+    }
+    // A plain reader: the backend only needs its blocking reads
+    return std::make_shared<ThreadPoolFileIO>(std::make_shared<FileReader>(), createFileWriter(),
+                                              std::move(pool));
+  }
+
   // Platform factories
   std::unique_ptr<IPlatformInfo> UtilsFactory::createPlatformInfo() {
     return PlatformInfoFactory::createForCurrentPlatform();
@@ -78,7 +153,10 @@ namespace nixoncpp::utils {
                         .enableFileLogging = false,
                         .logFilePath = "",
                         .colorOutput = true,
-                        .appPrefix = ""};
+                        .appPrefix = "",
+                        .sharedMemoryRing = "",
+                        .logSocketPath = "",
+                        .logIndexInterval = 0};
     return createLogger(LoggerType::Console, config);
   }
 
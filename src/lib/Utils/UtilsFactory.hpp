@@ -1,7 +1,15 @@
 #pragma once
 
 #include <Utils/Assets/IAssetManager.hpp>
+#include <Utils/Concurrency/ThreadPool.hpp>
+#include <Utils/Filesystem/CachingFileReader.hpp>
+#include <Utils/Filesystem/ChunkedFileProcessor.hpp>
+#include <Utils/Filesystem/Compression.hpp>
+#include <Utils/Filesystem/FileHandleCache.hpp>
+#include <Utils/Filesystem/GroupCommitter.hpp>
+#include <Utils/Filesystem/IAsyncFileIO.hpp>
 #include <Utils/Filesystem/IDirectoryManager.hpp>
+#include <Utils/Filesystem/IFileHasher.hpp>
 #include <Utils/Filesystem/IFileReader.hpp>
 #include <Utils/Filesystem/IFileWriter.hpp>
 #include <Utils/Filesystem/IPathResolver.hpp>
@@ -25,14 +33,112 @@ namespace nixoncpp::utils {
 
   class UtilsFactory {
   public:
+    /**
+     * @brief Create a file reader whose readMany() reads concurrently
+     *
+     * The reader sets up its own createAsyncFileIO() backend (io_uring, or a thread pool of
+     * ThreadPool::defaultThreadCount() threads) on its first readMany() call, so readers that
+     * never call it start no threads.
+     * @return File reader
+     */
     [[nodiscard]]
     static std::shared_ptr<IFileReader> createFileReader();
+    /**
+     * @brief Create a file reader whose readMany() runs on an asynchronous backend
+     * @param asyncIo e.g. from createAsyncFileIO()
+     * @param handleCache Optional descriptor cache for readInto()/readRange()
+     * @return File reader
+     */
+    [[nodiscard]]
+    static std::shared_ptr<IFileReader>
+        createFileReader(std::shared_ptr<IAsyncFileIO> asyncIo,
+                         std::shared_ptr<FileHandleCache> handleCache = nullptr);
+    [[nodiscard]]
+    static std::shared_ptr<FileHandleCache>
+        createFileHandleCache(std::size_t capacity = FileHandleCache::kDefaultCapacity);
+    /**
+     * @brief Create a reader that caches whole-file contents, revalidated by stat
+     * @param capacityBytes Total size of cached contents
+     * @return Caching reader over a FileReader
+     */
+    [[nodiscard]]
+    static std::shared_ptr<CachingFileReader> createCachingFileReader(
+        std::size_t capacityBytes = CachingFileReader::kDefaultCapacityBytes);
+    /**
+     * @brief Create a caching decorator around an existing reader
+     * @param inner Reader used on cache misses
+     * @param capacityBytes Total size of cached contents
+     * @return Caching reader
+     */
+    [[nodiscard]]
+    static std::shared_ptr<CachingFileReader> createCachingFileReader(
+        std::shared_ptr<IFileReader> inner,
+        std::size_t capacityBytes = CachingFileReader::kDefaultCapacityBytes);
+    /**
+     * @brief Create a reader that decodes gzip and zstd files transparently
+     * @return Decompressing reader over a FileReader
+     */
+    [[nodiscard]]
+    static std::shared_ptr<IFileReader> createCompressedFileReader();
+    /**
+     * @brief Create a file writer
+     *
+     * All writers created this way share one GroupCommitter, so concurrent writeAtomic() calls
+     * of different writers join the same batches.
+     * @return File writer
+     */
     [[nodiscard]]
     static std::shared_ptr<IFileWriter> createFileWriter();
+    /**
+     * @brief Create a file writer whose writeAtomic() calls join the batches of groupCommit
+     * @param groupCommit Committer shared with other writers
+     * @return File writer
+     */
+    [[nodiscard]]
+    static std::shared_ptr<IFileWriter>
+        createFileWriter(std::shared_ptr<GroupCommitter> groupCommit);
+    /**
+     * @brief Create a writer that compresses "*.gz" and "*.zst" paths
+     * @param options Encoder settings, e.g. zstd worker threads
+     * @return Compressing writer over a FileWriter
+     */
+    [[nodiscard]]
+    static std::shared_ptr<IFileWriter>
+        createCompressedFileWriter(CompressionOptions options = CompressionOptions{});
     [[nodiscard]]
     static std::shared_ptr<IPathResolver> createPathResolver();
     [[nodiscard]]
     static std::shared_ptr<IDirectoryManager> createDirectoryManager();
+    /**
+     * @brief Create a directory manager that copies and walks trees in parallel
+     * @param pool Runs the file copies of copyTree() and the directory reads of walk()
+     * @return Directory manager
+     */
+    [[nodiscard]]
+    static std::shared_ptr<IDirectoryManager>
+        createDirectoryManager(std::shared_ptr<ThreadPool> pool);
+    [[nodiscard]]
+    static std::shared_ptr<IFileHasher> createFileHasher();
+    /**
+     * @brief Create a file hasher that hashes batches in parallel
+     * @param pool Runs the files of hashFiles()
+     * @return File hasher
+     */
+    [[nodiscard]]
+    static std::shared_ptr<IFileHasher> createFileHasher(std::shared_ptr<ThreadPool> pool);
+    [[nodiscard]]
+    static std::shared_ptr<ThreadPool>
+        createThreadPool(std::size_t threadCount = ThreadPool::defaultThreadCount());
+    [[nodiscard]]
+    static std::shared_ptr<ChunkedFileProcessor>
+        createChunkedFileProcessor(std::shared_ptr<ThreadPool> pool);
+    /**
+     * @brief Create the io_uring backend if available, otherwise one running on the pool
+     * @param pool Used only by the thread-pool fallback
+     * @return Asynchronous file I/O backend
+     */
+    [[nodiscard]]
+    static std::shared_ptr<IAsyncFileIO> createAsyncFileIO(std::shared_ptr<ThreadPool> pool);
     [[nodiscard]]
     static std::unique_ptr<IPlatformInfo> createPlatformInfo();
     [[nodiscard]]
@@ -0,0 +1,250 @@
+#include <Utils/Concurrency/ThreadPool.hpp>
+#include <Utils/Filesystem/FileReader.hpp>
+#include <Utils/Filesystem/FileWriter.hpp>
+#include <Utils/Filesystem/IoUringFileIO.hpp>
+#include <Utils/Filesystem/ThreadPoolFileIO.hpp>
+#include <Utils/UtilsFactory.hpp>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace nixoncpp::utils;
+namespace fs = std::filesystem;
+
+// ============================================================================
+// Shared behaviour of every IAsyncFileIO backend
+// ============================================================================
+
+enum class Backend { ThreadPool, IoUring };
+
+class AsyncFileIOTest : public ::testing::TestWithParam<Backend> {
+protected:
+  void SetUp() override {
+    testDir_ = fs::temp_directory_path() / "nixoncpp_async_io_test";
+    fs::remove_all(testDir_);
+    fs::create_directories(testDir_);
+
+    if (GetParam() == Backend::ThreadPool) {
+      io_ = std::make_shared<ThreadPoolFileIO>(std::make_shared<FileReader>(),
+                                               std::make_shared<FileWriter>(),
+                                               std::make_shared<ThreadPool>(2));
+      return;
+    }
+    // Small registered buffers so both the fixed and the plain read path are exercised
+    auto ring = IoUringFileIO::open(IoUringConfig{
+        .queueDepth = 8,
+        .fixedBufferCount = 4,
+        .fixedBufferSize = 4096,
+    });
+    if (!ring) {
+      GTEST_SKIP() << "io_uring unavailable: " << ring.error().toString();
+    }
+    ring_ = ring.value();
+    io_ = ring_;
+  }
+
+  void TearDown() override {
+    io_.reset();
+    ring_.reset();
+    fs::remove_all(testDir_);
+  }
+
+  fs::path writeFile(const std::string &name, const std::string &content) {
+    auto path = testDir_ / name;
+    std::ofstream(path, std::ios::binary) << content;
+    return path;
+  }
+
+  fs::path testDir_;
+  std::shared_ptr<IAsyncFileIO> io_;
+  std::shared_ptr<IoUringFileIO> ring_;
+};
+
+TEST_P(AsyncFileIOTest, ReadsSmallAndLargeFiles) {
+  const std::string small = "hello async world\n";
+  const std::string large(300 * 1024 + 17, 'x');
+  auto smallFuture = io_->read(writeFile("small.txt", small));
+  auto largeFuture = io_->read(writeFile("large.txt", large));
+  auto emptyFuture = io_->read(writeFile("empty.txt", ""));
+
+  auto smallResult = smallFuture.get();
+  ASSERT_TRUE(smallResult.hasValue());
+  EXPECT_EQ(smallResult.value(), small);
+  auto largeResult = largeFuture.get();
+  ASSERT_TRUE(largeResult.hasValue());
+  EXPECT_EQ(largeResult.value(), large);
+  auto emptyResult = emptyFuture.get();
+  ASSERT_TRUE(emptyResult.hasValue());
+  EXPECT_TRUE(emptyResult.value().empty());
+}
+
+TEST_P(AsyncFileIOTest, ReadBytesPreservesBinaryContent) {
+  std::string content;
+  for (int i = 0; i < 10000; ++i) {
+    content.push_back(static_cast<char>(i % 256));
+  }
+  auto result = io_->readBytes(writeFile("binary.bin", content)).get();
+  ASSERT_TRUE(result.hasValue());
+  EXPECT_EQ(result.value(), std::vector<uint8_t>(content.begin(), content.end()));
+}
+
+TEST_P(AsyncFileIOTest, ManyConcurrentReadsAllComplete) {
+  // More files than queue entries and registered buffers
+  std::vector<fs::path> paths;
+  for (int i = 0; i < 64; ++i) {
+    paths.push_back(writeFile("file" + std::to_string(i) + ".txt",
+                              std::string(static_cast<std::size_t>(i) * 97, 'a') +
+                                  std::to_string(i)));
+  }
+  std::vector<AsyncFileResult<std::string>> futures;
+  for (const auto &path : paths) {
+    futures.push_back(io_->read(path));
+  }
+  for (int i = 0; i < 64; ++i) {
+    auto result = futures[i].get();
+    ASSERT_TRUE(result.hasValue()) << result.error().toString();
+    EXPECT_EQ(result.value(),
+              std::string(static_cast<std::size_t>(i) * 97, 'a') + std::to_string(i));
+  }
+}
+
+TEST_P(AsyncFileIOTest, WriteCreatesParentsAndAppends) {
+  const auto path = testDir_ / "nested" / "dir" / "out.txt";
+  auto first = io_->write(path, "first\n").get();
+  ASSERT_TRUE(first.hasValue()) << first.error().toString();
+  auto second = io_->write(path, "second\n", true).get();
+  ASSERT_TRUE(second.hasValue());
+
+  auto content = io_->read(path).get();
+  ASSERT_TRUE(content.hasValue());
+  EXPECT_EQ(content.value(), "first\nsecond\n");
+
+  auto truncated = io_->write(path, "").get();
+  ASSERT_TRUE(truncated.hasValue());
+  EXPECT_EQ(fs::file_size(path), 0U);
+}
+
+TEST_P(AsyncFileIOTest, DestructionWaitsForIssuedOperations) {
+  constexpr int kFiles = 32;
+  const std::string content(64 * 1024, 'w');
+  std::vector<AsyncFileResult<void>> writes;
+  for (int i = 0; i < kFiles; ++i) {
+    writes.push_back(io_->write(testDir_ / ("out" + std::to_string(i)), content));
+  }
+  io_.reset();
+  ring_.reset();
+
+  for (int i = 0; i < kFiles; ++i) {
+    ASSERT_EQ(writes[i].wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_TRUE(writes[i].get().hasValue());
+    EXPECT_EQ(fs::file_size(testDir_ / ("out" + std::to_string(i))), content.size());
+  }
+}
+
+TEST_P(AsyncFileIOTest, LargeWriteRoundTrips) {
+  std::string content(2 * 1024 * 1024 + 3, '\0');
+  for (std::size_t i = 0; i < content.size(); ++i) {
+    content[i] = static_cast<char>('a' + (i % 26));
+  }
+  const auto path = testDir_ / "large_out.txt";
+  ASSERT_TRUE(io_->write(path, content).get().hasValue());
+  auto result = io_->read(path).get();
+  ASSERT_TRUE(result.hasValue());
+  EXPECT_EQ(result.value(), content);
+}
+
+TEST_P(AsyncFileIOTest, ReportsErrors) {
+  auto missing = io_->read(testDir_ / "missing.txt").get();
+  ASSERT_FALSE(missing.hasValue());
+  EXPECT_EQ(missing.error().code, FileErrorCode::NotFound);
+
+  auto directory = io_->readBytes(testDir_).get();
+  ASSERT_FALSE(directory.hasValue());
+  EXPECT_EQ(directory.error().code, FileErrorCode::IsDirectory);
+
+  auto empty = io_->read("").get();
+  ASSERT_FALSE(empty.hasValue());
+  EXPECT_EQ(empty.error().code, FileErrorCode::InvalidPath);
+
+  auto writeToDirectory = io_->write(testDir_, "data").get();
+  ASSERT_FALSE(writeToDirectory.hasValue());
+  EXPECT_EQ(writeToDirectory.error().code, FileErrorCode::IsDirectory);
+}
+
+TEST_P(AsyncFileIOTest, ReadsFilesWithUnknownSize) {
+#if defined(__linux__)
+  auto result = io_->read("/proc/self/status").get();
+  ASSERT_TRUE(result.hasValue());
+  EXPECT_NE(result.value().find("Name:"), std::string::npos);
+#else
+  GTEST_SKIP() << "procfs is Linux-only";
+#endif
+}
+
+INSTANTIATE_TEST_SUITE_P(Backends, AsyncFileIOTest,
+                         ::testing::Values(Backend::ThreadPool, Backend::IoUring),
+                         [](const ::testing::TestParamInfo<Backend> &info) {
+                           return info.param == Backend::ThreadPool ? "ThreadPool" : "IoUring";
+                         });
+
+// ============================================================================
+// Backend specifics
+// ============================================================================
+
+TEST(IoUringFileIOTest, SmallReadsUseRegisteredBuffers) {
+  auto ring = IoUringFileIO::open();
+  if (!ring) {
+    GTEST_SKIP() << "io_uring unavailable: " << ring.error().toString();
+  }
+  const auto path = fs::temp_directory_path() / "nixoncpp_io_uring_fixed.txt";
+  std::ofstream(path) << "fixed buffer read";
+
+  auto result = ring.value()->read(path).get();
+  fs::remove(path);
+  ASSERT_TRUE(result.hasValue());
+  EXPECT_EQ(result.value(), "fixed buffer read");
+  const auto stats = ring.value()->stats();
+  EXPECT_GE(stats.submitted, 1U);
+  EXPECT_GE(stats.submitCalls, 1U);
+  EXPECT_EQ(stats.fixedReads, 1U);
+}
+
+TEST(IoUringFileIOTest, FactoryFallsBackToThreadPool) {
+  auto io = UtilsFactory::createAsyncFileIO(std::make_shared<ThreadPool>(1));
+  ASSERT_NE(io, nullptr);
+  const bool ringAvailable = IoUringFileIO::open().hasValue();
+  EXPECT_EQ(io->backendName(), ringAvailable ? "io_uring" : "thread-pool");
+
+  const auto path = fs::temp_directory_path() / "nixoncpp_async_factory.txt";
+  ASSERT_TRUE(io->write(path, "via factory").get().hasValue());
+  auto result = io->read(path).get();
+  fs::remove(path);
+  ASSERT_TRUE(result.hasValue());
+  EXPECT_EQ(result.value(), "via factory");
+}
+
+TEST(ThreadPoolFileIOTest, DestructionWaitsWhileSharedPoolLivesOn) {
+  auto pool = std::make_shared<ThreadPool>(1);
+  const auto path = fs::temp_directory_path() / "nixoncpp_async_shared_pool.txt";
+  const std::string content(1024 * 1024, 'p');
+  fs::remove(path); // Appended to below
+
+  auto io = std::make_unique<ThreadPoolFileIO>(std::make_shared<FileReader>(),
+                                               std::make_shared<FileWriter>(), pool);
+  std::vector<AsyncFileResult<void>> writes;
+  for (int i = 0; i < 8; ++i) {
+    writes.push_back(io->write(path, content, true));
+  }
+  io.reset();
+
+  for (auto &write : writes) {
+    ASSERT_EQ(write.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_TRUE(write.get().hasValue());
+  }
+  EXPECT_EQ(fs::file_size(path), 8 * content.size());
+  fs::remove(path);
+}
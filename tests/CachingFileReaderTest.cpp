@@ -0,0 +1,219 @@
+#include <Utils/Filesystem/CachingFileReader.hpp>
+#include <Utils/Filesystem/FileReader.hpp>
+#include <Utils/UtilsFactory.hpp>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace nixoncpp::utils;
+namespace fs = std::filesystem;
+
+class CachingFileReaderTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    testDir_ = fs::temp_directory_path() / "CachingFileReaderTest";
+    fs::remove_all(testDir_);
+    fs::create_directories(testDir_);
+  }
+
+  void TearDown() override {
+    std::error_code ec;
+    fs::remove_all(testDir_, ec);
+  }
+
+  fs::path writeFile(const std::string &name, const std::string &content) {
+    const auto path = testDir_ / name;
+    std::ofstream(path, std::ios::binary) << content;
+    return path;
+  }
+
+  fs::path testDir_;
+  CachingFileReader reader_{std::make_shared<FileReader>()};
+};
+
+// ============================================================================
+// Caching and revalidation
+// ============================================================================
+
+TEST_F(CachingFileReaderTest, RepeatedReadsShareOneBuffer) {
+  const auto path = writeFile("config.json", R"({"key": "value"})");
+
+  auto first = reader_.readShared(path);
+  auto second = reader_.readShared(path);
+  ASSERT_TRUE(first.hasValue());
+  ASSERT_TRUE(second.hasValue());
+  EXPECT_EQ(*first.value(), R"({"key": "value"})");
+  EXPECT_EQ(first.value().get(), second.value().get());
+
+  auto copy = reader_.read(path);
+  ASSERT_TRUE(copy.hasValue());
+  EXPECT_EQ(copy.value(), R"({"key": "value"})");
+
+  const auto stats = reader_.stats();
+  EXPECT_EQ(stats.misses, 1U);
+  EXPECT_EQ(stats.hits, 2U);
+  EXPECT_EQ(reader_.size(), 1U);
+  EXPECT_EQ(reader_.sizeBytes(), first.value()->size());
+}
+
+TEST_F(CachingFileReaderTest, ModifiedFilesAreReadAgain) {
+  const auto path = writeFile("data.txt", "version 1");
+  ASSERT_TRUE(reader_.read(path).hasValue());
+
+  // Same size, different modification time
+  std::ofstream(path, std::ios::binary) << "version 2";
+  fs::last_write_time(path, fs::last_write_time(path) + std::chrono::seconds(5));
+  auto changed = reader_.read(path);
+  ASSERT_TRUE(changed.hasValue());
+  EXPECT_EQ(changed.value(), "version 2");
+
+  // Different size
+  std::ofstream(path, std::ios::binary) << "version 3 is longer";
+  auto grown = reader_.read(path);
+  ASSERT_TRUE(grown.hasValue());
+  EXPECT_EQ(grown.value(), "version 3 is longer");
+  EXPECT_EQ(reader_.stats().misses, 3U);
+}
+
+TEST_F(CachingFileReaderTest, ReplacedFilesAreReadAgain) {
+  const auto path = writeFile("current.txt", "old content");
+  ASSERT_TRUE(reader_.read(path).hasValue());
+
+  // Same size and mtime, but a different inode
+  const auto replacement = writeFile("next.txt", "new content");
+  fs::last_write_time(replacement, fs::last_write_time(path));
+  fs::rename(replacement, path);
+
+  auto result = reader_.read(path);
+  ASSERT_TRUE(result.hasValue());
+  EXPECT_EQ(result.value(), "new content");
+}
+
+TEST_F(CachingFileReaderTest, EvictsLeastRecentlyUsedWithinByteBudget) {
+  CachingFileReader reader(std::make_shared<FileReader>(), 100);
+  const auto a = writeFile("a.txt", std::string(40, 'a'));
+  const auto b = writeFile("b.txt", std::string(40, 'b'));
+  const auto c = writeFile("c.txt", std::string(40, 'c'));
+  const auto huge = writeFile("huge.txt", std::string(101, 'h'));
+
+  ASSERT_TRUE(reader.read(a).hasValue());
+  ASSERT_TRUE(reader.read(b).hasValue());
+  ASSERT_TRUE(reader.read(a).hasValue()); // b is now least recently used
+  ASSERT_TRUE(reader.read(c).hasValue());
+  EXPECT_EQ(reader.size(), 2U);
+  EXPECT_EQ(reader.sizeBytes(), 80U);
+  EXPECT_EQ(reader.stats().evictions, 1U);
+
+  ASSERT_TRUE(reader.read(a).hasValue());
+  EXPECT_EQ(reader.stats().hits, 2U);
+
+  // Larger than the whole budget: returned, but not cached
+  auto big = reader.read(huge);
+  ASSERT_TRUE(big.hasValue());
+  EXPECT_EQ(big.value().size(), 101U);
+  EXPECT_EQ(reader.size(), 2U);
+
+  reader.invalidate(a);
+  EXPECT_EQ(reader.size(), 1U);
+  reader.clear();
+  EXPECT_EQ(reader.size(), 0U);
+  EXPECT_EQ(reader.sizeBytes(), 0U);
+}
+
+TEST_F(CachingFileReaderTest, ErrorsAreNotCached) {
+  const auto path = testDir_ / "later.txt";
+  auto missing = reader_.read(path);
+  ASSERT_FALSE(missing.hasValue());
+  EXPECT_EQ(missing.error().code, FileErrorCode::NotFound);
+
+  writeFile("later.txt", "now here");
+  auto present = reader_.read(path);
+  ASSERT_TRUE(present.hasValue());
+  EXPECT_EQ(present.value(), "now here");
+
+  fs::remove(path);
+  EXPECT_FALSE(reader_.read(path).hasValue());
+  EXPECT_EQ(reader_.size(), 0U);
+
+  auto directory = reader_.read(testDir_);
+  ASSERT_FALSE(directory.hasValue());
+  EXPECT_EQ(directory.error().code, FileErrorCode::IsDirectory);
+}
+
+// ============================================================================
+// IFileReader behaviour
+// ============================================================================
+
+TEST_F(CachingFileReaderTest, MatchesFileReaderResults) {
+  const FileReader plain;
+  const std::vector<std::string> contents = {"", "single", "a\nb\n", "a\n\nb", "\n", "x\r\ny"};
+  for (std::size_t i = 0; i < contents.size(); ++i) {
+    const auto path = writeFile("file" + std::to_string(i) + ".txt", contents[i]);
+    for (int pass = 0; pass < 2; ++pass) {
+      EXPECT_EQ(reader_.readLines(path).value(), plain.readLines(path).value()) << i;
+      EXPECT_EQ(reader_.readBytes(path).value(), plain.readBytes(path).value()) << i;
+      EXPECT_EQ(reader_.read(path, ReadOptions{.pattern = AccessPattern::Sequential}).value(),
+                contents[i]);
+    }
+  }
+
+  const auto path = writeFile("ranges.bin", "0123456789");
+  EXPECT_EQ(reader_.readRange(path, 2, 3).value(), (std::vector<uint8_t>{'2', '3', '4'}));
+  EXPECT_TRUE(reader_.exists(path));
+  EXPECT_EQ(reader_.getSize(path).value(), 10U);
+  auto mapped = reader_.map(path);
+  ASSERT_TRUE(mapped.hasValue());
+  EXPECT_EQ(mapped.value().size(), 10U);
+}
+
+TEST_F(CachingFileReaderTest, ReadManyServesHitsAndLoadsMisses) {
+  const auto a = writeFile("a.txt", "alpha");
+  const auto b = writeFile("b.txt", "beta");
+  ASSERT_TRUE(reader_.read(a).hasValue());
+
+  const std::vector<fs::path> paths = {b, testDir_ / "missing.txt", a};
+  auto results = reader_.readMany(paths);
+  ASSERT_EQ(results.size(), 3U);
+  EXPECT_EQ(results[0].value(), "beta");
+  ASSERT_FALSE(results[1].hasValue());
+  EXPECT_EQ(results[1].error().code, FileErrorCode::NotFound);
+  EXPECT_EQ(results[2].value(), "alpha");
+
+  const auto stats = reader_.stats();
+  EXPECT_EQ(stats.hits, 1U);
+  EXPECT_EQ(stats.misses, 3U);
+  EXPECT_EQ(reader_.size(), 2U);
+}
+
+TEST_F(CachingFileReaderTest, ConcurrentReadersSeeConsistentContent) {
+  const auto path = writeFile("shared.txt", std::string(64 * 1024, 's'));
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; ++t) {
+    threads.emplace_back([&] {
+      for (int i = 0; i < 100; ++i) {
+        auto content = reader_.readShared(path);
+        ASSERT_TRUE(content.hasValue());
+        EXPECT_EQ(content.value()->size(), 64U * 1024U);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  const auto stats = reader_.stats();
+  EXPECT_EQ(stats.hits + stats.misses, 800U);
+  EXPECT_EQ(reader_.size(), 1U);
+}
+
+TEST_F(CachingFileReaderTest, FactoryCreatesCachingReader) {
+  auto reader = UtilsFactory::createCachingFileReader(1024);
+  const auto path = writeFile("factory.txt", "cached");
+  ASSERT_TRUE(reader->read(path).hasValue());
+  ASSERT_TRUE(reader->read(path).hasValue());
+  EXPECT_EQ(reader->stats().hits, 1U);
+}
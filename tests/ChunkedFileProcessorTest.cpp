@@ -0,0 +1,188 @@
+#include <Utils/Concurrency/ThreadPool.hpp>
+#include <Utils/Filesystem/ChunkedFileProcessor.hpp>
+#include <Utils/Filesystem/FileReader.hpp>
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace nixoncpp::utils;
+namespace fs = std::filesystem;
+
+// ============================================================================
+// ThreadPool tests
+// ============================================================================
+
+TEST(ThreadPoolTest, RunsAllSubmittedTasks) {
+  ThreadPool pool(4);
+  std::atomic<int> counter{0};
+  std::vector<std::future<int>> results;
+  for (int i = 0; i < 100; ++i) {
+    results.push_back(pool.submit([&counter, i] {
+      counter.fetch_add(1);
+      return i * 2;
+    }));
+  }
+
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(results[i].get(), i * 2);
+  }
+  EXPECT_EQ(counter.load(), 100);
+}
+
+TEST(ThreadPoolTest, PropagatesExceptionsThroughFuture) {
+  ThreadPool pool(2);
+  auto future = pool.submit([]() -> int { throw std::runtime_error("boom"); });
+  EXPECT_THROW(future.get(), std::runtime_error);
+}
+
+TEST(ThreadPoolTest, ZeroThreadsRunsInline) {
+  ThreadPool pool(0);
+  EXPECT_EQ(pool.threadCount(), 0);
+  auto future = pool.submit([] { return 7; });
+  EXPECT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+  EXPECT_EQ(future.get(), 7);
+}
+
+// ============================================================================
+// splitLineAligned() tests
+// ============================================================================
+
+TEST(SplitLineAlignedTest, ChunksEndAfterNewlineAndCoverInput) {
+  std::string text;
+  for (int i = 0; i < 100; ++i) {
+    text += "line " + std::to_string(i) + "\n";
+  }
+  text += "tail without newline";
+
+  const auto chunks = splitLineAligned(text, 64);
+
+  ASSERT_GT(chunks.size(), 1);
+  std::string joined;
+  for (std::size_t i = 0; i < chunks.size(); ++i) {
+    if (i + 1 < chunks.size()) {
+      EXPECT_EQ(chunks[i].back(), '\n');
+    }
+    joined += chunks[i];
+  }
+  EXPECT_EQ(joined, text);
+}
+
+TEST(SplitLineAlignedTest, LongLinesAreNotSplit) {
+  const std::string text = std::string(300, 'a') + "\nshort\n";
+  const auto chunks = splitLineAligned(text, 16);
+
+  ASSERT_EQ(chunks.size(), 2);
+  EXPECT_EQ(chunks[0].size(), 301);
+  EXPECT_EQ(chunks[1], "short\n");
+}
+
+TEST(SplitLineAlignedTest, EmptyInputHasNoChunks) {
+  EXPECT_TRUE(splitLineAligned("", 16).empty());
+}
+
+// ============================================================================
+// ChunkedFileProcessor tests
+// ============================================================================
+
+class ChunkedFileProcessorTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    testDir_ = fs::temp_directory_path() / "ChunkedFileProcessorTest";
+    fs::create_directories(testDir_);
+    dataFile_ = testDir_ / "data.txt";
+
+    std::ofstream out(dataFile_);
+    for (int i = 1; i <= 10000; ++i) {
+      out << i << "\n";
+    }
+  }
+
+  void TearDown() override {
+    std::error_code ec;
+    fs::remove_all(testDir_, ec);
+  }
+
+  static long long sumLines(std::string_view chunk) {
+    long long sum = 0;
+    for (std::string_view line : LineSplitter(chunk)) {
+      sum += std::stoll(std::string(line));
+    }
+    return sum;
+  }
+
+  fs::path testDir_;
+  fs::path dataFile_;
+};
+
+TEST_F(ChunkedFileProcessorTest, UnorderedReductionCountsEveryLine) {
+  ChunkedFileProcessor processor(std::make_shared<FileReader>(), std::make_shared<ThreadPool>(4));
+
+  auto result = processor.process(
+      dataFile_, 0LL, sumLines, [](long long acc, long long part) { return acc + part; },
+      ChunkOptions{.chunkSize = 1024, .order = ResultOrder::Unordered});
+
+  ASSERT_TRUE(result.hasValue());
+  EXPECT_EQ(result.value(), 10000LL * 10001 / 2);
+}
+
+TEST_F(ChunkedFileProcessorTest, OrderedReductionPreservesFileOrder) {
+  ChunkedFileProcessor processor(std::make_shared<FileReader>(), std::make_shared<ThreadPool>(4));
+
+  auto result = processor.process(
+      dataFile_, std::vector<std::string>{},
+      [](std::string_view chunk) {
+        std::vector<std::string> lines;
+        for (std::string_view line : LineSplitter(chunk)) {
+          if (line.back() == '0' && line.size() > 3) { // Filter: multiples of 10 above 999
+            lines.emplace_back(line);
+          }
+        }
+        return lines;
+      },
+      [](std::vector<std::string> acc, std::vector<std::string> part) {
+        acc.insert(acc.end(), part.begin(), part.end());
+        return acc;
+      },
+      ChunkOptions{.chunkSize = 512, .order = ResultOrder::Ordered});
+
+  ASSERT_TRUE(result.hasValue());
+  ASSERT_EQ(result.value().size(), 901);
+  EXPECT_EQ(result.value().front(), "1000");
+  EXPECT_EQ(result.value().back(), "10000");
+  EXPECT_TRUE(std::is_sorted(result.value().begin(), result.value().end(),
+                             [](const std::string &a, const std::string &b) {
+                               return std::stoi(a) < std::stoi(b);
+                             }));
+}
+
+TEST_F(ChunkedFileProcessorTest, MapExceptionIsRethrownAfterAllChunks) {
+  ChunkedFileProcessor processor(std::make_shared<FileReader>(), std::make_shared<ThreadPool>(2));
+
+  EXPECT_THROW(
+      (void)processor.process(
+          dataFile_, 0,
+          [](std::string_view chunk) -> int {
+            if (chunk.find("5000\n") != std::string_view::npos) {
+              throw std::runtime_error("bad chunk");
+            }
+            return 1;
+          },
+          [](int acc, int part) { return acc + part; }, ChunkOptions{.chunkSize = 256}),
+      std::runtime_error);
+}
+
+TEST_F(ChunkedFileProcessorTest, MissingFileReturnsError) {
+  ChunkedFileProcessor processor(std::make_shared<FileReader>(), std::make_shared<ThreadPool>(1));
+
+  auto result = processor.process(
+      testDir_ / "missing.txt", 0, [](std::string_view) { return 1; },
+      [](int acc, int part) { return acc + part; });
+
+  ASSERT_FALSE(result.hasValue());
+  EXPECT_EQ(result.error().code, FileErrorCode::NotFound);
+}
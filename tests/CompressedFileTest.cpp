@@ -0,0 +1,278 @@
+#include <Utils/Filesystem/CompressedFileReader.hpp>
+#include <Utils/Filesystem/CompressedFileWriter.hpp>
+#include <Utils/Filesystem/Compression.hpp>
+#include <Utils/UtilsFactory.hpp>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace nixoncpp::utils;
+namespace fs = std::filesystem;
+
+namespace {
+  std::span<const std::byte> bytesOf(const std::string &data) {
+    return std::as_bytes(std::span(data.data(), data.size()));
+  }
+
+  // Compressible but not trivially repetitive text
+  std::string textContent(std::size_t lineCount) {
+    std::mt19937 engine(static_cast<unsigned>(lineCount));
+    std::uniform_int_distribution<int> word(0, 999);
+    std::string content;
+    for (std::size_t line = 0; line < lineCount; ++line) {
+      content += "line " + std::to_string(line) + " value " + std::to_string(word(engine)) + '\n';
+    }
+    return content;
+  }
+
+  std::string rawContent(const fs::path &path) {
+    std::ifstream file(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+  }
+} // namespace
+
+class CompressedFileTest : public ::testing::TestWithParam<CompressionFormat> {
+protected:
+  void SetUp() override {
+    if (!isCompressionAvailable(GetParam())) {
+      GTEST_SKIP() << "Built without the codec";
+    }
+    testDir_ = fs::temp_directory_path() / "CompressedFileTest";
+    fs::remove_all(testDir_);
+    fs::create_directories(testDir_);
+  }
+
+  void TearDown() override {
+    std::error_code ec;
+    fs::remove_all(testDir_, ec);
+  }
+
+  fs::path pathFor(const std::string &stem) const {
+    return testDir_ / (stem + (GetParam() == CompressionFormat::Gzip ? ".gz" : ".zst"));
+  }
+
+  fs::path testDir_;
+  CompressedFileReader reader_{UtilsFactory::createFileReader()};
+  CompressedFileWriter writer_{UtilsFactory::createFileWriter()};
+};
+
+TEST_P(CompressedFileTest, RoundTripsThroughWriterAndReader) {
+  const auto path = pathFor("data");
+  const auto content = textContent(1000);
+
+  ASSERT_TRUE(writer_.write(path, content).hasValue());
+
+  const auto raw = rawContent(path);
+  EXPECT_LT(raw.size(), content.size());
+  EXPECT_EQ(detectCompression(bytesOf(raw)), GetParam());
+
+  auto read = reader_.read(path);
+  ASSERT_TRUE(read.hasValue()) << read.error().message;
+  EXPECT_EQ(read.value(), content);
+
+  auto bytes = reader_.readBytes(path);
+  ASSERT_TRUE(bytes.hasValue());
+  EXPECT_EQ(std::string(bytes.value().begin(), bytes.value().end()), content);
+}
+
+TEST_P(CompressedFileTest, DetectsFormatFromMagicBytesNotName) {
+  const auto path = testDir_ / "misnamed.txt";
+  const auto content = textContent(50);
+  auto encoded = compress(bytesOf(content), GetParam());
+  ASSERT_TRUE(encoded.hasValue());
+  std::ofstream(path, std::ios::binary) << encoded.value();
+
+  auto format = detectCompression(path);
+  ASSERT_TRUE(format.hasValue());
+  EXPECT_EQ(format.value(), GetParam());
+
+  auto read = reader_.read(path);
+  ASSERT_TRUE(read.hasValue());
+  EXPECT_EQ(read.value(), content);
+}
+
+TEST_P(CompressedFileTest, ReadsLinesEagerlyAndLazily) {
+  const auto path = pathFor("lines");
+  const std::vector<std::string> lines = {"alpha", "", "gamma", "delta"};
+  ASSERT_TRUE(writer_.writeLines(path, lines).hasValue());
+
+  auto eager = reader_.readLines(path);
+  ASSERT_TRUE(eager.hasValue());
+  EXPECT_EQ(eager.value(), lines);
+
+  // A chunk smaller than a line exercises refills across decoder reads
+  auto lazy = reader_.lines(path, 3);
+  ASSERT_TRUE(lazy.hasValue());
+  std::vector<std::string> streamed;
+  for (std::string_view line : lazy.value()) {
+    streamed.emplace_back(line);
+  }
+  EXPECT_EQ(streamed, lines);
+  EXPECT_FALSE(lazy.value().error().has_value());
+}
+
+TEST_P(CompressedFileTest, AppendAddsConcatenatedMember) {
+  const auto path = pathFor("append");
+  ASSERT_TRUE(writer_.write(path, std::string("first\n")).hasValue());
+  ASSERT_TRUE(writer_.write(path, std::string("second\n"), true).hasValue());
+
+  auto read = reader_.read(path);
+  ASSERT_TRUE(read.hasValue());
+  EXPECT_EQ(read.value(), "first\nsecond\n");
+}
+
+TEST_P(CompressedFileTest, StreamsLargeFilesInBoundedChunks) {
+  const auto path = pathFor("large");
+  const auto content = textContent(200000);
+  {
+    auto writer = CompressingWriter::create(path, GetParam());
+    ASSERT_TRUE(writer.hasValue());
+    for (std::size_t offset = 0; offset < content.size(); offset += 100000) {
+      const auto piece = std::string_view(content).substr(offset, 100000);
+      ASSERT_TRUE(writer.value().write(std::as_bytes(std::span(piece))).hasValue());
+    }
+    ASSERT_TRUE(writer.value().finish().hasValue());
+    EXPECT_FALSE(writer.value().write(bytesOf(content)).hasValue());
+  }
+
+  auto decoder = DecompressingReader::open(path);
+  ASSERT_TRUE(decoder.hasValue());
+  EXPECT_EQ(decoder.value().format(), GetParam());
+  std::string decoded;
+  std::vector<std::byte> chunk(4096);
+  for (;;) {
+    auto got = decoder.value().read(chunk);
+    ASSERT_TRUE(got.hasValue()) << got.error().message;
+    if (got.value() == 0) {
+      break;
+    }
+    EXPECT_LE(got.value(), chunk.size());
+    decoded.append(reinterpret_cast<const char *>(chunk.data()), got.value());
+  }
+  EXPECT_EQ(decoded, content);
+}
+
+TEST_P(CompressedFileTest, ReportsTruncatedAndCorruptData) {
+  const auto content = textContent(5000);
+  auto encoded = compress(bytesOf(content), GetParam());
+  ASSERT_TRUE(encoded.hasValue());
+
+  const auto truncated = pathFor("truncated");
+  const auto &full = encoded.value();
+  std::ofstream(truncated, std::ios::binary) << full.substr(0, full.size() / 2);
+  auto read = reader_.read(truncated);
+  ASSERT_FALSE(read.hasValue());
+  EXPECT_EQ(read.error().code, FileErrorCode::ReadError);
+
+  auto lazy = reader_.lines(truncated);
+  ASSERT_TRUE(lazy.hasValue());
+  std::string_view line;
+  while (lazy.value().next(line)) {
+  }
+  EXPECT_TRUE(lazy.value().error().has_value());
+
+  const auto corrupt = pathFor("corrupt");
+  auto damaged = encoded.value();
+  for (std::size_t i = 16; i < damaged.size() - 16; i += 7) {
+    damaged[i] = static_cast<char>(damaged[i] ^ 0x5A);
+  }
+  std::ofstream(corrupt, std::ios::binary) << damaged;
+  EXPECT_FALSE(reader_.read(corrupt).hasValue());
+}
+
+TEST_P(CompressedFileTest, WritesAtomically) {
+  const auto path = pathFor("atomic");
+  const auto content = textContent(100);
+  ASSERT_TRUE(writer_.writeAtomic(path, content).hasValue());
+
+  EXPECT_EQ(detectCompression(bytesOf(rawContent(path))), GetParam());
+  auto read = reader_.read(path);
+  ASSERT_TRUE(read.hasValue());
+  EXPECT_EQ(read.value(), content);
+
+  EXPECT_FALSE(writer_.openAppender(path).hasValue());
+}
+
+TEST_P(CompressedFileTest, CompressesWithWorkerThreads) {
+  const auto path = pathFor("threaded");
+  const auto content = textContent(100000);
+  CompressedFileWriter writer(UtilsFactory::createFileWriter(),
+                              CompressionOptions{.level = 3, .threads = 2});
+
+  ASSERT_TRUE(writer.write(path, content).hasValue());
+
+  auto read = reader_.read(path);
+  ASSERT_TRUE(read.hasValue());
+  EXPECT_EQ(read.value(), content);
+}
+
+INSTANTIATE_TEST_SUITE_P(Formats, CompressedFileTest,
+                         ::testing::Values(CompressionFormat::Gzip, CompressionFormat::Zstd),
+                         [](const auto &info) {
+                           return info.param == CompressionFormat::Gzip ? "Gzip" : "Zstd";
+                         });
+
+class CompressedPlainFileTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    testDir_ = fs::temp_directory_path() / "CompressedPlainFileTest";
+    fs::remove_all(testDir_);
+    fs::create_directories(testDir_);
+  }
+
+  void TearDown() override {
+    std::error_code ec;
+    fs::remove_all(testDir_, ec);
+  }
+
+  fs::path testDir_;
+};
+
+TEST_F(CompressedPlainFileTest, PassesPlainFilesThrough) {
+  const auto path = testDir_ / "plain.txt";
+  auto writer = UtilsFactory::createCompressedFileWriter();
+  auto reader = UtilsFactory::createCompressedFileReader();
+
+  ASSERT_TRUE(writer->write(path, std::string("one\ntwo\n")).hasValue());
+  EXPECT_EQ(rawContent(path), "one\ntwo\n");
+
+  auto read = reader->read(path);
+  ASSERT_TRUE(read.hasValue());
+  EXPECT_EQ(read.value(), "one\ntwo\n");
+  auto lines = reader->readLines(path);
+  ASSERT_TRUE(lines.hasValue());
+  EXPECT_EQ(lines.value(), (std::vector<std::string>{"one", "two"}));
+
+  auto missing = reader->read(testDir_ / "missing.gz");
+  ASSERT_FALSE(missing.hasValue());
+  EXPECT_EQ(missing.error().code, FileErrorCode::NotFound);
+}
+
+TEST_F(CompressedPlainFileTest, DetectsFormats) {
+  EXPECT_EQ(compressionForExtension("a/b.gz"), CompressionFormat::Gzip);
+  EXPECT_EQ(compressionForExtension("a/b.zst"), CompressionFormat::Zstd);
+  EXPECT_EQ(compressionForExtension("a/b.txt"), CompressionFormat::None);
+
+  const std::string gzipMagic("\x1f\x8b\x08\x00", 4);
+  const std::string zstdMagic("\x28\xb5\x2f\xfd", 4);
+  EXPECT_EQ(detectCompression(bytesOf(gzipMagic)), CompressionFormat::Gzip);
+  EXPECT_EQ(detectCompression(bytesOf(zstdMagic)), CompressionFormat::Zstd);
+  EXPECT_EQ(detectCompression(bytesOf(std::string("\x1f"))), CompressionFormat::None);
+  EXPECT_EQ(detectCompression(bytesOf(std::string("text"))), CompressionFormat::None);
+}
+
+TEST_F(CompressedPlainFileTest, ReportsUnavailableFormats) {
+  for (const auto format : {CompressionFormat::Gzip, CompressionFormat::Zstd}) {
+    if (isCompressionAvailable(format)) {
+      continue;
+    }
+    auto writer = CompressingWriter::create(testDir_ / "out", format);
+    ASSERT_FALSE(writer.hasValue());
+    EXPECT_EQ(writer.error().code, FileErrorCode::Unknown);
+  }
+  EXPECT_TRUE(isCompressionAvailable(CompressionFormat::None));
+}
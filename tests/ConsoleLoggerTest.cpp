@@ -1,9 +1,14 @@
 #include "../src/lib/Utils/Logger/ConsoleLogger.hpp"
 #include <chrono>
+#include <filesystem>
 #include <fstream>
 #include <gtest/gtest.h>
+#include <iomanip>
 #include <memory>
+#include <sstream>
+#include <string>
 #include <thread>
+#include <vector>
 
 using namespace nixoncpp::logging;
 
@@ -265,3 +270,301 @@ TEST_F(ConsoleLoggerTest, LongMessages) {
   EXPECT_NO_THROW(logger->infoStream() << longMessage);
   EXPECT_NO_THROW(logger->infoFmt("Long: {}", longMessage));
 }
+
+TEST_F(ConsoleLoggerTest, LevelDoesNotFilterOutput) {
+  logger->setLevel(Level::LOG_WARNING);
+  ASSERT_TRUE(logger->enableFileLogging("test_log.txt"));
+
+  logger->debug("Debug message");
+  logger->info("Info message");
+  logger->warning("Warning message");
+  logger->disableFileLogging();
+
+  std::ifstream file("test_log.txt");
+  std::string line;
+  int lineCount = 0;
+  while (std::getline(file, line)) {
+    lineCount++;
+  }
+  EXPECT_EQ(lineCount, 3);
+}
+
+TEST_F(ConsoleLoggerTest, HeaderTogglesApplyToOutput) {
+  logger->setAppPrefix("App");
+  logger->noHeader(true);
+  ASSERT_TRUE(logger->enableFileLogging("test_log.txt"));
+  logger->info("Plain message", "Caller");
+
+  logger->noHeader(false);
+  logger->showHeaderTime(false);
+  logger->info("Decorated message", "Caller");
+  logger->disableFileLogging();
+
+  std::ifstream file("test_log.txt");
+  std::string line;
+  ASSERT_TRUE(std::getline(file, line));
+  EXPECT_EQ(line, "Plain message");
+  ASSERT_TRUE(std::getline(file, line));
+  EXPECT_EQ(line, "[TestLogger][App][INF][Caller] Decorated message");
+}
+
+TEST_F(ConsoleLoggerTest, FormatSnapshotIsImmutable) {
+  auto before = logger->getFormat();
+  logger->setAppPrefix("Changed");
+  auto after = logger->getFormat();
+
+  EXPECT_NE(before, after);
+  EXPECT_EQ(before->appPrefix, "");
+  EXPECT_EQ(after->appPrefix, "Changed");
+  EXPECT_EQ(logger->getAppPrefix(), "Changed");
+}
+
+TEST_F(ConsoleLoggerTest, ConcurrentConfigurationChanges) {
+  constexpr int kIterations = 200;
+  ASSERT_TRUE(logger->enableFileLogging("test_log.txt"));
+
+  std::thread writer([this] {
+    for (int i = 0; i < kIterations; ++i) {
+      logger->showHeaderTime(i % 2 == 0);
+      logger->setAppPrefix(i % 2 == 0 ? "Even" : "Odd");
+      logger->setLevel(Level::LOG_INFO);
+    }
+  });
+  std::thread reader([this] {
+    for (int i = 0; i < kIterations; ++i) {
+      logger->info("Concurrent message");
+      EXPECT_EQ(logger->getLevel(), Level::LOG_INFO);
+      EXPECT_FALSE(logger->getAppPrefix() == "Invalid");
+    }
+  });
+  writer.join();
+  reader.join();
+  logger->disableFileLogging();
+
+  std::ifstream file("test_log.txt");
+  std::string line;
+  int lineCount = 0;
+  while (std::getline(file, line)) {
+    lineCount++;
+  }
+  EXPECT_EQ(lineCount, kIterations);
+}
+
+// ============================================================================
+// Sidecar log index tests
+// ============================================================================
+
+class LogIndexTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    logPath_ = std::filesystem::temp_directory_path() /
+               ("nixoncpp_log_index_" +
+                std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()) +
+                ".log");
+    std::filesystem::remove(logPath_);
+    std::filesystem::remove(LogIndexWriter::indexPathFor(logPath_));
+  }
+
+  void TearDown() override {
+    std::filesystem::remove(logPath_);
+    std::filesystem::remove(LogIndexWriter::indexPathFor(logPath_));
+  }
+
+  std::vector<std::string> query(const LogQuery &query, LogQueryStats *stats = nullptr) const {
+    std::vector<std::string> lines;
+    auto result = LogIndexReader::query(logPath_, query, [&lines](std::string_view line) {
+      lines.emplace_back(line);
+    });
+    EXPECT_TRUE(result.hasValue());
+    if (stats != nullptr && result.hasValue()) {
+      *stats = result.value();
+    }
+    return lines;
+  }
+
+  std::filesystem::path logPath_;
+};
+
+TEST_F(LogIndexTest, LevelQueryReadsOnlyMatchingBlocks) {
+  ConsoleLogger logger;
+  logger.noHeader(true);
+  ASSERT_TRUE(logger.enableLogIndex(4));
+  ASSERT_TRUE(logger.enableFileLogging(logPath_.string()));
+
+  for (int i = 0; i < 22; ++i) {
+    if (i == 9) {
+      logger.error("line " + std::to_string(i));
+    } else {
+      logger.info("line " + std::to_string(i));
+    }
+  }
+  logger.disableFileLogging();
+
+  LogQuery errors;
+  errors.levelMask = levelBit(Level::LOG_ERROR);
+  LogQueryStats stats;
+  const auto lines = query(errors, &stats);
+
+  EXPECT_EQ(stats.blocksTotal, 6);
+  EXPECT_EQ(stats.blocksRead, 1);
+  ASSERT_EQ(lines.size(), 4);
+  EXPECT_EQ(lines.front(), "line 8");
+  EXPECT_EQ(lines.back(), "line 11");
+
+  EXPECT_EQ(query(LogQuery{}).size(), 22);
+}
+
+TEST_F(LogIndexTest, TimeQuerySkipsBlocksOutsideWindow) {
+  using std::chrono::seconds;
+  const auto base = std::chrono::system_clock::now();
+  const auto ns = [base](int offsetSeconds) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               (base + seconds(offsetSeconds)).time_since_epoch())
+        .count();
+  };
+
+  {
+    std::ofstream log(logPath_, std::ios::binary);
+    auto index = LogIndexWriter::open(logPath_, 2);
+    ASSERT_TRUE(index.hasValue());
+    std::uint64_t offset = 0;
+    for (int i = 0; i < 8; ++i) {
+      const std::string line = "record " + std::to_string(i) + "\n";
+      log << line;
+      index.value()->append(Level::LOG_INFO, ns(i * 10), offset, line.size());
+      offset += line.size();
+    }
+  }
+
+  LogQuery window;
+  window.from = base + seconds(25);
+  window.to = base + seconds(45);
+  LogQueryStats stats;
+  const auto lines = query(window, &stats);
+
+  EXPECT_EQ(stats.blocksRead, 2);
+  ASSERT_EQ(lines.size(), 4);
+  EXPECT_EQ(lines.front(), "record 2");
+  EXPECT_EQ(lines.back(), "record 5");
+}
+
+TEST_F(LogIndexTest, UnindexedTailIsAlwaysReturned) {
+  ConsoleLogger logger;
+  logger.noHeader(true);
+  ASSERT_TRUE(logger.enableLogIndex(2));
+  ASSERT_TRUE(logger.enableFileLogging(logPath_.string()));
+  logger.info("indexed 1");
+  logger.info("indexed 2");
+  logger.info("pending");
+
+  // The partial block has not been written yet; its bytes are delivered as tail
+  LogQuery none;
+  none.from = std::chrono::system_clock::now() + std::chrono::hours(1);
+  const auto lines = query(none);
+  ASSERT_EQ(lines.size(), 1);
+  EXPECT_EQ(lines.front(), "pending");
+}
+
+TEST_F(LogIndexTest, LevelQueryFiltersLinesInsideBlocks) {
+  ConsoleLogger logger;
+  logger.setColorEnabled(false);
+  ASSERT_TRUE(logger.enableLogIndex(4));
+  ASSERT_TRUE(logger.enableFileLogging(logPath_.string()));
+  for (int i = 0; i < 8; ++i) {
+    if (i == 5) {
+      logger.error("line " + std::to_string(i));
+    } else {
+      logger.info("line " + std::to_string(i));
+    }
+  }
+  logger.disableFileLogging();
+
+  LogQuery errors;
+  errors.levelMask = levelBit(Level::LOG_ERROR);
+  LogQueryStats stats;
+  const auto lines = query(errors, &stats);
+
+  EXPECT_EQ(stats.blocksRead, 1);
+  ASSERT_EQ(lines.size(), 1);
+  EXPECT_NE(lines.front().find("[ERR] line 5"), std::string::npos);
+}
+
+TEST_F(LogIndexTest, TimeQueryFiltersLinesInsideBlocks) {
+  using std::chrono::seconds;
+  const auto base = std::chrono::floor<seconds>(std::chrono::system_clock::now());
+  const auto ns = [base](int offsetSeconds) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               (base + seconds(offsetSeconds)).time_since_epoch())
+        .count();
+  };
+  const auto header = [base](int offsetSeconds) {
+    const auto time = std::chrono::system_clock::to_time_t(base + seconds(offsetSeconds));
+    std::tm local{};
+#ifdef _WIN32
+    localtime_s(&local, &time);
+#else
+    localtime_r(&time, &local);
+#endif
+    std::ostringstream text;
+    text << "[" << std::put_time(&local, "%Y-%m-%d %H:%M:%S") << "][INF] ";
+    return text.str();
+  };
+
+  {
+    std::ofstream log(logPath_, std::ios::binary);
+    auto index = LogIndexWriter::open(logPath_, 4);
+    ASSERT_TRUE(index.hasValue());
+    std::uint64_t offset = 0;
+    for (int i = 0; i < 8; ++i) {
+      const std::string line = header(i * 10) + "record " + std::to_string(i) + "\n";
+      log << line;
+      index.value()->append(Level::LOG_INFO, ns(i * 10), offset, line.size());
+      offset += line.size();
+    }
+  }
+
+  LogQuery window;
+  window.from = base + seconds(25);
+  window.to = base + seconds(45);
+  LogQueryStats stats;
+  const auto lines = query(window, &stats);
+
+  EXPECT_EQ(stats.blocksRead, 2);
+  ASSERT_EQ(lines.size(), 2);
+  EXPECT_EQ(lines.front(), header(30) + "record 3");
+  EXPECT_EQ(lines.back(), header(40) + "record 4");
+}
+
+TEST_F(LogIndexTest, LinesBeforeTheIndexAreFiltered) {
+  ConsoleLogger logger;
+  logger.setColorEnabled(false);
+  ASSERT_TRUE(logger.enableFileLogging(logPath_.string()));
+  logger.info("before index");
+  logger.error("error before index");
+  ASSERT_TRUE(logger.enableLogIndex(2));
+  logger.info("indexed 1");
+  logger.error("indexed 2");
+  logger.disableFileLogging();
+
+  LogQuery errors;
+  errors.levelMask = levelBit(Level::LOG_ERROR);
+  LogQueryStats stats;
+  const auto lines = query(errors, &stats);
+
+  // The lines before the index are read, but not counted as blocks
+  EXPECT_EQ(stats.blocksTotal, 1);
+  EXPECT_EQ(stats.blocksRead, 1);
+  EXPECT_GT(stats.unindexedBytes, 0U);
+  EXPECT_EQ(stats.bytesRead, std::filesystem::file_size(logPath_));
+  ASSERT_EQ(lines.size(), 2);
+  EXPECT_NE(lines.front().find("error before index"), std::string::npos);
+  EXPECT_NE(lines.back().find("indexed 2"), std::string::npos);
+  EXPECT_EQ(query(LogQuery{}).size(), 4);
+}
+
+TEST_F(LogIndexTest, MissingIndexIsReported) {
+  std::ofstream(logPath_) << "no index\n";
+  auto result = LogIndexReader::query(logPath_, LogQuery{}, [](std::string_view) {});
+  ASSERT_FALSE(result.hasValue());
+  EXPECT_EQ(result.error().code, nixoncpp::utils::FileErrorCode::NotFound);
+}
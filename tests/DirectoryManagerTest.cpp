@@ -0,0 +1,588 @@
+#include <Utils/Concurrency/ThreadPool.hpp>
+#include <Utils/Filesystem/DirectoryManager.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <gtest/gtest.h>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace nixoncpp::utils;
+namespace fs = std::filesystem;
+
+class DirectoryManagerTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    testDir_ = fs::temp_directory_path() / "DirectoryManagerTest";
+    fs::remove_all(testDir_);
+    fs::create_directories(testDir_);
+  }
+
+  void TearDown() override {
+    std::error_code ec;
+    fs::remove_all(testDir_, ec);
+  }
+
+  static std::string contentOf(const fs::path &path) {
+    std::ifstream file(path, std::ios::binary);
+    std::ostringstream buffer;
+    buffer << file.rdbuf();
+    return buffer.str();
+  }
+
+  fs::path writeFile(const fs::path &relative, const std::string &content) {
+    const auto path = testDir_ / relative;
+    fs::create_directories(path.parent_path());
+    std::ofstream(path, std::ios::binary) << content;
+    return path;
+  }
+
+  // src/{a.txt, empty/, sub/b.txt, sub/deeper/c.txt, link -> a.txt}
+  fs::path makeTree() {
+    writeFile("src/a.txt", "alpha");
+    writeFile("src/sub/b.txt", std::string(200 * 1024, 'b'));
+    writeFile("src/sub/deeper/c.txt", "");
+    fs::create_directories(testDir_ / "src" / "empty");
+    fs::create_symlink("a.txt", testDir_ / "src" / "link");
+    return testDir_ / "src";
+  }
+
+  void expectTreeCopied(const fs::path &destination) {
+    EXPECT_EQ(contentOf(destination / "a.txt"), "alpha");
+    EXPECT_EQ(contentOf(destination / "sub" / "b.txt"), std::string(200 * 1024, 'b'));
+    EXPECT_TRUE(fs::is_regular_file(destination / "sub" / "deeper" / "c.txt"));
+    EXPECT_TRUE(fs::is_directory(destination / "empty"));
+    ASSERT_TRUE(fs::is_symlink(destination / "link"));
+    EXPECT_EQ(fs::read_symlink(destination / "link"), "a.txt");
+  }
+
+  fs::path testDir_;
+};
+
+// ============================================================================
+// copyTree() tests
+// ============================================================================
+
+TEST_F(DirectoryManagerTest, CopyTreeCopiesFilesDirectoriesAndSymlinks) {
+  const DirectoryManager manager;
+  const auto destination = testDir_ / "dst";
+  auto copied = manager.copyTree(makeTree(), destination);
+  ASSERT_TRUE(copied.hasValue()) << copied.error().toString();
+  // 3 directories, 3 files, 1 symlink
+  EXPECT_EQ(copied.value(), 7U);
+  expectTreeCopied(destination);
+}
+
+TEST_F(DirectoryManagerTest, CopyTreeRunsFileCopiesOnThePool) {
+  const DirectoryManager manager(std::make_shared<ThreadPool>(4));
+  const auto source = makeTree();
+  for (int i = 0; i < 50; ++i) {
+    writeFile("src/many/file" + std::to_string(i) + ".txt", std::to_string(i));
+  }
+  const auto destination = testDir_ / "parallel";
+  auto copied = manager.copyTree(source, destination);
+  ASSERT_TRUE(copied.hasValue()) << copied.error().toString();
+  EXPECT_EQ(copied.value(), 58U);
+  expectTreeCopied(destination);
+  for (int i = 0; i < 50; ++i) {
+    EXPECT_EQ(contentOf(destination / "many" / ("file" + std::to_string(i) + ".txt")),
+              std::to_string(i));
+  }
+}
+
+TEST_F(DirectoryManagerTest, CopyTreeMergesAndHonoursOverwrite) {
+  const DirectoryManager manager;
+  const auto source = makeTree();
+  const auto destination = testDir_ / "dst";
+  writeFile("dst/a.txt", "old");
+  writeFile("dst/keep.txt", "kept");
+
+  auto refused = manager.copyTree(source, destination);
+  ASSERT_FALSE(refused.hasValue());
+  EXPECT_EQ(refused.error().code, FileErrorCode::AlreadyExists);
+
+  auto copied = manager.copyTree(source, destination, CopyOptions{.overwrite = true});
+  ASSERT_TRUE(copied.hasValue()) << copied.error().toString();
+  expectTreeCopied(destination);
+  EXPECT_EQ(contentOf(destination / "keep.txt"), "kept");
+}
+
+TEST_F(DirectoryManagerTest, CopyTreeRejectsInvalidArguments) {
+  const DirectoryManager manager;
+  const auto source = makeTree();
+
+  auto missing = manager.copyTree(testDir_ / "missing", testDir_ / "dst");
+  ASSERT_FALSE(missing.hasValue());
+  EXPECT_EQ(missing.error().code, FileErrorCode::NotFound);
+
+  auto notDirectory = manager.copyTree(source / "a.txt", testDir_ / "dst");
+  ASSERT_FALSE(notDirectory.hasValue());
+  EXPECT_EQ(notDirectory.error().code, FileErrorCode::NotDirectory);
+
+  auto intoItself = manager.copyTree(source, source / "sub" / "copy");
+  ASSERT_FALSE(intoItself.hasValue());
+  EXPECT_EQ(intoItself.error().code, FileErrorCode::InvalidPath);
+  EXPECT_FALSE(fs::exists(source / "sub" / "copy"));
+}
+
+// ============================================================================
+// walk() tests
+// ============================================================================
+
+namespace {
+  struct WalkedEntry {
+    std::string path;
+    EntryType type;
+    std::size_t depth;
+
+    bool operator==(const WalkedEntry &) const = default;
+  };
+
+  std::vector<WalkedEntry> relativeSorted(const std::vector<DirectoryEntry> &entries,
+                                          const fs::path &root) {
+    std::vector<WalkedEntry> relative;
+    for (const auto &entry : entries) {
+      relative.push_back({entry.path.lexically_relative(root).generic_string(), entry.type,
+                          entry.depth});
+    }
+    std::sort(relative.begin(), relative.end(),
+              [](const auto &a, const auto &b) { return a.path < b.path; });
+    return relative;
+  }
+} // namespace
+
+TEST_F(DirectoryManagerTest, WalkReportsTypesAndDepths) {
+  const DirectoryManager manager;
+  const auto root = makeTree();
+  auto walked = manager.walk(root);
+  ASSERT_TRUE(walked.hasValue()) << walked.error().toString();
+
+  const std::vector<WalkedEntry> expected = {
+      {"a.txt", EntryType::Regular, 0},
+      {"empty", EntryType::Directory, 0},
+      {"link", EntryType::Symlink, 0},
+      {"sub", EntryType::Directory, 0},
+      {"sub/b.txt", EntryType::Regular, 1},
+      {"sub/deeper", EntryType::Directory, 1},
+      {"sub/deeper/c.txt", EntryType::Regular, 2},
+  };
+  EXPECT_EQ(relativeSorted(walked.value(), root), expected);
+  EXPECT_FALSE(walked.value().front().stat.has_value());
+}
+
+TEST_F(DirectoryManagerTest, WalkHonoursDepthLimitAndSymlinkPolicy) {
+  const DirectoryManager manager;
+  const auto root = makeTree();
+  fs::create_directory_symlink("sub", root / "sublink");
+  fs::create_directory_symlink(".", root / "sub" / "loop");
+
+  auto shallow = manager.walk(root, WalkOptions{.maxDepth = 0});
+  ASSERT_TRUE(shallow.hasValue());
+  EXPECT_EQ(shallow.value().size(), 5U);
+
+  auto skipped = manager.walk(root, WalkOptions{.symlinks = SymlinkPolicy::Skip});
+  ASSERT_TRUE(skipped.hasValue());
+  for (const auto &entry : skipped.value()) {
+    EXPECT_NE(entry.type, EntryType::Symlink) << entry.path;
+  }
+
+  // sublink is descended into once, the loop back to sub is cut on both paths
+  auto followed = manager.walk(root, WalkOptions{.symlinks = SymlinkPolicy::Follow});
+  ASSERT_TRUE(followed.hasValue()) << followed.error().toString();
+  const auto relative = relativeSorted(followed.value(), root);
+  const auto has = [&](const std::string &path) {
+    return std::ranges::any_of(relative, [&](const auto &entry) { return entry.path == path; });
+  };
+  EXPECT_TRUE(has("sublink/deeper/c.txt"));
+  EXPECT_TRUE(has("sub/loop"));
+  EXPECT_FALSE(has("sub/loop/b.txt"));
+  EXPECT_EQ(relative.size(), 13U);
+}
+
+TEST_F(DirectoryManagerTest, WalkCollectsStatData) {
+  const DirectoryManager manager;
+  const auto root = makeTree();
+  auto walked = manager.walk(root, WalkOptions{.withStat = true});
+  ASSERT_TRUE(walked.hasValue());
+
+  for (const auto &entry : walked.value()) {
+    ASSERT_TRUE(entry.stat.has_value()) << entry.path;
+    EXPECT_GT(entry.stat->modifiedNs, 0);
+    if (entry.path.filename() == "b.txt") {
+      EXPECT_EQ(entry.stat->size, 200U * 1024U);
+    } else if (entry.path.filename() == "c.txt") {
+      EXPECT_EQ(entry.stat->size, 0U);
+    }
+  }
+}
+
+TEST_F(DirectoryManagerTest, WalkInParallelMatchesRecursiveIterator) {
+  const DirectoryManager manager(std::make_shared<ThreadPool>(4));
+  for (int dir = 0; dir < 20; ++dir) {
+    for (int file = 0; file < 20; ++file) {
+      writeFile("tree/d" + std::to_string(dir) + "/n" + std::to_string(dir % 3) + "/f" +
+                    std::to_string(file),
+                "");
+    }
+  }
+  const auto root = testDir_ / "tree";
+
+  std::vector<fs::path> expected(fs::recursive_directory_iterator(root), {});
+  std::sort(expected.begin(), expected.end());
+
+  auto listed = manager.listEntriesRecursive(root);
+  ASSERT_TRUE(listed.hasValue());
+  EXPECT_EQ(listed.value(), expected);
+
+  auto missing = manager.walk(testDir_ / "missing");
+  ASSERT_FALSE(missing.hasValue());
+  EXPECT_EQ(missing.error().code, FileErrorCode::NotFound);
+
+  auto notDirectory = manager.walk(makeTree() / "a.txt");
+  ASSERT_FALSE(notDirectory.hasValue());
+  EXPECT_EQ(notDirectory.error().code, FileErrorCode::NotDirectory);
+}
+
+TEST_F(DirectoryManagerTest, ParallelWalkRethrowsCallbackExceptions) {
+  const DirectoryManager manager(std::make_shared<ThreadPool>(4));
+  for (int dir = 0; dir < 20; ++dir) {
+    writeFile("tree/d" + std::to_string(dir) + "/sub/f", "");
+  }
+  const auto root = testDir_ / "tree";
+
+  std::atomic<int> calls{0};
+  WalkOptions options;
+  options.prune = [&calls](const DirectoryEntry &entry) -> bool {
+    calls.fetch_add(1);
+    if (entry.path.filename() == "sub") {
+      throw std::runtime_error("prune failed");
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    return false;
+  };
+  EXPECT_THROW((void)manager.walk(root, options), std::runtime_error);
+
+  // Every worker has returned: no callback runs after the walk, and the pool can be reused
+  const int callsAtReturn = calls.load();
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_EQ(calls.load(), callsAtReturn);
+  auto walked = manager.walk(root);
+  ASSERT_TRUE(walked.hasValue());
+  EXPECT_EQ(walked.value().size(), 60U);
+}
+
+// ============================================================================
+// iterate() and filter tests
+// ============================================================================
+
+TEST_F(DirectoryManagerTest, IterateYieldsParentsBeforeTheirContents) {
+  const DirectoryManager manager;
+  const auto root = makeTree();
+  auto range = manager.iterate(root);
+  ASSERT_TRUE(range.hasValue()) << range.error().toString();
+
+  std::vector<DirectoryEntry> seen;
+  for (const auto &entry : range.value()) {
+    if (entry.depth > 0) {
+      const auto parent = entry.path.parent_path();
+      EXPECT_TRUE(std::ranges::any_of(seen, [&](const auto &e) { return e.path == parent; }))
+          << entry.path;
+    }
+    seen.push_back(entry);
+  }
+  EXPECT_FALSE(range.value().error().has_value());
+
+  auto walked = manager.walk(root);
+  ASSERT_TRUE(walked.hasValue());
+  EXPECT_EQ(relativeSorted(seen, root), relativeSorted(walked.value(), root));
+
+  auto missing = manager.iterate(testDir_ / "missing");
+  ASSERT_FALSE(missing.hasValue());
+  EXPECT_EQ(missing.error().code, FileErrorCode::NotFound);
+  auto notDirectory = manager.iterate(root / "a.txt");
+  ASSERT_FALSE(notDirectory.hasValue());
+  EXPECT_EQ(notDirectory.error().code, FileErrorCode::NotDirectory);
+}
+
+TEST_F(DirectoryManagerTest, IterateStopsReadingWhenTheCallerStops) {
+  const DirectoryManager manager;
+  for (int dir = 0; dir < 20; ++dir) {
+    for (int file = 0; file < 20; ++file) {
+      writeFile("tree/d" + std::to_string(dir) + "/f" + std::to_string(file) + ".log", "");
+    }
+  }
+
+  std::size_t inspected = 0;
+  WalkOptions options;
+  options.filter.extensions = {".log"};
+  options.filter.predicate = [&inspected](const DirectoryEntry &) {
+    ++inspected;
+    return true;
+  };
+  auto range = manager.iterate(testDir_ / "tree", options);
+  ASSERT_TRUE(range.hasValue());
+  const auto *first = range.value().next();
+  ASSERT_NE(first, nullptr);
+  EXPECT_EQ(first->path.extension(), ".log");
+  EXPECT_EQ(inspected, 1U);
+}
+
+TEST_F(DirectoryManagerTest, FiltersAndPruningApplyDuringTheWalk) {
+  const DirectoryManager manager(std::make_shared<ThreadPool>(2));
+  const auto root = makeTree();
+  writeFile("src/sub/notes.md", "notes");
+
+  WalkOptions options;
+  options.filter.extensions = {".txt"};
+  options.filter.types = {EntryType::Regular};
+  options.filter.minSize = 1;
+  const std::vector<WalkedEntry> expected = {
+      {"a.txt", EntryType::Regular, 0},
+      {"sub/b.txt", EntryType::Regular, 1},
+  };
+  auto walked = manager.walk(root, options);
+  ASSERT_TRUE(walked.hasValue());
+  EXPECT_EQ(relativeSorted(walked.value(), root), expected);
+  auto range = manager.iterate(root, options);
+  ASSERT_TRUE(range.hasValue());
+  std::vector<DirectoryEntry> iterated;
+  for (const auto &entry : range.value()) {
+    iterated.push_back(entry);
+  }
+  EXPECT_EQ(relativeSorted(iterated, root), expected);
+
+  // A pruned directory is reported but not read
+  WalkOptions pruned;
+  pruned.prune = [](const DirectoryEntry &entry) { return entry.path.filename() == "sub"; };
+  auto shallow = manager.walk(root, pruned);
+  ASSERT_TRUE(shallow.hasValue());
+  const auto relative = relativeSorted(shallow.value(), root);
+  EXPECT_EQ(relative.size(), 4U);
+  EXPECT_TRUE(std::ranges::any_of(relative, [](const auto &e) { return e.path == "sub"; }));
+
+  WalkOptions recent;
+  recent.filter.modifiedAfterNs = std::numeric_limits<std::int64_t>::max() - 1;
+  auto none = manager.walk(root, recent);
+  ASSERT_TRUE(none.hasValue());
+  EXPECT_TRUE(none.value().empty());
+}
+
+TEST_F(DirectoryManagerTest, GlobFilterSkipsSubtreesThatCannotMatch) {
+  const DirectoryManager manager(std::make_shared<ThreadPool>(2));
+  const auto root = makeTree();
+  writeFile("src/sub/notes.md", "notes");
+
+  auto glob = GlobMatcher::compile("sub/**/*.{txt,md}");
+  ASSERT_TRUE(glob.hasValue());
+  WalkOptions options;
+  options.filter.glob = std::make_shared<const GlobMatcher>(std::move(glob).value());
+  std::atomic<int> descended{0};
+  options.prune = [&descended](const DirectoryEntry &) {
+    ++descended;
+    return false;
+  };
+  const std::vector<WalkedEntry> expected = {
+      {"sub/b.txt", EntryType::Regular, 1},
+      {"sub/deeper/c.txt", EntryType::Regular, 2},
+      {"sub/notes.md", EntryType::Regular, 1},
+  };
+  auto walked = manager.walk(root, options);
+  ASSERT_TRUE(walked.hasValue());
+  EXPECT_EQ(relativeSorted(walked.value(), root), expected);
+  // Only sub and sub/deeper are read; empty cannot contain a match
+  EXPECT_EQ(descended.load(), 2);
+
+  auto range = manager.iterate(root / "", options);
+  ASSERT_TRUE(range.hasValue());
+  std::vector<DirectoryEntry> iterated;
+  for (const auto &entry : range.value()) {
+    iterated.push_back(entry);
+  }
+  EXPECT_EQ(relativeSorted(iterated, root), expected);
+}
+
+// ============================================================================
+// removeDirectoryRecursive() tests
+// ============================================================================
+
+TEST_F(DirectoryManagerTest, RemoveRecursiveCountsEntriesAndReportsProgress) {
+  const DirectoryManager manager(std::make_shared<ThreadPool>(2));
+  const auto root = makeTree();
+  for (int dir = 0; dir < 20; ++dir) {
+    for (int file = 0; file < 5; ++file) {
+      writeFile(fs::path("src/wide") / std::to_string(dir) / std::to_string(file), "x");
+    }
+  }
+  writeFile("outside/kept.txt", "kept");
+  fs::create_directory_symlink(testDir_ / "outside", root / "outside-link");
+
+  std::vector<std::uintmax_t> reported;
+  const auto removed =
+      manager.removeDirectoryRecursive(root, [&reported](std::uintmax_t count) {
+        reported.push_back(count);
+      });
+  ASSERT_TRUE(removed.hasValue()) << removed.error().message;
+  // src, 7 entries of makeTree(), wide, 20 directories of 5 files and the symlink
+  EXPECT_EQ(removed.value(), 1U + 7U + 1U + 20U * 6U + 1U);
+  EXPECT_FALSE(fs::exists(root));
+  EXPECT_TRUE(fs::exists(testDir_ / "outside" / "kept.txt"));
+  ASSERT_FALSE(reported.empty());
+  EXPECT_TRUE(std::ranges::is_sorted(reported));
+  EXPECT_EQ(reported.back(), removed.value());
+}
+
+TEST_F(DirectoryManagerTest, RemoveRecursiveRethrowsProgressExceptions) {
+  const DirectoryManager manager(std::make_shared<ThreadPool>(4));
+  for (int dir = 0; dir < 20; ++dir) {
+    for (int file = 0; file < 5; ++file) {
+      writeFile(fs::path("doomed") / std::to_string(dir) / std::to_string(file), "x");
+    }
+  }
+  const auto root = testDir_ / "doomed";
+
+  // Throw on a pool worker; the calling thread lingers so that the pool gets part of the tree
+  std::atomic<int> calls{0};
+  const auto caller = std::this_thread::get_id();
+  const auto throwing = [&calls, caller](std::uintmax_t) {
+    calls.fetch_add(1);
+    if (std::this_thread::get_id() != caller) {
+      throw std::runtime_error("progress failed");
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  };
+  EXPECT_THROW((void)manager.removeDirectoryRecursive(root, throwing), std::runtime_error);
+
+  // The removal stopped: no callback runs afterwards, and the rest can still be removed
+  const int callsAtReturn = calls.load();
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_EQ(calls.load(), callsAtReturn);
+  ASSERT_TRUE(manager.removeDirectoryRecursive(root).hasValue());
+  EXPECT_FALSE(fs::exists(root));
+}
+
+TEST_F(DirectoryManagerTest, RemoveRecursiveMatchesRemoveAllForFilesAndErrors) {
+  const DirectoryManager manager;
+  const auto file = writeFile("single.txt", "x");
+  const auto removedFile = manager.removeDirectoryRecursive(file);
+  ASSERT_TRUE(removedFile.hasValue());
+  EXPECT_EQ(removedFile.value(), 1U);
+  EXPECT_FALSE(fs::exists(file));
+
+  const auto root = makeTree();
+  const auto removedTree = manager.removeDirectoryRecursive(root);
+  ASSERT_TRUE(removedTree.hasValue());
+  EXPECT_EQ(removedTree.value(), 8U);
+
+  const auto missing = manager.removeDirectoryRecursive(testDir_ / "missing");
+  ASSERT_FALSE(missing.hasValue());
+  EXPECT_EQ(missing.error().code, FileErrorCode::NotFound);
+  const auto empty = manager.removeDirectoryRecursive("");
+  ASSERT_FALSE(empty.hasValue());
+  EXPECT_EQ(empty.error().code, FileErrorCode::InvalidPath);
+}
+
+// ============================================================================
+// snapshot() / rescan() tests
+// ============================================================================
+
+namespace {
+  std::vector<std::string> sortedStrings(const std::vector<fs::path> &paths) {
+    std::vector<std::string> strings;
+    for (const auto &path : paths) {
+      strings.push_back(path.generic_string());
+    }
+    std::sort(strings.begin(), strings.end());
+    return strings;
+  }
+} // namespace
+
+TEST_F(DirectoryManagerTest, SnapshotDiffReportsAddedRemovedAndModified) {
+  const DirectoryManager manager(std::make_shared<ThreadPool>(2));
+  const auto root = makeTree();
+  auto before = manager.snapshot(root);
+  ASSERT_TRUE(before.hasValue());
+  EXPECT_EQ(before.value().size(), 7U);
+  const auto *record = before.value().find("sub/b.txt");
+  ASSERT_NE(record, nullptr);
+  EXPECT_EQ(record->type, EntryType::Regular);
+  EXPECT_EQ(record->size, 200U * 1024U);
+  EXPECT_EQ(before.value().find("sub/missing"), nullptr);
+
+  fs::remove(root / "a.txt");
+  writeFile("src/sub/b.txt", "shorter");
+  writeFile("src/sub/deeper/new.txt", "new");
+  auto after = manager.snapshot(root);
+  ASSERT_TRUE(after.hasValue());
+
+  const auto diff = before.value().diff(after.value());
+  EXPECT_EQ(sortedStrings(diff.added), std::vector<std::string>{"sub/deeper/new.txt"});
+  EXPECT_EQ(sortedStrings(diff.removed), std::vector<std::string>{"a.txt"});
+  EXPECT_EQ(sortedStrings(diff.modified), std::vector<std::string>{"sub/b.txt"});
+  EXPECT_TRUE(after.value().diff(after.value()).empty());
+}
+
+TEST_F(DirectoryManagerTest, SnapshotRoundTripsThroughItsBinaryForm) {
+  const DirectoryManager manager;
+  const auto root = makeTree();
+  auto snapshot = manager.snapshot(root);
+  ASSERT_TRUE(snapshot.hasValue());
+  const auto data = snapshot.value().serialize();
+
+  auto loaded = DirectorySnapshot::deserialize(data);
+  ASSERT_TRUE(loaded.hasValue()) << loaded.error().message;
+  EXPECT_EQ(loaded.value().size(), snapshot.value().size());
+  EXPECT_EQ(loaded.value().rootInode(), snapshot.value().rootInode());
+  EXPECT_EQ(loaded.value().rootModifiedNs(), snapshot.value().rootModifiedNs());
+  EXPECT_EQ(loaded.value().scanStartNs(), snapshot.value().scanStartNs());
+  EXPECT_TRUE(loaded.value().diff(snapshot.value()).empty());
+  ASSERT_NE(loaded.value().find("sub/deeper/c.txt"), nullptr);
+
+  auto corrupted = data;
+  corrupted[corrupted.size() / 2] = static_cast<char>(corrupted[corrupted.size() / 2] ^ 1);
+  auto damaged = DirectorySnapshot::deserialize(corrupted);
+  ASSERT_FALSE(damaged.hasValue());
+  EXPECT_EQ(damaged.error().code, FileErrorCode::ReadError);
+  EXPECT_FALSE(DirectorySnapshot::deserialize(data.substr(0, data.size() - 1)).hasValue());
+  EXPECT_FALSE(DirectorySnapshot::deserialize("").hasValue());
+}
+
+TEST_F(DirectoryManagerTest, RescanReadsOnlyDirectoriesThatChanged) {
+  const DirectoryManager manager;
+  const auto root = makeTree();
+  // Directories modified just before a scan are always read again
+  const auto past = fs::file_time_type::clock::now() - std::chrono::hours(1);
+  for (const auto *dir : {"", "sub", "sub/deeper", "empty"}) {
+    fs::last_write_time(root / dir, past);
+  }
+  auto before = manager.snapshot(root);
+  ASSERT_TRUE(before.hasValue());
+
+  writeFile("src/a.txt", "ALPHA"); // In place: the mtime of src does not change
+  writeFile("src/sub/deeper/new.txt", "new");
+
+  auto skipped = manager.rescan(root, before.value());
+  ASSERT_TRUE(skipped.hasValue());
+  const auto skippedDiff = before.value().diff(skipped.value());
+  EXPECT_EQ(sortedStrings(skippedDiff.added), std::vector<std::string>{"sub/deeper/new.txt"});
+  EXPECT_TRUE(skippedDiff.removed.empty());
+  EXPECT_EQ(sortedStrings(skippedDiff.modified), std::vector<std::string>{"a.txt"});
+
+  auto full =
+      manager.rescan(root, before.value(), RescanOptions{.skipUnchangedDirectories = false});
+  ASSERT_TRUE(full.hasValue());
+  const auto fullDiff = before.value().diff(full.value());
+  EXPECT_EQ(sortedStrings(fullDiff.added), std::vector<std::string>{"sub/deeper/new.txt"});
+  EXPECT_EQ(sortedStrings(fullDiff.modified), std::vector<std::string>{"a.txt"});
+  EXPECT_EQ(skipped.value().size(), full.value().size());
+
+  auto missing = manager.rescan(testDir_ / "missing", before.value());
+  ASSERT_FALSE(missing.hasValue());
+  EXPECT_EQ(missing.error().code, FileErrorCode::NotFound);
+}
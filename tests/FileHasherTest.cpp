@@ -0,0 +1,180 @@
+#include <Utils/Filesystem/Crc32c.hpp>
+#include <Utils/Filesystem/FileHasher.hpp>
+#include <Utils/UtilsFactory.hpp>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace nixoncpp::utils;
+namespace fs = std::filesystem;
+
+namespace {
+  // Bit-at-a-time CRC-32C, independent of the table and hardware implementations
+  std::uint32_t referenceCrc32c(const std::string &data) {
+    std::uint32_t crc = 0xFFFFFFFFU;
+    for (const char c : data) {
+      crc ^= static_cast<unsigned char>(c);
+      for (int bit = 0; bit < 8; ++bit) {
+        crc = (crc >> 1) ^ ((crc & 1U) != 0 ? 0x82F63B78U : 0U);
+      }
+    }
+    return ~crc;
+  }
+
+  std::span<const std::byte> bytesOf(const std::string &data) {
+    return std::as_bytes(std::span(data.data(), data.size()));
+  }
+
+  std::string randomContent(std::size_t size) {
+    std::mt19937 engine(static_cast<unsigned>(size));
+    std::uniform_int_distribution<int> byte(0, 255);
+    std::string content(size, '\0');
+    for (auto &c : content) {
+      c = static_cast<char>(byte(engine));
+    }
+    return content;
+  }
+} // namespace
+
+class FileHasherTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    testDir_ = fs::temp_directory_path() / "FileHasherTest";
+    fs::remove_all(testDir_);
+    fs::create_directories(testDir_);
+  }
+
+  void TearDown() override {
+    std::error_code ec;
+    fs::remove_all(testDir_, ec);
+  }
+
+  fs::path writeFile(const std::string &name, const std::string &content) {
+    const auto path = testDir_ / name;
+    std::ofstream(path, std::ios::binary) << content;
+    return path;
+  }
+
+  fs::path testDir_;
+  FileHasher hasher_;
+};
+
+// ============================================================================
+// CRC-32C
+// ============================================================================
+
+TEST_F(FileHasherTest, Crc32cMatchesCheckValue) {
+  EXPECT_EQ(crc32c(0, bytesOf("123456789")), 0xE3069283U);
+  EXPECT_EQ(crc32c(0, {}), 0U);
+  EXPECT_FALSE(crc32cImplementationName().empty());
+
+  auto hash = hasher_.hashFile(writeFile("check.txt", "123456789"), HashAlgorithm::Crc32c);
+  ASSERT_TRUE(hash.hasValue());
+  EXPECT_EQ(hash.value().low, 0xE3069283U);
+  EXPECT_EQ(hash.value().high, 0U);
+  EXPECT_EQ(hash.value().toHex(), "e3069283");
+}
+
+TEST_F(FileHasherTest, Crc32cMatchesReferenceForAllSizesAndSplits) {
+  // Covers the byte tail, the 8-byte loop and the three-lane blocks (3 x 8 KiB)
+  for (const std::size_t size : {1UL, 7UL, 8UL, 9UL, 24575UL, 24576UL, 24577UL, 100003UL}) {
+    const auto content = randomContent(size);
+    const auto expected = referenceCrc32c(content);
+    EXPECT_EQ(crc32c(0, bytesOf(content)), expected) << size;
+
+    const auto split = size / 3;
+    const auto bytes = bytesOf(content);
+    EXPECT_EQ(crc32c(crc32c(0, bytes.first(split)), bytes.subspan(split)), expected) << size;
+  }
+}
+
+TEST_F(FileHasherTest, HashFileStreamsAcrossChunks) {
+  const auto content = randomContent((3 << 20) + 5);
+  auto hash = hasher_.hashFile(writeFile("large.bin", content), HashAlgorithm::Crc32c);
+  ASSERT_TRUE(hash.hasValue());
+  EXPECT_EQ(hash.value().low, referenceCrc32c(content));
+
+  auto empty = hasher_.hashFile(writeFile("empty.bin", ""), HashAlgorithm::Crc32c);
+  ASSERT_TRUE(empty.hasValue());
+  EXPECT_EQ(empty.value().toHex(), "00000000");
+}
+
+// ============================================================================
+// XXH3
+// ============================================================================
+
+TEST_F(FileHasherTest, Xxh3MatchesKnownDigests) {
+  const auto path = writeFile("empty.bin", "");
+  if (!isHashAlgorithmAvailable(HashAlgorithm::Xxh3_64)) {
+    auto unavailable = hasher_.hashFile(path, HashAlgorithm::Xxh3_64);
+    ASSERT_FALSE(unavailable.hasValue());
+    EXPECT_EQ(unavailable.error().code, FileErrorCode::Unknown);
+    GTEST_SKIP() << "Built without libxxhash";
+  }
+
+  auto xxh64 = hasher_.hashFile(path, HashAlgorithm::Xxh3_64);
+  ASSERT_TRUE(xxh64.hasValue());
+  EXPECT_EQ(xxh64.value().toHex(), "2d06800538d394c2");
+
+  auto xxh128 = hasher_.hashFile(path, HashAlgorithm::Xxh3_128);
+  ASSERT_TRUE(xxh128.hasValue());
+  EXPECT_EQ(xxh128.value().toHex(), "99aa06d3014798d86001c324468d497f");
+
+  // Streaming over several chunks must not change the digest of a file
+  const auto content = randomContent((2 << 20) + 17);
+  const auto first = writeFile("first.bin", content);
+  const auto second = writeFile("second.bin", content);
+  EXPECT_EQ(hasher_.hashFile(first, HashAlgorithm::Xxh3_128).value(),
+            hasher_.hashFile(second, HashAlgorithm::Xxh3_128).value());
+  EXPECT_NE(hasher_.hashFile(first, HashAlgorithm::Xxh3_128).value(), xxh128.value());
+}
+
+// ============================================================================
+// Errors and batches
+// ============================================================================
+
+TEST_F(FileHasherTest, ReportsErrors) {
+  auto missing = hasher_.hashFile(testDir_ / "missing.bin", HashAlgorithm::Crc32c);
+  ASSERT_FALSE(missing.hasValue());
+  EXPECT_EQ(missing.error().code, FileErrorCode::NotFound);
+
+  auto directory = hasher_.hashFile(testDir_, HashAlgorithm::Crc32c);
+  ASSERT_FALSE(directory.hasValue());
+  EXPECT_EQ(directory.error().code, FileErrorCode::IsDirectory);
+
+  auto empty = hasher_.hashFile("", HashAlgorithm::Crc32c);
+  ASSERT_FALSE(empty.hasValue());
+  EXPECT_EQ(empty.error().code, FileErrorCode::InvalidPath);
+}
+
+TEST_F(FileHasherTest, HashFilesInParallelMatchesSequential) {
+  std::vector<fs::path> paths;
+  for (std::size_t i = 0; i < 32; ++i) {
+    paths.push_back(writeFile("file" + std::to_string(i) + ".bin", randomContent(i * 4099)));
+  }
+  paths.push_back(testDir_ / "missing.bin");
+
+  FileHasher parallel(std::make_shared<ThreadPool>(4));
+  const auto expected = hasher_.hashFiles(paths, HashAlgorithm::Crc32c);
+  const auto actual = parallel.hashFiles(paths, HashAlgorithm::Crc32c);
+  ASSERT_EQ(actual.size(), paths.size());
+  for (std::size_t i = 0; i + 1 < paths.size(); ++i) {
+    ASSERT_TRUE(actual[i].hasValue()) << i;
+    EXPECT_EQ(actual[i].value(), expected[i].value()) << i;
+  }
+  ASSERT_FALSE(actual.back().hasValue());
+  EXPECT_EQ(actual.back().error().code, FileErrorCode::NotFound);
+}
+
+TEST_F(FileHasherTest, FactoryCreatesHashers) {
+  const auto path = writeFile("factory.txt", "123456789");
+  auto sequential = UtilsFactory::createFileHasher();
+  auto parallel = UtilsFactory::createFileHasher(UtilsFactory::createThreadPool(2));
+  EXPECT_EQ(sequential->hashFile(path, HashAlgorithm::Crc32c).value().low, 0xE3069283U);
+  const std::vector<fs::path> paths = {path};
+  EXPECT_EQ(parallel->hashFiles(paths, HashAlgorithm::Crc32c)[0].value().low, 0xE3069283U);
+}
@@ -1,9 +1,22 @@
+#include <Utils/Concurrency/ThreadPool.hpp>
+#include <Utils/Filesystem/FileHandleCache.hpp>
 #include <Utils/Filesystem/FileReader.hpp>
+#include <Utils/Filesystem/FileWriter.hpp>
+#include <Utils/Filesystem/ThreadPoolFileIO.hpp>
+#include <Utils/String/NewlineScanner.hpp>
+#include <Utils/UtilsFactory.hpp>
+#include <algorithm>
+#include <array>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <gtest/gtest.h>
 #include <string>
 
+#if defined(__linux__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
 using namespace nixoncpp::utils;
 namespace fs = std::filesystem;
 
@@ -167,6 +180,23 @@ TEST_F(FileReaderTest, ReadFailsForEmptyPath) {
   EXPECT_EQ(result.error().code, nixoncpp::utils::FileErrorCode::InvalidPath);
 }
 
+TEST_F(FileReaderTest, ReadFailsWithAccessDeniedForUnreadableFile) {
+#if defined(__linux__) || defined(__APPLE__)
+  if (::geteuid() == 0) {
+    GTEST_SKIP() << "Permission checks do not apply to root";
+  }
+  fs::permissions(simpleFile_, fs::perms::none);
+  FileReader reader;
+  auto result = reader.read(simpleFile_);
+  fs::permissions(simpleFile_, fs::perms::owner_read | fs::perms::owner_write);
+
+  EXPECT_FALSE(result.hasValue());
+  EXPECT_EQ(result.error().code, nixoncpp::utils::FileErrorCode::AccessDenied);
+#else
+  GTEST_SKIP() << "POSIX permissions only";
+#endif
+}
+
 // ============================================================================
 // readBytes() tests
 // ============================================================================
@@ -205,6 +235,26 @@ TEST_F(FileReaderTest, ReadBytesFailsForNonexistentFile) {
   EXPECT_EQ(result.error().code, nixoncpp::utils::FileErrorCode::NotFound);
 }
 
+TEST_F(FileReaderTest, ReadWithAccessHintsReturnsSameContent) {
+  FileReader reader;
+  for (const auto pattern : {AccessPattern::Normal, AccessPattern::Sequential,
+                             AccessPattern::Random, AccessPattern::WillNeed,
+                             AccessPattern::DontNeed}) {
+    const ReadOptions options{.pattern = pattern};
+    auto text = reader.read(multiLineFile_, options);
+    ASSERT_TRUE(text.hasValue());
+    EXPECT_EQ(text.value(), "Line 1\nLine 2\nLine 3\n");
+
+    auto bytes = reader.readBytes(binaryFile_, options);
+    ASSERT_TRUE(bytes.hasValue());
+    EXPECT_EQ(bytes.value(), (std::vector<uint8_t>{0x00, 0xFF, 0x42, 0xAB, 0xCD})); // NOLINT
+  }
+
+  auto missing = reader.read(testDir_ / "nonexistent.txt", ReadOptions{});
+  ASSERT_FALSE(missing.hasValue());
+  EXPECT_EQ(missing.error().code, nixoncpp::utils::FileErrorCode::NotFound);
+}
+
 // ============================================================================
 // readLines() tests
 // ============================================================================
@@ -253,6 +303,393 @@ TEST_F(FileReaderTest, ReadLinesFailsForNonexistentFile) {
   EXPECT_EQ(result.error().code, nixoncpp::utils::FileErrorCode::NotFound);
 }
 
+TEST_F(FileReaderTest, ReadBytesHandlesLargeFile) {
+  const auto largeFile = testDir_ / "large.bin";
+  std::vector<uint8_t> expected(3 * 1024 * 1024 + 17);
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    expected[i] = static_cast<uint8_t>(i * 31);
+  }
+  std::ofstream(largeFile, std::ios::binary)
+      .write(reinterpret_cast<const char *>(expected.data()),
+             static_cast<std::streamsize>(expected.size()));
+
+  FileReader reader;
+  auto result = reader.readBytes(largeFile);
+
+  ASSERT_TRUE(result.hasValue());
+  EXPECT_EQ(result.value(), expected);
+}
+
+#if defined(__linux__)
+TEST_F(FileReaderTest, ReadHandlesFilesWithoutReportedSize) {
+  // procfs reports a size of 0 but has content
+  FileReader reader;
+  auto result = reader.read("/proc/self/status");
+
+  ASSERT_TRUE(result.hasValue());
+  EXPECT_NE(result.value().find("Name:"), std::string::npos);
+}
+#endif
+
+// ============================================================================
+// lines() tests
+// ============================================================================
+
+namespace {
+  std::vector<std::string> collectLines(LineReader &reader) {
+    std::vector<std::string> lines;
+    for (std::string_view line : reader) {
+      lines.emplace_back(line);
+    }
+    return lines;
+  }
+} // namespace
+
+TEST_F(FileReaderTest, LinesMatchesReadLines) {
+  FileReader reader;
+  auto lazy = reader.lines(multiLineFile_);
+  auto eager = reader.readLines(multiLineFile_);
+
+  ASSERT_TRUE(lazy.hasValue());
+  ASSERT_TRUE(eager.hasValue());
+  EXPECT_EQ(collectLines(lazy.value()), eager.value());
+  EXPECT_FALSE(lazy.value().error().has_value());
+}
+
+TEST_F(FileReaderTest, LinesStripsCarriageReturns) {
+  const auto crlfFile = testDir_ / "crlf.txt";
+  std::ofstream(crlfFile, std::ios::binary) << "first\r\n\r\nthird\r\nlast";
+
+  FileReader reader;
+  auto result = reader.lines(crlfFile);
+
+  ASSERT_TRUE(result.hasValue());
+  const std::vector<std::string> expected = {"first", "", "third", "last"};
+  EXPECT_EQ(collectLines(result.value()), expected);
+}
+
+TEST_F(FileReaderTest, LinesSpanChunkBoundariesAndLongLines) {
+  const auto file = testDir_ / "chunks.txt";
+  std::vector<std::string> expected;
+  {
+    std::ofstream out(file, std::ios::binary);
+    for (std::size_t i = 0; i < 200; ++i) {
+      expected.emplace_back(i % 37, static_cast<char>('a' + (i % 26)));
+      out << expected.back() << (i % 3 == 0 ? "\r\n" : "\n");
+    }
+    expected.emplace_back(1000, 'z'); // Longer than the chunk size
+    out << expected.back() << "\n";
+  }
+
+  FileReader reader;
+  auto result = reader.lines(file, 16);
+
+  ASSERT_TRUE(result.hasValue());
+  EXPECT_EQ(collectLines(result.value()), expected);
+}
+
+TEST_F(FileReaderTest, LinesHandlesEmptyFile) {
+  FileReader reader;
+  auto result = reader.lines(emptyFile_);
+
+  ASSERT_TRUE(result.hasValue());
+  EXPECT_TRUE(collectLines(result.value()).empty());
+}
+
+TEST_F(FileReaderTest, LinesFailsForNonexistentFile) {
+  FileReader reader;
+  auto result = reader.lines(testDir_ / "missing.txt");
+
+  ASSERT_FALSE(result.hasValue());
+  EXPECT_EQ(result.error().code, FileErrorCode::NotFound);
+}
+
+TEST_F(FileReaderTest, LineSplitterIteratesMappedFile) {
+  FileReader reader;
+  auto mapped = reader.map(multiLineFile_);
+  ASSERT_TRUE(mapped.hasValue());
+
+  std::vector<std::string_view> lines;
+  for (std::string_view line : LineSplitter(mapped.value().view())) {
+    lines.push_back(line);
+  }
+  ASSERT_EQ(lines.size(), 3);
+  EXPECT_EQ(lines[0], "Line 1");
+  EXPECT_EQ(lines[2], "Line 3");
+}
+
+TEST(NewlineScannerTest, MatchesMemchrAtEveryPosition) {
+  // Exercise the vector body, the scalar tail and unaligned starts
+  std::string buffer(200, 'x');
+  for (std::size_t start = 0; start < 40; ++start) {
+    for (std::size_t position = start; position <= buffer.size(); ++position) {
+      std::string text = buffer;
+      if (position < text.size()) {
+        text[position] = '\n';
+      }
+      const char *begin = text.data() + start;
+      const char *end = text.data() + text.size();
+      const void *expected = std::memchr(begin, '\n', static_cast<std::size_t>(end - begin));
+      const char *found = findNewline(begin, end);
+      ASSERT_EQ(found, expected != nullptr ? static_cast<const char *>(expected) : end)
+          << "start " << start << ", newline at " << position << ", scanner "
+          << newlineScannerName();
+    }
+  }
+}
+
+// ============================================================================
+// map() tests
+// ============================================================================
+
+TEST_F(FileReaderTest, MapExposesFileContent) {
+  FileReader reader;
+  auto result = reader.map(simpleFile_);
+
+  ASSERT_TRUE(result.hasValue());
+  EXPECT_EQ(result.value().view(), "Hello, World!");
+  EXPECT_EQ(result.value().size(), 13);
+  EXPECT_EQ(result.value().bytes()[0], std::byte{'H'});
+}
+
+TEST_F(FileReaderTest, MapPreservesBinaryContent) {
+  FileReader reader;
+  auto result = reader.map(binaryFile_, AccessPattern::Random);
+
+  ASSERT_TRUE(result.hasValue());
+  const auto bytes = result.value().bytes();
+  ASSERT_EQ(bytes.size(), 5);
+  EXPECT_EQ(bytes[0], std::byte{0x00});
+  EXPECT_EQ(bytes[1], std::byte{0xFF});
+  EXPECT_EQ(bytes[4], std::byte{0xCD});
+}
+
+TEST_F(FileReaderTest, MapHandlesEmptyFile) {
+  FileReader reader;
+  auto result = reader.map(emptyFile_);
+
+  ASSERT_TRUE(result.hasValue());
+  EXPECT_TRUE(result.value().empty());
+  EXPECT_TRUE(result.value().view().empty());
+}
+
+TEST_F(FileReaderTest, MapFailsForNonexistentFile) {
+  FileReader reader;
+  auto result = reader.map(testDir_ / "missing.txt");
+
+  ASSERT_FALSE(result.hasValue());
+  EXPECT_EQ(result.error().code, FileErrorCode::NotFound);
+}
+
+TEST_F(FileReaderTest, MapFailsForDirectory) {
+  FileReader reader;
+  auto result = reader.map(testDir_);
+
+  ASSERT_FALSE(result.hasValue());
+  EXPECT_EQ(result.error().code, FileErrorCode::IsDirectory);
+}
+
+TEST_F(FileReaderTest, MappedFileMoveTransfersOwnership) {
+  FileReader reader;
+  auto result = reader.map(multiLineFile_);
+  ASSERT_TRUE(result.hasValue());
+
+  MappedFile first = std::move(result.value());
+  MappedFile second;
+  second = std::move(first);
+
+  EXPECT_TRUE(first.empty()); // NOLINT(bugprone-use-after-move)
+  EXPECT_EQ(second.view(), "Line 1\nLine 2\nLine 3\n");
+  second.advise(AccessPattern::WillNeed);
+  EXPECT_EQ(second.view().substr(0, 6), "Line 1");
+}
+
+// ============================================================================
+// readMany() tests
+// ============================================================================
+
+namespace {
+  std::vector<fs::path> writeNumberedFiles(const fs::path &dir, int count) {
+    std::vector<fs::path> paths;
+    for (int i = 0; i < count; ++i) {
+      paths.push_back(dir / ("many_" + std::to_string(i) + ".txt"));
+      std::ofstream(paths.back()) << "content " << i;
+    }
+    return paths;
+  }
+} // namespace
+
+TEST_F(FileReaderTest, ReadManyReturnsResultsInInputOrder) {
+  auto paths = writeNumberedFiles(testDir_, 50);
+  // Reverse so the input order differs from the creation (and typically inode) order
+  std::reverse(paths.begin(), paths.end());
+  paths.insert(paths.begin() + 10, testDir_ / "missing.txt");
+
+  FileReader reader;
+  auto results = reader.readMany(paths);
+
+  ASSERT_EQ(results.size(), paths.size());
+  ASSERT_FALSE(results[10].hasValue());
+  EXPECT_EQ(results[10].error().code, FileErrorCode::NotFound);
+  for (std::size_t i = 0; i < paths.size(); ++i) {
+    if (i == 10) {
+      continue;
+    }
+    ASSERT_TRUE(results[i].hasValue()) << paths[i];
+    EXPECT_EQ("content " + paths[i].stem().string().substr(5), results[i].value());
+  }
+}
+
+TEST_F(FileReaderTest, ReadManyUsesAsyncBackend) {
+  auto paths = writeNumberedFiles(testDir_, 40);
+  auto asyncIo = std::make_shared<ThreadPoolFileIO>(std::make_shared<FileReader>(),
+                                                    std::make_shared<FileWriter>(),
+                                                    std::make_shared<ThreadPool>(4));
+  FileReader reader(asyncIo);
+
+  auto results = reader.readMany(paths);
+
+  ASSERT_EQ(results.size(), paths.size());
+  for (std::size_t i = 0; i < paths.size(); ++i) {
+    ASSERT_TRUE(results[i].hasValue());
+    EXPECT_EQ(results[i].value(), "content " + std::to_string(i));
+  }
+}
+
+TEST_F(FileReaderTest, ReadManyCreatesItsBackendOnFirstUse) {
+  auto paths = writeNumberedFiles(testDir_, 40);
+  int created = 0;
+  const FileReader reader([&created] {
+    ++created;
+    return std::make_shared<ThreadPoolFileIO>(std::make_shared<FileReader>(),
+                                              std::make_shared<FileWriter>(),
+                                              std::make_shared<ThreadPool>(2));
+  });
+  ASSERT_TRUE(reader.read(paths[0]).hasValue());
+  EXPECT_EQ(created, 0);
+
+  for (int round = 0; round < 2; ++round) {
+    auto results = reader.readMany(paths);
+    ASSERT_EQ(results.size(), paths.size());
+    for (std::size_t i = 0; i < paths.size(); ++i) {
+      ASSERT_TRUE(results[i].hasValue());
+      EXPECT_EQ(results[i].value(), "content " + std::to_string(i));
+    }
+  }
+  EXPECT_EQ(created, 1);
+  EXPECT_EQ(UtilsFactory::createFileReader()->readMany(paths).size(), paths.size());
+}
+
+TEST_F(FileReaderTest, ReadManyHandlesEmptyInput) {
+  FileReader reader;
+  EXPECT_TRUE(reader.readMany({}).empty());
+}
+
+// ============================================================================
+// readInto() / readRange() tests
+// ============================================================================
+
+TEST_F(FileReaderTest, ReadIntoFillsBufferFromOffset) {
+  FileReader reader;
+  std::array<std::byte, 5> buffer{};
+
+  auto result = reader.readInto(simpleFile_, buffer, 7);
+
+  ASSERT_TRUE(result.hasValue());
+  EXPECT_EQ(result.value(), 5U);
+  EXPECT_EQ(std::string(reinterpret_cast<const char *>(buffer.data()), 5), "World");
+}
+
+TEST_F(FileReaderTest, ReadIntoStopsAtEndOfFile) {
+  FileReader reader;
+  std::array<std::byte, 64> buffer{};
+
+  auto shortRead = reader.readInto(simpleFile_, buffer, 10);
+  ASSERT_TRUE(shortRead.hasValue());
+  EXPECT_EQ(shortRead.value(), 3U);
+
+  auto pastEnd = reader.readInto(simpleFile_, buffer, 1000);
+  ASSERT_TRUE(pastEnd.hasValue());
+  EXPECT_EQ(pastEnd.value(), 0U);
+}
+
+TEST_F(FileReaderTest, ReadIntoFailsForNonexistentFile) {
+  FileReader reader;
+  std::array<std::byte, 4> buffer{};
+  auto result = reader.readInto(testDir_ / "missing.txt", buffer);
+
+  ASSERT_FALSE(result.hasValue());
+  EXPECT_EQ(result.error().code, FileErrorCode::NotFound);
+}
+
+TEST_F(FileReaderTest, ReadRangeReturnsRequestedBytes) {
+  FileReader reader;
+  auto result = reader.readRange(binaryFile_, 1, 3);
+
+  ASSERT_TRUE(result.hasValue());
+  EXPECT_EQ(result.value(), (std::vector<uint8_t>{0xFF, 0x42, 0xAB}));
+
+  auto tail = reader.readRange(binaryFile_, 3, 100);
+  ASSERT_TRUE(tail.hasValue());
+  EXPECT_EQ(tail.value(), (std::vector<uint8_t>{0xAB, 0xCD}));
+}
+
+#if defined(__linux__) || defined(__APPLE__)
+TEST_F(FileReaderTest, HandleCacheReusesDescriptors) {
+  auto cache = std::make_shared<FileHandleCache>(4);
+  FileReader reader(cache);
+
+  for (int i = 0; i < 3; ++i) {
+    auto result = reader.readRange(simpleFile_, 0, 5);
+    ASSERT_TRUE(result.hasValue());
+    EXPECT_EQ(std::string(result.value().begin(), result.value().end()), "Hello");
+  }
+
+  const auto stats = cache->stats();
+  EXPECT_EQ(stats.misses, 1U);
+  EXPECT_EQ(stats.hits, 2U);
+  EXPECT_EQ(cache->size(), 1U);
+}
+
+TEST_F(FileReaderTest, HandleCacheEvictsLeastRecentlyUsed) {
+  FileHandleCache cache(2);
+  ASSERT_TRUE(cache.acquire(simpleFile_).hasValue());
+  ASSERT_TRUE(cache.acquire(multiLineFile_).hasValue());
+  ASSERT_TRUE(cache.acquire(simpleFile_).hasValue()); // multiLineFile_ is now the oldest
+  auto evictedButHeld = cache.acquire(binaryFile_);
+  ASSERT_TRUE(evictedButHeld.hasValue());
+
+  EXPECT_EQ(cache.size(), 2U);
+  EXPECT_EQ(cache.stats().evictions, 1U);
+  ASSERT_TRUE(cache.acquire(simpleFile_).hasValue());
+  EXPECT_EQ(cache.stats().hits, 2U);
+  ASSERT_TRUE(cache.acquire(multiLineFile_).hasValue());
+  EXPECT_EQ(cache.stats().misses, 4U);
+
+  // binaryFile_ was evicted by the last miss, but its descriptor stays usable while held
+  std::array<std::byte, 1> byte{};
+  EXPECT_EQ(::pread(evictedButHeld.value()->fd(), byte.data(), 1, 2), 1);
+  EXPECT_EQ(byte[0], std::byte{0x42});
+}
+
+TEST_F(FileReaderTest, HandleCacheInvalidateReopensReplacedFile) {
+  auto cache = std::make_shared<FileHandleCache>();
+  FileReader reader(cache);
+  ASSERT_TRUE(reader.readRange(simpleFile_, 0, 5).hasValue());
+
+  // Replace the file; the cached descriptor still refers to the old one
+  const auto replacement = testDir_ / "replacement.txt";
+  std::ofstream(replacement) << "Jello, World!";
+  fs::rename(replacement, simpleFile_);
+  cache->invalidate(simpleFile_);
+
+  auto result = reader.readRange(simpleFile_, 0, 5);
+  ASSERT_TRUE(result.hasValue());
+  EXPECT_EQ(std::string(result.value().begin(), result.value().end()), "Jello");
+  EXPECT_EQ(cache->stats().misses, 2U);
+}
+#endif
+
 // ============================================================================
 // Error handling tests
 // ============================================================================
@@ -0,0 +1,427 @@
+#include <Utils/Filesystem/FileReader.hpp>
+#include <Utils/Filesystem/FileWriter.hpp>
+#include <Utils/UtilsFactory.hpp>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <csignal>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#endif
+
+using namespace nixoncpp::utils;
+namespace fs = std::filesystem;
+
+class FileWriterTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    testDir_ = fs::temp_directory_path() / "FileWriterTest";
+    fs::remove_all(testDir_);
+    fs::create_directories(testDir_);
+  }
+
+  void TearDown() override {
+    std::error_code ec;
+    fs::remove_all(testDir_, ec);
+  }
+
+  static std::string contentOf(const fs::path &path) {
+    std::ifstream file(path, std::ios::binary);
+    std::ostringstream buffer;
+    buffer << file.rdbuf();
+    return buffer.str();
+  }
+
+  fs::path testDir_;
+  FileWriter writer_;
+};
+
+// ============================================================================
+// write() / writeBytes() with WriteOptions tests
+// ============================================================================
+
+TEST_F(FileWriterTest, WriteWithOptionsWritesAndAppends) {
+  const auto path = testDir_ / "nested" / "options.txt";
+  ASSERT_TRUE(writer_.write(path, "first\n", WriteOptions{}).hasValue());
+  const WriteOptions appendUncached{.append = true, .pattern = AccessPattern::DontNeed};
+  ASSERT_TRUE(writer_.write(path, "second\n", appendUncached).hasValue());
+  EXPECT_EQ(contentOf(path), "first\nsecond\n");
+
+  const std::vector<uint8_t> bytes = {0x00, 0x01, 0xFE, 0xFF};
+  ASSERT_TRUE(writer_.writeBytes(path, bytes, WriteOptions{.pattern = AccessPattern::DontNeed})
+                  .hasValue());
+  EXPECT_EQ(contentOf(path), std::string("\x00\x01\xFE\xFF", 4));
+
+  auto directory = writer_.write(testDir_, "data", WriteOptions{});
+  ASSERT_FALSE(directory.hasValue());
+  EXPECT_EQ(directory.error().code, FileErrorCode::IsDirectory);
+}
+
+TEST_F(FileWriterTest, ExpectedSizeReservesSpaceWithoutGrowingTheFile) {
+#if defined(__linux__)
+  constexpr std::uintmax_t kExpected = 8 * 1024 * 1024;
+  const auto path = testDir_ / "reserved.bin";
+  ASSERT_TRUE(writer_.write(path, "header", WriteOptions{.expectedSize = kExpected}).hasValue());
+  EXPECT_EQ(fs::file_size(path), 6U);
+  struct stat info{};
+  ASSERT_EQ(::stat(path.c_str(), &info), 0);
+  EXPECT_GE(static_cast<std::uintmax_t>(info.st_blocks) * 512, kExpected);
+
+  auto appender =
+      writer_.openAppender(testDir_ / "reserved.log", AppenderOptions{.expectedSize = kExpected});
+  ASSERT_TRUE(appender.hasValue());
+  ASSERT_TRUE(appender.value().append("entry\n").hasValue());
+  ASSERT_TRUE(appender.value().flush().hasValue());
+  EXPECT_EQ(fs::file_size(testDir_ / "reserved.log"), 6U);
+  ASSERT_EQ(::stat((testDir_ / "reserved.log").c_str(), &info), 0);
+  EXPECT_GE(static_cast<std::uintmax_t>(info.st_blocks) * 512, kExpected);
+#else
+  GTEST_SKIP() << "block accounting is checked on Linux only";
+#endif
+}
+
+// ============================================================================
+// writeLines() tests
+// ============================================================================
+
+TEST_F(FileWriterTest, WriteLinesTerminatesEveryLine) {
+  const auto path = testDir_ / "lines.txt";
+  ASSERT_TRUE(writer_.writeLines(path, std::vector<std::string>{"alpha", "", "gamma"}).hasValue());
+  EXPECT_EQ(contentOf(path), "alpha\n\ngamma\n");
+
+  ASSERT_TRUE(writer_.writeLines(path, std::vector<std::string>{"delta"}, true).hasValue());
+  EXPECT_EQ(contentOf(path), "alpha\n\ngamma\ndelta\n");
+
+  ASSERT_TRUE(writer_.writeLines(path, std::vector<std::string>{}).hasValue());
+  EXPECT_EQ(contentOf(path), "");
+}
+
+TEST_F(FileWriterTest, WriteLinesAcceptsStringViews) {
+  const std::string backing = "one two three";
+  const std::string_view text = backing;
+  const std::vector<std::string_view> lines = {text.substr(0, 3), text.substr(4, 3),
+                                               text.substr(8)};
+  const auto path = testDir_ / "nested" / "views.txt";
+  ASSERT_TRUE(writer_.writeLines(path, lines).hasValue());
+  EXPECT_EQ(contentOf(path), "one\ntwo\nthree\n");
+}
+
+TEST_F(FileWriterTest, WriteLinesHandlesMoreLinesThanOneBatch) {
+  // Short lines are staged, long ones gathered in place; enough of both for several batches
+  std::vector<std::string> lines;
+  std::string expected;
+  for (int i = 0; i < 5000; ++i) {
+    lines.push_back(i % 3 == 0 ? std::string(300 + i % 7, static_cast<char>('a' + i % 26))
+                               : "line " + std::to_string(i));
+    expected += lines.back() + '\n';
+  }
+  const auto path = testDir_ / "many.txt";
+  ASSERT_TRUE(writer_.writeLines(path, lines).hasValue());
+  EXPECT_EQ(contentOf(path), expected);
+}
+
+TEST_F(FileWriterTest, WriteLinesRejectsInvalidPaths) {
+  auto empty = writer_.writeLines("", std::vector<std::string>{"x"});
+  ASSERT_FALSE(empty.hasValue());
+  EXPECT_EQ(empty.error().code, FileErrorCode::InvalidPath);
+
+  const std::vector<std::string_view> lines = {"x"};
+  auto directory = writer_.writeLines(testDir_, lines);
+  ASSERT_FALSE(directory.hasValue());
+  EXPECT_EQ(directory.error().code, FileErrorCode::IsDirectory);
+}
+
+// ============================================================================
+// copyFile() tests
+// ============================================================================
+
+TEST_F(FileWriterTest, CopyFileCopiesContentAndMode) {
+  std::string content(300 * 1024 + 5, '\0');
+  for (std::size_t i = 0; i < content.size(); ++i) {
+    content[i] = static_cast<char>(i * 31 % 251);
+  }
+  const auto source = testDir_ / "source.bin";
+  std::ofstream(source, std::ios::binary) << content;
+  fs::permissions(source, fs::perms::owner_read | fs::perms::owner_write | fs::perms::owner_exec);
+
+  const auto destination = testDir_ / "copies" / "copy.bin";
+  auto copied = writer_.copyFile(source, destination);
+  ASSERT_TRUE(copied.hasValue()) << copied.error().toString();
+  EXPECT_EQ(copied.value(), content.size());
+  EXPECT_EQ(contentOf(destination), content);
+  EXPECT_EQ(fs::status(destination).permissions(), fs::status(source).permissions());
+}
+
+TEST_F(FileWriterTest, CopyFileHonoursOverwrite) {
+  const auto source = testDir_ / "new.txt";
+  const auto destination = testDir_ / "existing.txt";
+  std::ofstream(source) << "new";
+  std::ofstream(destination) << "existing content";
+
+  auto refused = writer_.copyFile(source, destination);
+  ASSERT_FALSE(refused.hasValue());
+  EXPECT_EQ(refused.error().code, FileErrorCode::AlreadyExists);
+  EXPECT_EQ(contentOf(destination), "existing content");
+
+  ASSERT_TRUE(writer_.copyFile(source, destination, CopyOptions{.overwrite = true}).hasValue());
+  EXPECT_EQ(contentOf(destination), "new");
+}
+
+TEST_F(FileWriterTest, CopyFilePreservesHoles) {
+#if defined(__linux__)
+  // 8 MiB file with a single 4 KiB data block in the middle
+  const auto source = testDir_ / "sparse.img";
+  {
+    std::ofstream file(source, std::ios::binary);
+    file.seekp(4 * 1024 * 1024);
+    file << std::string(4096, 'd');
+  }
+  fs::resize_file(source, 8 * 1024 * 1024);
+  struct stat sourceInfo{};
+  ASSERT_EQ(::stat(source.c_str(), &sourceInfo), 0);
+  if (sourceInfo.st_blocks * 512 >= sourceInfo.st_size) {
+    GTEST_SKIP() << "filesystem does not support sparse files";
+  }
+
+  const auto destination = testDir_ / "sparse_copy.img";
+  for (const bool reflink : {true, false}) {
+    fs::remove(destination);
+    ASSERT_TRUE(
+        writer_.copyFile(source, destination, CopyOptions{.allowReflink = reflink}).hasValue());
+    struct stat copyInfo{};
+    ASSERT_EQ(::stat(destination.c_str(), &copyInfo), 0);
+    EXPECT_EQ(copyInfo.st_size, sourceInfo.st_size);
+    EXPECT_LE(copyInfo.st_blocks, sourceInfo.st_blocks + 64);
+  }
+  EXPECT_EQ(contentOf(destination), contentOf(source));
+#else
+  GTEST_SKIP() << "sparse file layout is checked on Linux only";
+#endif
+}
+
+TEST_F(FileWriterTest, FailedCopyKeepsExistingDestination) {
+#if defined(__linux__)
+  const auto source = testDir_ / "large.bin";
+  std::ofstream(source, std::ios::binary) << std::string(256 * 1024, 'x');
+  const auto destination = testDir_ / "large_copy.bin";
+  const auto fresh = testDir_ / "fresh_copy.bin";
+  std::ofstream(destination) << "existing content";
+
+  // Writes past 4 KiB fail with EFBIG halfway through the copy
+  struct rlimit previous{};
+  ASSERT_EQ(::getrlimit(RLIMIT_FSIZE, &previous), 0);
+  auto *const previousHandler = std::signal(SIGXFSZ, SIG_IGN);
+  struct rlimit limited = previous;
+  limited.rlim_cur = 4096;
+  ASSERT_EQ(::setrlimit(RLIMIT_FSIZE, &limited), 0);
+  auto copied = writer_.copyFile(source, destination,
+                                 CopyOptions{.overwrite = true, .allowReflink = false});
+  auto created = writer_.copyFile(source, fresh, CopyOptions{.allowReflink = false});
+  ::setrlimit(RLIMIT_FSIZE, &previous);
+  std::signal(SIGXFSZ, previousHandler);
+
+  ASSERT_FALSE(copied.hasValue());
+  EXPECT_EQ(copied.error().code, FileErrorCode::WriteError);
+  EXPECT_EQ(contentOf(destination), "existing content");
+  ASSERT_FALSE(created.hasValue());
+  EXPECT_FALSE(fs::exists(fresh));
+  // Neither copy leaves a partial file behind
+  EXPECT_EQ(std::distance(fs::directory_iterator(testDir_), fs::directory_iterator()), 2);
+#else
+  GTEST_SKIP() << "file size limits are exercised on Linux only";
+#endif
+}
+
+TEST_F(FileWriterTest, CopyFileRejectsInvalidArguments) {
+  const auto source = testDir_ / "a.txt";
+  std::ofstream(source) << "a";
+
+  auto missing = writer_.copyFile(testDir_ / "missing.txt", testDir_ / "b.txt");
+  ASSERT_FALSE(missing.hasValue());
+  EXPECT_EQ(missing.error().code, FileErrorCode::NotFound);
+
+  auto directorySource = writer_.copyFile(testDir_, testDir_ / "b.txt");
+  ASSERT_FALSE(directorySource.hasValue());
+  EXPECT_EQ(directorySource.error().code, FileErrorCode::IsDirectory);
+
+  auto sameFile = writer_.copyFile(source, source, CopyOptions{.overwrite = true});
+  ASSERT_FALSE(sameFile.hasValue());
+  EXPECT_EQ(contentOf(source), "a");
+
+  auto empty = writer_.copyFile("", testDir_ / "b.txt");
+  ASSERT_FALSE(empty.hasValue());
+  EXPECT_EQ(empty.error().code, FileErrorCode::InvalidPath);
+}
+
+// ============================================================================
+// openAppender() tests
+// ============================================================================
+
+TEST_F(FileWriterTest, AppenderBuffersUntilFlush) {
+  const auto path = testDir_ / "log.txt";
+  auto appender = writer_.openAppender(path);
+  ASSERT_TRUE(appender.hasValue());
+
+  ASSERT_TRUE(appender.value().append("first\n").hasValue());
+  ASSERT_TRUE(appender.value().append("second\n").hasValue());
+  EXPECT_EQ(appender.value().pendingBytes(), 13U);
+  EXPECT_EQ(contentOf(path), "");
+
+  ASSERT_TRUE(appender.value().flush().hasValue());
+  EXPECT_EQ(appender.value().pendingBytes(), 0U);
+  EXPECT_EQ(contentOf(path), "first\nsecond\n");
+}
+
+TEST_F(FileWriterTest, AppenderWritesThroughWhenBufferOverflows) {
+  const auto path = testDir_ / "overflow.txt";
+  auto appender = writer_.openAppender(path, AppenderOptions{.bufferSize = 8});
+  ASSERT_TRUE(appender.hasValue());
+
+  ASSERT_TRUE(appender.value().append("abc").hasValue());
+  const std::string large(100, 'x');
+  ASSERT_TRUE(appender.value().append(large).hasValue());
+
+  // Buffered bytes precede the large append, written together
+  EXPECT_EQ(appender.value().pendingBytes(), 0U);
+  EXPECT_EQ(contentOf(path), "abc" + large);
+}
+
+TEST_F(FileWriterTest, AppenderKeepsExistingContentAndFlushesOnDestruction) {
+  const auto path = testDir_ / "nested" / "existing.txt";
+  ASSERT_TRUE(writer_.write(path, "existing\n").hasValue());
+  {
+    auto appender = writer_.openAppender(path);
+    ASSERT_TRUE(appender.hasValue());
+    ASSERT_TRUE(appender.value().append("appended\n").hasValue());
+    ASSERT_TRUE(appender.value().sync().hasValue());
+    ASSERT_TRUE(appender.value().append("on close\n").hasValue());
+  }
+  EXPECT_EQ(contentOf(path), "existing\nappended\non close\n");
+}
+
+TEST_F(FileWriterTest, AppenderCreatesParentDirectories) {
+  const auto path = testDir_ / "a" / "b" / "new.txt";
+  auto appender = writer_.openAppender(path, AppenderOptions{.bufferSize = 0});
+  ASSERT_TRUE(appender.hasValue());
+  ASSERT_TRUE(appender.value().append("unbuffered").hasValue());
+  EXPECT_EQ(contentOf(path), "unbuffered");
+}
+
+TEST_F(FileWriterTest, AppenderMoveTransfersPendingData) {
+  const auto path = testDir_ / "moved.txt";
+  auto opened = writer_.openAppender(path);
+  ASSERT_TRUE(opened.hasValue());
+  FileAppender appender = std::move(opened.value());
+  ASSERT_TRUE(appender.append("moved").hasValue());
+  FileAppender target = std::move(appender);
+  EXPECT_EQ(target.pendingBytes(), 5U);
+  ASSERT_TRUE(target.flush().hasValue());
+  EXPECT_EQ(contentOf(path), "moved");
+}
+
+TEST_F(FileWriterTest, OpenAppenderRejectsInvalidPaths) {
+  auto empty = writer_.openAppender("");
+  ASSERT_FALSE(empty.hasValue());
+  EXPECT_EQ(empty.error().code, FileErrorCode::InvalidPath);
+
+  auto directory = writer_.openAppender(testDir_);
+  ASSERT_FALSE(directory.hasValue());
+  EXPECT_EQ(directory.error().code, FileErrorCode::IsDirectory);
+}
+
+// ============================================================================
+// writeAtomic() tests
+// ============================================================================
+
+TEST_F(FileWriterTest, WriteAtomicReplacesContent) {
+  const auto path = testDir_ / "config.json";
+  std::ofstream(path) << "old content that is longer";
+
+  ASSERT_TRUE(writer_.writeAtomic(path, "new").hasValue());
+  EXPECT_EQ(contentOf(path), "new");
+  ASSERT_TRUE(writer_.writeAtomic(path, "").hasValue());
+  EXPECT_EQ(contentOf(path), "");
+}
+
+TEST_F(FileWriterTest, WriteAtomicCreatesParentsAndLeavesNoTemporaryFiles) {
+  const auto path = testDir_ / "nested" / "dir" / "state.bin";
+  ASSERT_TRUE(writer_.writeAtomic(path, std::string("\0binary\0", 8)).hasValue());
+  EXPECT_EQ(contentOf(path), std::string("\0binary\0", 8));
+
+  std::size_t entries = 0;
+  for (const auto &entry : fs::directory_iterator(path.parent_path())) {
+    EXPECT_EQ(entry.path(), path);
+    ++entries;
+  }
+  EXPECT_EQ(entries, 1U);
+}
+
+TEST_F(FileWriterTest, WriteAtomicKeepsFileMode) {
+  const auto path = testDir_ / "script.sh";
+  std::ofstream(path) << "#!/bin/sh\n";
+  fs::permissions(path, fs::perms::owner_all | fs::perms::group_read);
+
+  ASSERT_TRUE(writer_.writeAtomic(path, "#!/bin/sh\nexit 0\n").hasValue());
+  EXPECT_EQ(fs::status(path).permissions(), fs::perms::owner_all | fs::perms::group_read);
+}
+
+TEST_F(FileWriterTest, WriteAtomicRejectsInvalidPaths) {
+  auto empty = writer_.writeAtomic("", "data");
+  ASSERT_FALSE(empty.hasValue());
+  EXPECT_EQ(empty.error().code, FileErrorCode::InvalidPath);
+
+  auto directory = writer_.writeAtomic(testDir_, "data");
+  ASSERT_FALSE(directory.hasValue());
+  EXPECT_EQ(directory.error().code, FileErrorCode::IsDirectory);
+}
+
+TEST_F(FileWriterTest, ConcurrentWriteAtomicSharesCommits) {
+  constexpr int kThreads = 8;
+  constexpr int kWritesPerThread = 10;
+  auto committer = std::make_shared<GroupCommitter>();
+  const FileWriter writer(committer);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      for (int i = 0; i < kWritesPerThread; ++i) {
+        const auto path = testDir_ / ("file" + std::to_string(t) + ".txt");
+        EXPECT_TRUE(writer.writeAtomic(path, "write " + std::to_string(i)).hasValue());
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  for (int t = 0; t < kThreads; ++t) {
+    EXPECT_EQ(contentOf(testDir_ / ("file" + std::to_string(t) + ".txt")),
+              "write " + std::to_string(kWritesPerThread - 1));
+  }
+  const auto stats = committer->stats();
+  EXPECT_EQ(stats.files, static_cast<std::uint64_t>(kThreads * kWritesPerThread));
+  EXPECT_GE(stats.batches, 1U);
+  EXPECT_LE(stats.batches, stats.files);
+}
+
+TEST_F(FileWriterTest, FactoryWritersShareOneCommitter) {
+  auto committer = std::make_shared<GroupCommitter>();
+  auto first = UtilsFactory::createFileWriter(committer);
+  auto second = UtilsFactory::createFileWriter(committer);
+  ASSERT_TRUE(first->writeAtomic(testDir_ / "first.txt", "1").hasValue());
+  ASSERT_TRUE(second->writeAtomic(testDir_ / "second.txt", "2").hasValue());
+  EXPECT_EQ(committer->stats().files, 2U);
+
+  // Default factory writers commit through a shared committer as well
+  auto plain = UtilsFactory::createFileWriter();
+  ASSERT_TRUE(plain->writeAtomic(testDir_ / "plain.txt", "3").hasValue());
+  EXPECT_EQ(contentOf(testDir_ / "plain.txt"), "3");
+}
@@ -0,0 +1,122 @@
+#include <Utils/Filesystem/GlobMatcher.hpp>
+#include <gtest/gtest.h>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace nixoncpp::utils;
+
+namespace {
+  bool globMatches(std::string_view pattern, std::string_view path) {
+    auto matcher = GlobMatcher::compile(pattern);
+    EXPECT_TRUE(matcher.hasValue()) << pattern;
+    return matcher.hasValue() && matcher.value().matches(path);
+  }
+} // namespace
+
+TEST(GlobMatcherTest, WildcardsStayWithinAComponent) {
+  EXPECT_TRUE(globMatches("*.txt", "notes.txt"));
+  EXPECT_TRUE(globMatches("*.txt", ".txt"));
+  EXPECT_FALSE(globMatches("*.txt", "docs/notes.txt"));
+  EXPECT_FALSE(globMatches("*.txt", "notes.txt.bak"));
+  EXPECT_TRUE(globMatches("a?c", "abc"));
+  EXPECT_FALSE(globMatches("a?c", "a/c"));
+  EXPECT_FALSE(globMatches("a?c", "ac"));
+  EXPECT_TRUE(globMatches("a**b", "axxb"));
+  EXPECT_FALSE(globMatches("a**b", "ax/b"));
+  EXPECT_TRUE(globMatches("", ""));
+  EXPECT_FALSE(globMatches("", "a"));
+}
+
+TEST(GlobMatcherTest, DoubleStarSpansComponents) {
+  EXPECT_TRUE(globMatches("**/*.cpp", "main.cpp"));
+  EXPECT_TRUE(globMatches("**/*.cpp", "src/lib/main.cpp"));
+  EXPECT_FALSE(globMatches("**/*.cpp", "src/lib/main.hpp"));
+  EXPECT_TRUE(globMatches("a/**/b", "a/b"));
+  EXPECT_TRUE(globMatches("a/**/b", "a/x/y/b"));
+  EXPECT_FALSE(globMatches("a/**/b", "a/xb"));
+  EXPECT_TRUE(globMatches("src/**", "src/a/b.c"));
+  EXPECT_FALSE(globMatches("src/**", "src"));
+  EXPECT_FALSE(globMatches("src/**", "srcs/a"));
+  EXPECT_TRUE(globMatches("**", "any/depth"));
+}
+
+TEST(GlobMatcherTest, ClassesBracesAndEscapes) {
+  EXPECT_TRUE(globMatches("[a-c]x", "bx"));
+  EXPECT_FALSE(globMatches("[a-c]x", "dx"));
+  EXPECT_TRUE(globMatches("[!a-c]x", "dx"));
+  EXPECT_FALSE(globMatches("[^a-c]x", "ax"));
+  EXPECT_TRUE(globMatches("[]]", "]"));
+  EXPECT_FALSE(globMatches("[!a]", "/"));
+  EXPECT_TRUE(globMatches("[", "["));
+  EXPECT_TRUE(globMatches("*.{cpp,hpp}", "a.hpp"));
+  EXPECT_FALSE(globMatches("*.{cpp,hpp}", "a.h"));
+  EXPECT_TRUE(globMatches("{a,b{c,d}}.x", "bd.x"));
+  EXPECT_FALSE(globMatches("{a,b{c,d}}.x", "b.x"));
+  EXPECT_TRUE(globMatches("{a}", "{a}"));
+  EXPECT_TRUE(globMatches("\\*\\{a,b\\}", "*{a,b}"));
+  EXPECT_FALSE(globMatches("\\*", "x"));
+}
+
+TEST(GlobMatcherTest, CombinesPatternsIntoOneMatcher) {
+  const std::vector<std::string_view> patterns = {"*.log", "build/**", "docs/*.md"};
+  auto matcher = GlobMatcher::compile(patterns);
+  ASSERT_TRUE(matcher.hasValue());
+  const auto &glob = matcher.value();
+  EXPECT_TRUE(glob.matches("server.log"));
+  EXPECT_TRUE(glob.matches("build/obj/a.o"));
+  EXPECT_TRUE(glob.matches("docs/readme.md"));
+  EXPECT_FALSE(glob.matches("docs/api/readme.md"));
+  EXPECT_FALSE(glob.matches("src/main.cpp"));
+
+  auto none = GlobMatcher::compile(std::span<const std::string_view>());
+  ASSERT_TRUE(none.hasValue());
+  EXPECT_FALSE(none.value().matches(""));
+  EXPECT_FALSE(none.value().matches("a"));
+}
+
+TEST(GlobMatcherTest, TellsWhetherASubtreeCanMatch) {
+  auto matcher = GlobMatcher::compile("src/**/*.cpp");
+  ASSERT_TRUE(matcher.hasValue());
+  EXPECT_TRUE(matcher.value().canMatchBelow("src"));
+  EXPECT_TRUE(matcher.value().canMatchBelow("src/lib"));
+  EXPECT_FALSE(matcher.value().canMatchBelow("docs"));
+
+  auto shallow = GlobMatcher::compile("*/*.txt");
+  ASSERT_TRUE(shallow.hasValue());
+  EXPECT_TRUE(shallow.value().canMatchBelow("a"));
+  EXPECT_FALSE(shallow.value().canMatchBelow("a/b"));
+}
+
+TEST(GlobMatcherTest, SimulatesTheNfaWhenTheDfaWouldBeTooLarge) {
+  auto small = GlobMatcher::compile("**/*.txt");
+  ASSERT_TRUE(small.hasValue());
+  EXPECT_TRUE(small.value().isDeterministic());
+
+  // Tracking every 'a' among the last 17 bytes takes 2^16 DFA states
+  auto large = GlobMatcher::compile("**/*a" + std::string(16, '?'));
+  ASSERT_TRUE(large.hasValue());
+  const auto &glob = large.value();
+  EXPECT_FALSE(glob.isDeterministic());
+  EXPECT_TRUE(glob.matches("d/e/xa" + std::string(16, 'b')));
+  EXPECT_TRUE(glob.matches("aa" + std::string(16, 'a')));
+  EXPECT_FALSE(glob.matches("d/a" + std::string(15, 'b')));
+  EXPECT_FALSE(glob.matches("a" + std::string(8, 'b') + "/" + std::string(7, 'b')));
+  EXPECT_TRUE(glob.canMatchBelow("d/e"));
+}
+
+TEST(GlobMatcherTest, RejectsPatternsThatAreTooLarge) {
+  std::string pattern;
+  for (int i = 0; i < 11; ++i) {
+    pattern += "{a,b}";
+  }
+  auto expanded = GlobMatcher::compile(pattern);
+  ASSERT_FALSE(expanded.hasValue());
+  EXPECT_EQ(expanded.error().code, FileErrorCode::InvalidPath);
+  EXPECT_EQ(expanded.error().path, pattern);
+
+  auto tooLong = GlobMatcher::compile(std::string(GlobMatcher::kMaxStates, 'a'));
+  ASSERT_FALSE(tooLong.hasValue());
+  EXPECT_EQ(tooLong.error().code, FileErrorCode::InvalidPath);
+}
@@ -0,0 +1,341 @@
+#include "../src/lib/Utils/Logger/ConsoleLogger.hpp"
+#include "../src/lib/Utils/Logger/ShmLogRing.hpp"
+#include "../src/lib/Utils/Logger/UnixSocketSink.hpp"
+#include <chrono>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace nixoncpp::logging;
+
+namespace {
+  class CapturingSink : public ILogSink {
+  public:
+    void write(const LogRecord &record) override {
+      std::lock_guard<std::mutex> lock(mutex_);
+      lines.emplace_back(record.line);
+      levels.push_back(record.level);
+    }
+
+    std::mutex mutex_;
+    std::vector<std::string> lines;
+    std::vector<Level> levels;
+  };
+} // namespace
+
+// ============================================================================
+// ConsoleLogger sink tests
+// ============================================================================
+
+TEST(ConsoleLoggerSinkTest, SinkReceivesFormattedRecords) {
+  auto logger = std::make_shared<ConsoleLogger>();
+  auto sink = std::make_shared<CapturingSink>();
+  logger->setLevel(Level::LOG_INFO);
+  logger->noHeader(true);
+  logger->addSink(sink);
+
+  logger->info("first");
+  logger->error("second");
+
+  ASSERT_EQ(sink->lines.size(), 2);
+  EXPECT_EQ(sink->lines[0], "first");
+  EXPECT_EQ(sink->lines[1], "second");
+  EXPECT_EQ(sink->levels[1], Level::LOG_ERROR);
+
+  logger->clearSinks();
+  logger->info("not captured");
+  EXPECT_EQ(sink->lines.size(), 2);
+}
+
+#if defined(__linux__) || defined(__APPLE__)
+
+// ============================================================================
+// ShmLogRing tests
+// ============================================================================
+
+class ShmLogRingTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    name_ = "/nixoncpp-test-" + std::to_string(::getpid()) + "-" +
+            ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    ShmLogRing::remove(name_);
+  }
+
+  void TearDown() override { ShmLogRing::remove(name_); }
+
+  std::string name_;
+};
+
+TEST_F(ShmLogRingTest, DrainsRecordsInOrder) {
+  auto ring = ShmLogRing::open(name_);
+  ASSERT_TRUE(ring.hasValue()) << ring.error().toString();
+
+  ring.value()->push(Level::LOG_INFO, 1, "alpha");
+  ring.value()->push(Level::LOG_WARNING, 2, "beta");
+
+  std::vector<std::string> lines;
+  auto stats = ring.value()->drain([&lines](const ShmLogRecord &record) {
+    lines.emplace_back(record.line);
+  });
+
+  EXPECT_EQ(stats.records, 2);
+  EXPECT_EQ(stats.lost, 0);
+  EXPECT_EQ(lines, (std::vector<std::string>{"alpha", "beta"}));
+  EXPECT_EQ(ring.value()->drain([](const ShmLogRecord &) {}).records, 0);
+}
+
+TEST_F(ShmLogRingTest, SecondAttachSharesTheRing) {
+  auto writer = ShmLogRing::open(name_, ShmLogRingConfig{.slotCount = 32, .slotSize = 256});
+  ASSERT_TRUE(writer.hasValue()) << writer.error().toString();
+  auto collector = ShmLogRing::open(name_);
+  ASSERT_TRUE(collector.hasValue()) << collector.error().toString();
+
+  EXPECT_EQ(collector.value()->slotCount(), 32);
+  writer.value()->push(Level::LOG_ERROR, 3, "shared");
+
+  std::string seen;
+  collector.value()->drain([&seen](const ShmLogRecord &record) { seen = record.line; });
+  EXPECT_EQ(seen, "shared");
+}
+
+TEST_F(ShmLogRingTest, OverrunReportsLostRecords) {
+  auto ring = ShmLogRing::open(name_, ShmLogRingConfig{.slotCount = 16, .slotSize = 128});
+  ASSERT_TRUE(ring.hasValue()) << ring.error().toString();
+
+  for (int i = 0; i < 40; ++i) {
+    ring.value()->push(Level::LOG_INFO, i, "record " + std::to_string(i));
+  }
+
+  std::vector<std::string> lines;
+  auto stats = ring.value()->drain([&lines](const ShmLogRecord &record) {
+    lines.emplace_back(record.line);
+  });
+
+  EXPECT_EQ(stats.records, 16);
+  EXPECT_EQ(stats.lost, 24);
+  ASSERT_FALSE(lines.empty());
+  EXPECT_EQ(lines.front(), "record 24");
+  EXPECT_EQ(lines.back(), "record 39");
+}
+
+TEST_F(ShmLogRingTest, LongLinesAreTruncated) {
+  auto ring = ShmLogRing::open(name_, ShmLogRingConfig{.slotCount = 16, .slotSize = 128});
+  ASSERT_TRUE(ring.hasValue()) << ring.error().toString();
+
+  const std::string longLine(1000, 'x');
+  ring.value()->push(Level::LOG_INFO, 0, longLine);
+
+  ring.value()->drain([&ring](const ShmLogRecord &record) {
+    EXPECT_TRUE(record.truncated);
+    EXPECT_EQ(record.line.size(), ring.value()->maxLineLength());
+  });
+}
+
+TEST_F(ShmLogRingTest, RecordsSurviveWriterProcessExit) {
+  auto ring = ShmLogRing::open(name_);
+  ASSERT_TRUE(ring.hasValue()) << ring.error().toString();
+
+  const pid_t child = ::fork();
+  ASSERT_GE(child, 0);
+  if (child == 0) {
+    auto childRing = ShmLogRing::open(name_);
+    if (childRing) {
+      childRing.value()->push(Level::LOG_CRITICAL, 7, "from child");
+    }
+    ::_exit(0); // Exit without any cleanup, like a crash
+  }
+  int status = 0;
+  ::waitpid(child, &status, 0);
+
+  std::vector<ShmLogRecord> records;
+  std::vector<std::string> lines;
+  ring.value()->drain([&](const ShmLogRecord &record) {
+    records.push_back(record);
+    lines.emplace_back(record.line);
+  });
+
+  ASSERT_EQ(lines.size(), 1);
+  EXPECT_EQ(lines[0], "from child");
+  EXPECT_EQ(records[0].pid, child);
+  EXPECT_EQ(records[0].level, Level::LOG_CRITICAL);
+}
+
+TEST_F(ShmLogRingTest, SlotOfCrashedWriterIsReusedOnNextLap) {
+  auto ring = ShmLogRing::open(name_, ShmLogRingConfig{.slotCount = 16, .slotSize = 128});
+  ASSERT_TRUE(ring.hasValue()) << ring.error().toString();
+
+  // An inaccessible source buffer makes the child crash after claiming slot 0, mid-copy
+  void *page = ::mmap(nullptr, 4096, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  ASSERT_NE(page, MAP_FAILED);
+  const pid_t child = ::fork();
+  ASSERT_GE(child, 0);
+  if (child == 0) {
+    auto childRing = ShmLogRing::open(name_);
+    if (childRing) {
+      childRing.value()->push(Level::LOG_INFO, 0, std::string_view(static_cast<char *>(page), 64));
+    }
+    ::_exit(0);
+  }
+  int status = 0;
+  ::waitpid(child, &status, 0);
+  ::munmap(page, 4096);
+  ASSERT_TRUE(WIFSIGNALED(status));
+
+  auto ignore = [](const ShmLogRecord &) {};
+  EXPECT_EQ(ring.value()->drain(ignore).records, 0); // Pending: the writer may still commit
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_EQ(ring.value()->drain(ignore).lost, 1);
+
+  // The next lap wraps around onto slot 0 again
+  for (int i = 0; i < 16; ++i) {
+    ring.value()->push(Level::LOG_INFO, i, "record " + std::to_string(i));
+  }
+  std::vector<std::string> lines;
+  auto stats = ring.value()->drain([&lines](const ShmLogRecord &record) {
+    lines.emplace_back(record.line);
+  });
+
+  EXPECT_EQ(stats.records, 16);
+  EXPECT_EQ(stats.lost, 0);
+  ASSERT_FALSE(lines.empty());
+  EXPECT_EQ(lines.back(), "record 15");
+}
+
+TEST_F(ShmLogRingTest, RecordDroppedOnBusySlotIsCountedOnceWithoutStalling) {
+  auto ring = ShmLogRing::open(name_, ShmLogRingConfig{.slotCount = 16, .slotSize = 128});
+  ASSERT_TRUE(ring.hasValue()) << ring.error().toString();
+
+  // The child crashes while filling slot 0, as above
+  void *page = ::mmap(nullptr, 4096, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  ASSERT_NE(page, MAP_FAILED);
+  const pid_t child = ::fork();
+  ASSERT_GE(child, 0);
+  if (child == 0) {
+    auto childRing = ShmLogRing::open(name_);
+    if (childRing) {
+      childRing.value()->push(Level::LOG_INFO, 0, std::string_view(static_cast<char *>(page), 64));
+    }
+    ::_exit(0);
+  }
+  int status = 0;
+  ::waitpid(child, &status, 0);
+  ::munmap(page, 4096);
+  ASSERT_TRUE(WIFSIGNALED(status));
+
+  // Sequences 1-15 fill the other slots; sequence 16 finds slot 0 still claimed and is dropped
+  for (int i = 1; i <= 16; ++i) {
+    ring.value()->push(Level::LOG_INFO, i, "record " + std::to_string(i));
+  }
+  EXPECT_EQ(ring.value()->lostCount(), 0);
+
+  // Sequence 0 was lapped; 16 is skipped at once instead of waiting for the pending timeout
+  auto ignore = [](const ShmLogRecord &) {};
+  const auto stats = ring.value()->drain(ignore);
+  EXPECT_EQ(stats.records, 15);
+  EXPECT_EQ(stats.lost, 2);
+  EXPECT_EQ(ring.value()->lostCount(), 2);
+  ring.value()->push(Level::LOG_INFO, 17, "record 17");
+  EXPECT_EQ(ring.value()->drain(ignore).records, 1);
+}
+
+// ============================================================================
+// UnixSocketSink tests
+// ============================================================================
+
+class UnixSocketSinkTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    socketPath_ = std::filesystem::temp_directory_path() /
+                  ("nixoncpp-sock-" + std::to_string(::getpid()) + "-" +
+                   ::testing::UnitTest::GetInstance()->current_test_info()->name());
+    std::filesystem::remove(socketPath_);
+
+    receiverFd_ = ::socket(AF_UNIX, SOCK_DGRAM, 0);
+    ASSERT_GE(receiverFd_, 0);
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    const auto native = socketPath_.string();
+    ASSERT_LT(native.size(), sizeof(address.sun_path));
+    std::copy(native.begin(), native.end(), address.sun_path);
+    ASSERT_EQ(::bind(receiverFd_, reinterpret_cast<sockaddr *>(&address), sizeof(address)), 0);
+
+    timeval timeout{.tv_sec = 2, .tv_usec = 0};
+    ::setsockopt(receiverFd_, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+  }
+
+  void TearDown() override {
+    if (receiverFd_ >= 0) {
+      ::close(receiverFd_);
+    }
+    std::filesystem::remove(socketPath_);
+  }
+
+  std::string receive() const {
+    char buffer[1024];
+    const auto received = ::recv(receiverFd_, buffer, sizeof(buffer), 0);
+    return received > 0 ? std::string(buffer, static_cast<std::size_t>(received)) : std::string{};
+  }
+
+  static LogRecord record(std::string_view line) {
+    return LogRecord{
+        .level = Level::LOG_INFO, .timestamp = std::chrono::system_clock::now(), .line = line};
+  }
+
+  std::filesystem::path socketPath_;
+  int receiverFd_ = -1;
+};
+
+TEST_F(UnixSocketSinkTest, DeliversRecordsInOrder) {
+  auto sink = UnixSocketSink::open(socketPath_);
+  ASSERT_TRUE(sink.hasValue()) << sink.error().toString();
+
+  for (int i = 0; i < 100; ++i) {
+    sink.value()->write(record("line " + std::to_string(i)));
+  }
+  sink.value()->flush();
+
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_EQ(receive(), "line " + std::to_string(i));
+  }
+  EXPECT_EQ(sink.value()->sentCount(), 100);
+  EXPECT_EQ(sink.value()->droppedCount(), 0);
+}
+
+TEST_F(UnixSocketSinkTest, SlowReceiverDropsInsteadOfBlocking) {
+  UnixSocketSinkConfig config;
+  config.queueCapacity = 16;
+  config.flushTimeout = std::chrono::milliseconds(50);
+  auto sink = UnixSocketSink::open(socketPath_, config);
+  ASSERT_TRUE(sink.hasValue()) << sink.error().toString();
+
+  // Nobody reads: the socket buffer fills up, then the queue overflows
+  const std::string payload(512, 'x');
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < 20000; ++i) {
+    sink.value()->write(record(payload));
+  }
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+
+  EXPECT_LT(elapsed, std::chrono::seconds(5));
+  EXPECT_GT(sink.value()->droppedCount(), 0);
+  EXPECT_LE(sink.value()->sentCount() + sink.value()->droppedCount(), 20000);
+}
+
+TEST_F(UnixSocketSinkTest, MissingReceiverFailsToOpen) {
+  auto sink = UnixSocketSink::open(socketPath_.string() + ".missing");
+  ASSERT_FALSE(sink.hasValue());
+  EXPECT_EQ(sink.error().code, nixoncpp::utils::FileErrorCode::NotFound);
+}
+
+#endif